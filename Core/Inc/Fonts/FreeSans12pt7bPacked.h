@@ -0,0 +1,243 @@
+// FreeSans12pt7b, 95 of 95 glyphs, 45 packed (generated by fontpack.py)
+
+const uint8_t FreeSans12pt7bPackedBitmaps[] = {
+    0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0xCF, 0x3C, 0xF3, 0x8A, 0x20, 0x06, 0x30,
+    0x31, 0x03, 0x18, 0x18, 0xC7, 0xFF, 0xBF, 0xFC, 0x31, 0x03, 0x18, 0x18,
+    0xC7, 0xFF, 0xBF, 0xFC, 0x31, 0x01, 0x18, 0x18, 0xC0, 0xC6, 0x06, 0x30,
+    0x04, 0x03, 0xE1, 0xFF, 0x72, 0x6C, 0x47, 0x88, 0xF1, 0x07, 0x20, 0x7E,
+    0x03, 0xF0, 0x17, 0x02, 0x3C, 0x47, 0x88, 0xF1, 0x1B, 0x26, 0x7F, 0xC3,
+    0xE0, 0x10, 0x02, 0x00, 0x00, 0x06, 0x03, 0xC0, 0x40, 0x7E, 0x0C, 0x0E,
+    0x70, 0x80, 0xC3, 0x18, 0x0C, 0x31, 0x00, 0xE7, 0x30, 0x07, 0xE6, 0x00,
+    0x3C, 0x40, 0x00, 0x0C, 0x7C, 0x00, 0x8F, 0xE0, 0x19, 0xC7, 0x01, 0x18,
+    0x30, 0x31, 0x83, 0x02, 0x1C, 0x70, 0x40, 0xFE, 0x04, 0x07, 0xC0, 0x0F,
+    0x00, 0x7E, 0x03, 0x9C, 0x0C, 0x30, 0x30, 0xC0, 0xE7, 0x01, 0xF8, 0x03,
+    0x80, 0x3E, 0x01, 0xCC, 0x6E, 0x19, 0xB0, 0x7C, 0xC0, 0xF3, 0x03, 0xCE,
+    0x1F, 0x9F, 0xE6, 0x1E, 0x1C, 0xFF, 0xA0, 0x08, 0x8C, 0x66, 0x31, 0x98,
+    0xC6, 0x31, 0x8C, 0x63, 0x08, 0x63, 0x08, 0x61, 0x0C, 0x20, 0x82, 0x18,
+    0xC3, 0x18, 0xC3, 0x18, 0xC6, 0x31, 0x8C, 0x62, 0x31, 0x88, 0xC4, 0x62,
+    0x00, 0x10, 0x23, 0x5B, 0xE3, 0x8D, 0x91, 0x00, 0x42, 0x4F, 0x20, 0xAF,
+    0x04, 0x24, 0xF3, 0xF5, 0x60, 0xFF, 0xF0, 0xF0, 0x02, 0x0C, 0x10, 0x20,
+    0xC1, 0x02, 0x0C, 0x10, 0x20, 0xC1, 0x02, 0x0C, 0x10, 0x20, 0xC1, 0x00,
+    0x35, 0x32, 0x72, 0x13, 0x33, 0x11, 0x25, 0x21, 0x03, 0x53, 0x02, 0x72,
+    0xF5, 0x02, 0x63, 0x12, 0x52, 0x11, 0x33, 0x31, 0x27, 0x23, 0x53, 0x41,
+    0x32, 0x23, 0x05, 0xF0, 0x32, 0xFA, 0x1F, 0x0F, 0xF9, 0x87, 0x60, 0x7C,
+    0x06, 0x00, 0xC0, 0x18, 0x07, 0x01, 0xC0, 0xF0, 0x78, 0x1C, 0x06, 0x00,
+    0x80, 0x30, 0x07, 0xFF, 0xFF, 0xE0, 0x3F, 0x0F, 0xF3, 0x87, 0x60, 0x6C,
+    0x0C, 0x01, 0x80, 0x70, 0x7C, 0x0F, 0x80, 0x18, 0x01, 0x80, 0x3C, 0x07,
+    0x80, 0xD8, 0x73, 0xFC, 0x1F, 0x00, 0x01, 0x80, 0x70, 0x0E, 0x03, 0xC0,
+    0xD8, 0x1B, 0x06, 0x61, 0x8C, 0x21, 0x8C, 0x33, 0x06, 0x7F, 0xFF, 0xFE,
+    0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x28, 0x11, 0x91, 0x12, 0x8F, 0x11,
+    0x21, 0x43, 0x18, 0x20, 0x34, 0x31, 0x83, 0x92, 0xF2, 0x02, 0x63, 0x03,
+    0x43, 0x11, 0x82, 0x35, 0x30, 0x0F, 0x07, 0xF9, 0xC3, 0x30, 0x74, 0x01,
+    0x80, 0x33, 0xC7, 0xFE, 0xF0, 0xDC, 0x1F, 0x01, 0xE0, 0x3C, 0x06, 0xC1,
+    0xDC, 0x71, 0xFC, 0x1F, 0x00, 0x0B, 0xF0, 0x91, 0x18, 0x21, 0x72, 0x27,
+    0x13, 0x62, 0x35, 0x24, 0xF0, 0x42, 0x5F, 0x04, 0x16, 0x32, 0x6F, 0x12,
+    0x27, 0xF0, 0x1F, 0x07, 0xF1, 0xC7, 0x30, 0x66, 0x0C, 0xC1, 0x8C, 0x61,
+    0xFC, 0x3F, 0x8E, 0x3B, 0x01, 0xE0, 0x3C, 0x07, 0x80, 0xD8, 0x31, 0xFC,
+    0x1F, 0x00, 0x1F, 0x07, 0xF1, 0xC7, 0x70, 0x6C, 0x07, 0x80, 0xF0, 0x1E,
+    0x07, 0x61, 0xEF, 0xFC, 0x79, 0x80, 0x30, 0x05, 0x81, 0x98, 0x73, 0xFC,
+    0x1E, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0xF0, 0x00, 0x0F, 0x56, 0xC9, 0x37,
+    0x41, 0x45, 0x32, 0x46, 0x04, 0x80, 0x39, 0x15, 0x64, 0x44, 0x64, 0x28,
+    0x4B, 0x10, 0x0C, 0xF0, 0xCF, 0x00, 0xCF, 0x00, 0xC0, 0x39, 0x14, 0x73,
+    0x54, 0x55, 0x28, 0x49, 0x37, 0x41, 0x44, 0x42, 0x46, 0x04, 0x80, 0x1B,
+    0x1F, 0x1F, 0xEE, 0x1B, 0x03, 0xC0, 0xC0, 0x30, 0x0C, 0x06, 0x03, 0x81,
+    0xC0, 0xE0, 0x30, 0x0C, 0x03, 0x00, 0x00, 0x00, 0x0C, 0x03, 0x00, 0x00,
+    0xFE, 0x00, 0x0F, 0xFE, 0x00, 0xF0, 0x3E, 0x07, 0x00, 0x3C, 0x38, 0x00,
+    0x30, 0xC1, 0xE0, 0x66, 0x0F, 0xD9, 0xD8, 0x61, 0xC3, 0xC3, 0x07, 0x0F,
+    0x1C, 0x1C, 0x3C, 0x60, 0x60, 0xF1, 0x81, 0x83, 0xC6, 0x06, 0x1B, 0x18,
+    0x38, 0xEE, 0x71, 0xE7, 0x18, 0xFD, 0xF8, 0x71, 0xE7, 0xC0, 0xE0, 0x00,
+    0x01, 0xE0, 0x00, 0x01, 0xFF, 0xC0, 0x01, 0xFC, 0x00, 0x64, 0x6F, 0x15,
+    0x65, 0x52, 0x22, 0x5F, 0x04, 0x32, 0x34, 0x42, 0x42, 0x4F, 0x03, 0x34,
+    0x33, 0x32, 0x62, 0x33, 0xA3, 0x2C, 0x22, 0x27, 0x32, 0x22, 0x82, 0x21,
+    0x38, 0x31, 0x12, 0xA2, 0x1F, 0x00, 0x0A, 0x30, 0xB2, 0x02, 0x72, 0x20,
+    0x28, 0x21, 0xF2, 0x02, 0x72, 0x20, 0xA3, 0x0B, 0x20, 0x28, 0x21, 0x02,
+    0x92, 0xF2, 0x02, 0x82, 0x10, 0xC1, 0x0A, 0x30, 0x56, 0x43, 0xA2, 0x23,
+    0x63, 0x11, 0x38, 0x21, 0x12, 0xA2, 0x12, 0xC0, 0x2D, 0xF4, 0x12, 0xA2,
+    0xF0, 0x13, 0x82, 0x12, 0x45, 0x31, 0x3A, 0x25, 0x64, 0x09, 0x50, 0xB3,
+    0x02, 0x73, 0x20, 0x28, 0x31, 0x02, 0x92, 0x10, 0x29, 0x30, 0x2A, 0x2F,
+    0x40, 0x29, 0x30, 0x29, 0x21, 0x02, 0x83, 0x10, 0x27, 0x32, 0x0B, 0x30,
+    0xA4, 0x0C, 0xF0, 0x02, 0xAF, 0x40, 0xB1, 0xF0, 0x02, 0xAF, 0x40, 0xCF,
+    0x00, 0x0B, 0xF0, 0x02, 0x9F, 0x40, 0xA1, 0xF0, 0x02, 0x9F, 0x60, 0x57,
+    0x43, 0xB2, 0x24, 0x54, 0x11, 0x39, 0x21, 0x12, 0xB2, 0x03, 0xD0, 0x2E,
+    0xF0, 0x02, 0x77, 0xF0, 0x02, 0xC2, 0xF0, 0x12, 0xB2, 0x12, 0xA3, 0x22,
+    0x84, 0x24, 0x55, 0x3A, 0x12, 0x56, 0x41, 0x02, 0x92, 0xF6, 0x0D, 0xF0,
+    0x02, 0x92, 0xF6, 0x02, 0xFF, 0xF0, 0x72, 0xFA, 0x02, 0x52, 0xF1, 0x03,
+    0x33, 0x17, 0x12, 0x52, 0xC0, 0x3B, 0x01, 0xCC, 0x0E, 0x30, 0x70, 0xC3,
+    0x83, 0x1C, 0x0C, 0xE0, 0x33, 0x80, 0xDE, 0x03, 0xDC, 0x0E, 0x38, 0x30,
+    0x60, 0xC1, 0xC3, 0x03, 0x8C, 0x06, 0x30, 0x1C, 0xC0, 0x3B, 0x00, 0x60,
+    0x02, 0x8F, 0xE0, 0xAF, 0x00, 0x03, 0xA3, 0xF0, 0x04, 0x84, 0xF0, 0x02,
+    0x11, 0x84, 0x02, 0x12, 0x62, 0x12, 0xF1, 0x02, 0x22, 0x42, 0x22, 0xF1,
+    0x02, 0x32, 0x22, 0x32, 0xF1, 0x02, 0x44, 0x42, 0xF1, 0x02, 0x52, 0x52,
+    0xE0, 0x1F, 0x00, 0xFC, 0x07, 0xE0, 0x3D, 0x81, 0xEE, 0x0F, 0x30, 0x79,
+    0xC3, 0xC6, 0x1E, 0x18, 0xF0, 0xE7, 0x83, 0x3C, 0x1D, 0xE0, 0x6F, 0x01,
+    0xF8, 0x0F, 0xC0, 0x3E, 0x01, 0xC0, 0x65, 0x63, 0xA4, 0x24, 0x54, 0x22,
+    0x29, 0x22, 0x12, 0xB2, 0x1F, 0x00, 0x2D, 0x2F, 0x41, 0x2B, 0x21, 0xF0,
+    0x22, 0x92, 0x22, 0x45, 0x42, 0x3B, 0x35, 0x75, 0x09, 0x30, 0xB1, 0x02,
+    0x72, 0x10, 0x28, 0x2F, 0x20, 0x27, 0x30, 0xB1, 0x0A, 0x20, 0x2A, 0xF6,
+    0x65, 0x63, 0xA4, 0x24, 0x54, 0x22, 0x29, 0x22, 0x12, 0xB2, 0x1F, 0x00,
+    0x2D, 0x2F, 0x41, 0x2B, 0x21, 0x12, 0x72, 0x22, 0x12, 0x26, 0x61, 0x24,
+    0x54, 0x23, 0xD1, 0x57, 0x22, 0x1E, 0x01, 0x11, 0x0A, 0x40, 0xC2, 0x02,
+    0x83, 0x10, 0x29, 0x21, 0xF2, 0x02, 0x82, 0x20, 0xB3, 0x0C, 0x20, 0x28,
+    0x31, 0x02, 0x92, 0x1F, 0x40, 0x29, 0x30, 0x47, 0x33, 0x92, 0x23, 0x53,
+    0x11, 0x37, 0x31, 0x29, 0x21, 0x2B, 0xF0, 0x14, 0x92, 0x75, 0x48, 0x28,
+    0x51, 0xB3, 0x02, 0xA2, 0xF0, 0x03, 0x92, 0x14, 0x53, 0x12, 0xA2, 0x47,
+    0x30, 0x0C, 0xF0, 0x52, 0x5F, 0xE0, 0x02, 0x92, 0xFC, 0x03, 0x73, 0x13,
+    0x53, 0x12, 0x92, 0x45, 0x40, 0x60, 0x06, 0xC0, 0x1D, 0xC0, 0x31, 0x80,
+    0x63, 0x01, 0xC7, 0x03, 0x06, 0x06, 0x0C, 0x1C, 0x1C, 0x30, 0x18, 0x60,
+    0x31, 0xC0, 0x73, 0x00, 0x66, 0x00, 0xDC, 0x01, 0xF0, 0x01, 0xE0, 0x03,
+    0xC0, 0x07, 0x00, 0xE0, 0x30, 0x1D, 0x80, 0xE0, 0x76, 0x07, 0x81, 0xD8,
+    0x1E, 0x06, 0x70, 0x7C, 0x18, 0xC1, 0xB0, 0xE3, 0x0C, 0xC3, 0x8C, 0x33,
+    0x0C, 0x38, 0xC6, 0x30, 0x67, 0x18, 0xC1, 0x98, 0x67, 0x06, 0x61, 0xD8,
+    0x1D, 0x83, 0x60, 0x3C, 0x0D, 0x80, 0xF0, 0x3E, 0x03, 0xC0, 0x70, 0x0F,
+    0x01, 0xC0, 0x18, 0x07, 0x00, 0x70, 0x0E, 0x60, 0x38, 0xE0, 0x60, 0xE1,
+    0xC0, 0xC3, 0x01, 0xCC, 0x01, 0xF8, 0x01, 0xE0, 0x03, 0x80, 0x07, 0x80,
+    0x1F, 0x00, 0x33, 0x00, 0xE7, 0x03, 0x86, 0x06, 0x0E, 0x1C, 0x0E, 0x70,
+    0x0C, 0xC0, 0x1C, 0x12, 0xA2, 0x11, 0x38, 0x31, 0x22, 0x73, 0x22, 0x36,
+    0x23, 0x33, 0x43, 0x34, 0x24, 0x24, 0x43, 0x23, 0x45, 0x22, 0x25, 0x64,
+    0x6F, 0x07, 0x27, 0xF6, 0x0D, 0xF0, 0xA3, 0x93, 0x18, 0x32, 0x82, 0x37,
+    0x33, 0x63, 0x45, 0x35, 0x52, 0x64, 0x36, 0x33, 0x72, 0x38, 0x22, 0x91,
+    0x39, 0x03, 0xA0, 0xDF, 0x00, 0x04, 0xF0, 0x02, 0x2F, 0xFF, 0x10, 0x4F,
+    0x00, 0x81, 0x81, 0x02, 0x06, 0x04, 0x08, 0x18, 0x10, 0x20, 0x60, 0x40,
+    0x81, 0x81, 0x02, 0x06, 0x04, 0x04, 0xF0, 0x22, 0xFF, 0xF1, 0x04, 0xF0,
+    0x0C, 0x0E, 0x05, 0x86, 0xC3, 0x21, 0x19, 0x8C, 0x83, 0xC1, 0x80, 0xFF,
+    0xFE, 0xE3, 0x8C, 0x30, 0x3F, 0x07, 0xF8, 0xE1, 0xCC, 0x0C, 0x00, 0xC0,
+    0x1C, 0x3F, 0xCF, 0x8C, 0xC0, 0xCC, 0x0C, 0xE3, 0xC7, 0xEF, 0x3C, 0x70,
+    0x02, 0xAF, 0x30, 0x22, 0x53, 0x02, 0x17, 0x20, 0x44, 0x31, 0x03, 0x63,
+    0x02, 0x82, 0xF3, 0x03, 0x62, 0x10, 0x44, 0x31, 0x02, 0x17, 0x20, 0x22,
+    0x53, 0x1F, 0x0F, 0xE7, 0x1B, 0x83, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0,
+    0x38, 0x37, 0x1C, 0xFE, 0x1F, 0x00, 0x92, 0xF3, 0x34, 0x22, 0x29, 0x13,
+    0x34, 0x03, 0x53, 0x02, 0x72, 0xF3, 0x03, 0x53, 0x13, 0x34, 0x26, 0x12,
+    0x34, 0x22, 0x1F, 0x07, 0xF1, 0xC7, 0x70, 0x3C, 0x07, 0xFF, 0xFF, 0xFE,
+    0x00, 0xC0, 0x1C, 0x0D, 0xC3, 0x1F, 0xE1, 0xF0, 0x23, 0x14, 0x12, 0x2F,
+    0x10, 0x5F, 0x01, 0x22, 0xF9, 0x1E, 0x67, 0xFD, 0xC7, 0xF0, 0x7C, 0x07,
+    0x80, 0xF0, 0x1E, 0x03, 0xC0, 0x7C, 0x1D, 0xC7, 0x9F, 0xB1, 0xE6, 0x00,
+    0xC0, 0x3E, 0x0E, 0x7F, 0xC7, 0xE0, 0x02, 0x8F, 0x30, 0x22, 0x42, 0x02,
+    0x16, 0x10, 0x43, 0x30, 0x35, 0x20, 0x26, 0x2F, 0x70, 0xF0, 0x3F, 0xFF,
+    0xFF, 0xF0, 0x22, 0xF0, 0x4F, 0x12, 0x2F, 0xE0, 0x40, 0x31, 0xC0, 0x18,
+    0x03, 0x00, 0x60, 0x0C, 0x01, 0x83, 0x30, 0xC6, 0x30, 0xCC, 0x1B, 0x83,
+    0xF0, 0x77, 0x0C, 0x61, 0x8E, 0x30, 0xE6, 0x0C, 0xC1, 0xD8, 0x18, 0x02,
+    0xFF, 0xF0, 0x02, 0x24, 0x35, 0x10, 0x21, 0x61, 0x70, 0x43, 0x43, 0x30,
+    0x35, 0x25, 0x20, 0x26, 0x25, 0x2F, 0x70, 0x02, 0x24, 0x20, 0x21, 0x61,
+    0x04, 0x33, 0x03, 0x52, 0x02, 0x62, 0xF7, 0x1F, 0x07, 0xF1, 0xC7, 0x70,
+    0x7C, 0x07, 0x80, 0xF0, 0x1E, 0x03, 0xC0, 0x7C, 0x1D, 0xC7, 0x1F, 0xC1,
+    0xF0, 0x02, 0x25, 0x30, 0x21, 0x72, 0x04, 0x43, 0x10, 0x36, 0x21, 0x02,
+    0x82, 0xF3, 0x03, 0x63, 0x04, 0x43, 0x10, 0xA2, 0x02, 0x25, 0x30, 0x2A,
+    0xF2, 0x34, 0x22, 0x29, 0x13, 0x34, 0x03, 0x53, 0x02, 0x72, 0xF3, 0x03,
+    0x53, 0x13, 0x34, 0x29, 0x34, 0x22, 0x92, 0xF2, 0xCF, 0x7F, 0x38, 0xC3,
+    0x0C, 0x30, 0xC3, 0x0C, 0x30, 0xC0, 0x3E, 0x1F, 0xEE, 0x1B, 0x00, 0xC0,
+    0x3C, 0x07, 0xF0, 0x3E, 0x01, 0xF0, 0x3E, 0x1D, 0xFE, 0x3E, 0x00, 0x12,
+    0x2F, 0x10, 0x5F, 0x01, 0x22, 0xF7, 0x14, 0x23, 0x02, 0x62, 0xF7, 0x02,
+    0x53, 0x03, 0x34, 0x16, 0x12, 0x24, 0x22, 0xE0, 0x66, 0x06, 0x60, 0x67,
+    0x0C, 0x30, 0xC3, 0x0C, 0x39, 0x81, 0x98, 0x19, 0x81, 0xF0, 0x0F, 0x00,
+    0xE0, 0x0E, 0x00, 0xC1, 0xC1, 0xB0, 0xE1, 0xD8, 0x70, 0xCC, 0x2C, 0x66,
+    0x36, 0x31, 0x9B, 0x18, 0xCD, 0x98, 0x64, 0x6C, 0x16, 0x36, 0x0F, 0x1A,
+    0x07, 0x8F, 0x03, 0x83, 0x80, 0xC1, 0xC0, 0x60, 0xEE, 0x18, 0xC6, 0x0C,
+    0xC1, 0xF0, 0x1C, 0x01, 0x80, 0x78, 0x1B, 0x03, 0x30, 0xC7, 0x30, 0x66,
+    0x06, 0xE0, 0x6C, 0x0D, 0x83, 0x38, 0x63, 0x0C, 0x63, 0x0E, 0x60, 0xCC,
+    0x1B, 0x03, 0x60, 0x3C, 0x07, 0x00, 0xE0, 0x18, 0x03, 0x00, 0xE0, 0x78,
+    0x0E, 0x00, 0xFF, 0xFF, 0xF0, 0x18, 0x0C, 0x07, 0x03, 0x81, 0xC0, 0x60,
+    0x30, 0x18, 0x0E, 0x03, 0xFF, 0xFF, 0xC0, 0x32, 0x23, 0x22, 0x1F, 0x61,
+    0x22, 0x02, 0x31, 0x22, 0x22, 0x1F, 0x62, 0x33, 0x20, 0x02, 0xFF, 0xF5,
+    0xC7, 0x18, 0xC6, 0x31, 0x8C, 0x63, 0x0C, 0x33, 0x31, 0x8C, 0x63, 0x18,
+    0xC6, 0x73, 0x00, 0x70, 0x3E, 0x09, 0xE4, 0x1F, 0x03, 0x80 };
+
+const GFXglyph FreeSans12pt7bPackedGlyphs[] = {
+    {0, 0, 0, 6, 0, 1}, // 0x20 ' '
+    {LCD_GLYPH_PLAIN | 0, 2, 18, 8, 3, -17}, // 0x21 '!'
+    {LCD_GLYPH_PLAIN | 5, 6, 6, 8, 1, -16}, // 0x22 '"'
+    {LCD_GLYPH_PLAIN | 10, 13, 16, 13, 0, -15}, // 0x23 '#'
+    {LCD_GLYPH_PLAIN | 36, 11, 20, 13, 1, -17}, // 0x24 '$'
+    {LCD_GLYPH_PLAIN | 64, 20, 17, 21, 1, -16}, // 0x25 '%'
+    {LCD_GLYPH_PLAIN | 107, 14, 17, 16, 1, -16}, // 0x26 '&'
+    {LCD_GLYPH_PLAIN | 137, 2, 6, 5, 1, -16}, // 0x27 '\x27'
+    {LCD_GLYPH_PLAIN | 139, 5, 23, 8, 2, -17}, // 0x28 '('
+    {LCD_GLYPH_PLAIN | 154, 5, 23, 8, 1, -17}, // 0x29 ')'
+    {LCD_GLYPH_PLAIN | 169, 7, 7, 9, 1, -17}, // 0x2A '*'
+    {176, 10, 11, 14, 2, -10}, // 0x2B '+'
+    {LCD_GLYPH_PLAIN | 183, 2, 6, 7, 2, -1}, // 0x2C ','
+    {LCD_GLYPH_PLAIN | 185, 6, 2, 8, 1, -7}, // 0x2D '-'
+    {LCD_GLYPH_PLAIN | 187, 2, 2, 6, 2, -1}, // 0x2E '.'
+    {LCD_GLYPH_PLAIN | 188, 7, 18, 7, 0, -17}, // 0x2F '/'
+    {204, 11, 17, 13, 1, -16}, // 0x30 '0'
+    {227, 5, 17, 13, 3, -16}, // 0x31 '1'
+    {LCD_GLYPH_PLAIN | 234, 11, 17, 13, 1, -16}, // 0x32 '2'
+    {LCD_GLYPH_PLAIN | 258, 11, 17, 13, 1, -16}, // 0x33 '3'
+    {LCD_GLYPH_PLAIN | 282, 11, 17, 13, 1, -16}, // 0x34 '4'
+    {306, 11, 17, 13, 1, -16}, // 0x35 '5'
+    {LCD_GLYPH_PLAIN | 329, 11, 17, 13, 1, -16}, // 0x36 '6'
+    {353, 11, 17, 13, 1, -16}, // 0x37 '7'
+    {LCD_GLYPH_PLAIN | 374, 11, 17, 13, 1, -16}, // 0x38 '8'
+    {LCD_GLYPH_PLAIN | 398, 11, 17, 13, 1, -16}, // 0x39 '9'
+    {LCD_GLYPH_PLAIN | 422, 2, 13, 6, 2, -12}, // 0x3A ':'
+    {LCD_GLYPH_PLAIN | 426, 2, 16, 6, 2, -11}, // 0x3B ';'
+    {430, 12, 12, 14, 1, -11}, // 0x3C '<'
+    {446, 12, 6, 14, 1, -8}, // 0x3D '='
+    {452, 12, 12, 14, 1, -11}, // 0x3E '>'
+    {LCD_GLYPH_PLAIN | 468, 10, 18, 13, 2, -17}, // 0x3F '?'
+    {LCD_GLYPH_PLAIN | 491, 22, 21, 24, 1, -17}, // 0x40 '@'
+    {549, 16, 18, 16, 0, -17}, // 0x41 'A'
+    {582, 13, 18, 16, 2, -17}, // 0x42 'B'
+    {608, 15, 18, 17, 1, -17}, // 0x43 'C'
+    {633, 14, 18, 17, 2, -17}, // 0x44 'D'
+    {661, 12, 18, 15, 2, -17}, // 0x45 'E'
+    {673, 11, 18, 14, 2, -17}, // 0x46 'F'
+    {683, 16, 18, 18, 1, -17}, // 0x47 'G'
+    {715, 13, 18, 17, 2, -17}, // 0x48 'H'
+    {723, 2, 18, 7, 2, -17}, // 0x49 'I'
+    {726, 9, 18, 13, 1, -17}, // 0x4A 'J'
+    {LCD_GLYPH_PLAIN | 736, 14, 18, 16, 2, -17}, // 0x4B 'K'
+    {768, 10, 18, 14, 2, -17}, // 0x4C 'L'
+    {773, 16, 18, 20, 2, -17}, // 0x4D 'M'
+    {LCD_GLYPH_PLAIN | 804, 13, 18, 18, 2, -17}, // 0x4E 'N'
+    {834, 17, 18, 19, 1, -17}, // 0x4F 'O'
+    {860, 12, 18, 16, 2, -17}, // 0x50 'P'
+    {876, 17, 19, 19, 1, -17}, // 0x51 'Q'
+    {908, 14, 18, 17, 2, -17}, // 0x52 'R'
+    {931, 14, 18, 16, 1, -17}, // 0x53 'S'
+    {961, 12, 18, 15, 1, -17}, // 0x54 'T'
+    {966, 13, 18, 17, 2, -17}, // 0x55 'U'
+    {LCD_GLYPH_PLAIN | 977, 15, 18, 15, 0, -17}, // 0x56 'V'
+    {LCD_GLYPH_PLAIN | 1011, 22, 18, 22, 0, -17}, // 0x57 'W'
+    {LCD_GLYPH_PLAIN | 1061, 15, 18, 16, 0, -17}, // 0x58 'X'
+    {1095, 16, 18, 16, 0, -17}, // 0x59 'Y'
+    {1120, 13, 18, 15, 1, -17}, // 0x5A 'Z'
+    {1145, 4, 23, 7, 2, -17}, // 0x5B '['
+    {LCD_GLYPH_PLAIN | 1153, 7, 18, 7, 0, -17}, // 0x5C '\x5C'
+    {1169, 4, 23, 7, 1, -17}, // 0x5D ']'
+    {LCD_GLYPH_PLAIN | 1176, 9, 9, 11, 1, -16}, // 0x5E '^'
+    {LCD_GLYPH_PLAIN | 1187, 15, 1, 13, -1, 4}, // 0x5F '_'
+    {LCD_GLYPH_PLAIN | 1189, 5, 4, 6, 1, -17}, // 0x60 '`'
+    {LCD_GLYPH_PLAIN | 1192, 12, 13, 13, 1, -12}, // 0x61 'a'
+    {1212, 12, 18, 13, 1, -17}, // 0x62 'b'
+    {LCD_GLYPH_PLAIN | 1237, 10, 13, 12, 1, -12}, // 0x63 'c'
+    {1254, 11, 18, 13, 1, -17}, // 0x64 'd'
+    {LCD_GLYPH_PLAIN | 1274, 11, 13, 13, 1, -12}, // 0x65 'e'
+    {1292, 5, 18, 7, 1, -17}, // 0x66 'f'
+    {LCD_GLYPH_PLAIN | 1301, 11, 18, 13, 1, -12}, // 0x67 'g'
+    {1326, 10, 18, 13, 1, -17}, // 0x68 'h'
+    {LCD_GLYPH_PLAIN | 1341, 2, 18, 5, 2, -17}, // 0x69 'i'
+    {1346, 4, 23, 6, 0, -17}, // 0x6A 'j'
+    {LCD_GLYPH_PLAIN | 1354, 11, 18, 12, 1, -17}, // 0x6B 'k'
+    {1379, 2, 18, 5, 1, -17}, // 0x6C 'l'
+    {1382, 17, 13, 19, 1, -12}, // 0x6D 'm'
+    {1399, 10, 13, 13, 1, -12}, // 0x6E 'n'
+    {LCD_GLYPH_PLAIN | 1411, 11, 13, 13, 1, -12}, // 0x6F 'o'
+    {1429, 12, 17, 13, 1, -12}, // 0x70 'p'
+    {1453, 11, 17, 13, 1, -12}, // 0x71 'q'
+    {LCD_GLYPH_PLAIN | 1472, 6, 13, 8, 1, -12}, // 0x72 'r'
+    {LCD_GLYPH_PLAIN | 1482, 10, 13, 12, 1, -12}, // 0x73 's'
+    {1499, 5, 16, 7, 1, -15}, // 0x74 't'
+    {1508, 10, 13, 13, 1, -12}, // 0x75 'u'
+    {LCD_GLYPH_PLAIN | 1519, 12, 13, 12, 0, -12}, // 0x76 'v'
+    {LCD_GLYPH_PLAIN | 1539, 17, 13, 17, 0, -12}, // 0x77 'w'
+    {LCD_GLYPH_PLAIN | 1567, 11, 13, 11, 0, -12}, // 0x78 'x'
+    {LCD_GLYPH_PLAIN | 1585, 11, 18, 11, 0, -12}, // 0x79 'y'
+    {LCD_GLYPH_PLAIN | 1610, 10, 13, 12, 1, -12}, // 0x7A 'z'
+    {1627, 5, 23, 8, 1, -17}, // 0x7B '{'
+    {1641, 2, 23, 6, 2, -17}, // 0x7C '|'
+    {LCD_GLYPH_PLAIN | 1644, 5, 23, 8, 2, -17}, // 0x7D '}'
+    {LCD_GLYPH_PLAIN | 1659, 10, 5, 12, 1, -10}}; // 0x7E '~'
+
+const GFXfont FreeSans12pt7bPacked = { (uint8_t *)FreeSans12pt7bPackedBitmaps, (GFXglyph *)FreeSans12pt7bPackedGlyphs, 0x20, 0x7E, 29, LCD_FONT_PACKED, NULL, 0, NULL };
+
+// Approx. 2338 bytes
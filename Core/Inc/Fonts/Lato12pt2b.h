@@ -0,0 +1,434 @@
+// Lato-Regular.ttf 12 pt, 2-bit coverage, 0x20 to 0x7E (generated by fontconv.py)
+// Lato, Copyright (c) 2010-2014 Lukasz Dziedzic, SIL Open Font License 1.1
+
+const uint8_t Lato12pt2bBitmaps[] = {
+    0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x2C, 0x2C, 0x2C, 0x00,
+    0x00, 0x00, 0x00, 0x3D, 0x7D, 0x78, 0x79, 0xE1, 0xE7, 0x87, 0x8E, 0x0E,
+    0x38, 0x38, 0x90, 0x90, 0x00, 0x2C, 0x0D, 0x00, 0x03, 0x81, 0xD0, 0x00,
+    0x74, 0x2D, 0x00, 0x07, 0x42, 0xC0, 0x00, 0xB0, 0x38, 0x01, 0xFF, 0xFF,
+    0xFD, 0x2F, 0xFF, 0xFF, 0xC0, 0x0E, 0x07, 0x40, 0x01, 0xD0, 0xB0, 0x00,
+    0x2C, 0x0F, 0x00, 0x7F, 0xFF, 0xFF, 0x47, 0xFF, 0xFF, 0xF4, 0x03, 0x81,
+    0xD0, 0x00, 0x74, 0x2D, 0x00, 0x0B, 0x42, 0xC0, 0x00, 0xB0, 0x38, 0x00,
+    0x0E, 0x03, 0x80, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x0A, 0x00, 0x01, 0xBF,
+    0x90, 0x0B, 0xFF, 0xF8, 0x1F, 0x4D, 0x28, 0x2D, 0x0D, 0x00, 0x3C, 0x0D,
+    0x00, 0x3D, 0x1C, 0x00, 0x2F, 0x5C, 0x00, 0x0B, 0xFD, 0x00, 0x01, 0xBF,
+    0xE0, 0x00, 0x1E, 0xFC, 0x00, 0x28, 0x7D, 0x00, 0x28, 0x1E, 0x00, 0x28,
+    0x1E, 0x10, 0x28, 0x2D, 0x79, 0x38, 0xBC, 0x2F, 0xFF, 0xF4, 0x06, 0xFF,
+    0x80, 0x00, 0x34, 0x00, 0x00, 0x34, 0x00, 0x00, 0x70, 0x00, 0x1B, 0xD0,
+    0x00, 0x2D, 0x1F, 0xFE, 0x00, 0x1E, 0x0B, 0x47, 0xC0, 0x0F, 0x03, 0x80,
+    0x74, 0x0B, 0x40, 0xE0, 0x1D, 0x0B, 0x40, 0x38, 0x07, 0x47, 0x80, 0x0B,
+    0x47, 0xC3, 0xC0, 0x01, 0xFF, 0xE2, 0xD0, 0x00, 0x1B, 0xD2, 0xD0, 0x00,
+    0x00, 0x01, 0xE0, 0xBE, 0x40, 0x00, 0xF0, 0xBF, 0xF4, 0x00, 0xB4, 0x78,
+    0x1E, 0x00, 0xB4, 0x2C, 0x02, 0xC0, 0x78, 0x0B, 0x00, 0xB0, 0x7C, 0x01,
+    0xE0, 0x78, 0x3D, 0x00, 0x2F, 0xFD, 0x2D, 0x00, 0x02, 0xF9, 0x00, 0x00,
+    0x6F, 0x90, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x07, 0xD0, 0xBC, 0x00, 0x0B,
+    0x80, 0x2D, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x03,
+    0xD0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x0F, 0xBD, 0x00, 0xE0, 0x3D,
+    0x1F, 0x40, 0xE0, 0xB8, 0x07, 0xE1, 0xD0, 0xF4, 0x00, 0xFB, 0xC0, 0xF4,
+    0x00, 0x3F, 0x80, 0xF8, 0x00, 0x2F, 0x80, 0x7E, 0x41, 0xBB, 0xE0, 0x2F,
+    0xFF, 0xE1, 0xF4, 0x06, 0xFE, 0x40, 0x7D, 0x79, 0xE7, 0x8E, 0x38, 0x90,
+    0x00, 0x40, 0xB0, 0x78, 0x2D, 0x0E, 0x0B, 0x42, 0xC0, 0xF0, 0x78, 0x1E,
+    0x07, 0x81, 0xD0, 0x78, 0x1E, 0x07, 0x80, 0xF0, 0x2C, 0x07, 0x40, 0xE0,
+    0x2D, 0x07, 0x80, 0xB0, 0x04, 0x50, 0x38, 0x0B, 0x41, 0xE0, 0x2D, 0x07,
+    0x80, 0xE0, 0x3C, 0x0B, 0x42, 0xD0, 0x74, 0x1D, 0x07, 0x42, 0xD0, 0xB4,
+    0x3C, 0x0E, 0x07, 0x82, 0xC1, 0xE0, 0xB4, 0x38, 0x00, 0x02, 0x40, 0x42,
+    0x44, 0xB6, 0x6C, 0x1F, 0xE0, 0x1B, 0xE0, 0xB6, 0x6D, 0x42, 0x44, 0x02,
+    0x40, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38,
+    0x00, 0x00, 0x38, 0x00, 0xBF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFE, 0x00, 0x38,
+    0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38,
+    0x00, 0xBA, 0xF1, 0x8D, 0xA0, 0xBF, 0xFB, 0xFF, 0xBA, 0xE0, 0x00, 0x02,
+    0xC0, 0x01, 0xD0, 0x00, 0xB0, 0x00, 0x38, 0x00, 0x2D, 0x00, 0x0E, 0x00,
+    0x07, 0x40, 0x02, 0xC0, 0x01, 0xE0, 0x00, 0xB0, 0x00, 0x38, 0x00, 0x1D,
+    0x00, 0x0F, 0x00, 0x07, 0x40, 0x02, 0xC0, 0x00, 0xE0, 0x00, 0xB4, 0x00,
+    0x38, 0x00, 0x00, 0x00, 0x6F, 0x90, 0x00, 0x2F, 0xFF, 0x80, 0x0B, 0xD0,
+    0x7E, 0x01, 0xF0, 0x01, 0xF4, 0x2E, 0x00, 0x0B, 0x83, 0xD0, 0x00, 0x7C,
+    0x3C, 0x00, 0x03, 0xC7, 0xC0, 0x00, 0x3C, 0x7C, 0x00, 0x03, 0xD7, 0xC0,
+    0x00, 0x3C, 0x3C, 0x00, 0x03, 0xC3, 0xD0, 0x00, 0x7C, 0x2E, 0x00, 0x0B,
+    0x81, 0xF0, 0x01, 0xF4, 0x0B, 0xD0, 0x7E, 0x00, 0x2F, 0xFF, 0x80, 0x00,
+    0x6F, 0x90, 0x00, 0x00, 0x7D, 0x00, 0x07, 0xF4, 0x00, 0x7F, 0xD0, 0x0B,
+    0xDF, 0x40, 0x7C, 0x3D, 0x00, 0x40, 0xF4, 0x00, 0x03, 0xD0, 0x00, 0x0F,
+    0x40, 0x00, 0x3D, 0x00, 0x00, 0xF4, 0x00, 0x03, 0xD0, 0x00, 0x0F, 0x40,
+    0x00, 0x3D, 0x00, 0x00, 0xF4, 0x00, 0x03, 0xD0, 0x0B, 0xFF, 0xFE, 0x2F,
+    0xFF, 0xF8, 0x01, 0xBF, 0x80, 0x0B, 0xFF, 0xF4, 0x2F, 0x41, 0xF8, 0x3D,
+    0x00, 0x7D, 0x78, 0x00, 0x3D, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3C, 0x00,
+    0x00, 0xB8, 0x00, 0x01, 0xE0, 0x00, 0x07, 0xC0, 0x00, 0x1F, 0x00, 0x00,
+    0x7D, 0x00, 0x01, 0xF4, 0x00, 0x07, 0xD0, 0x00, 0x1F, 0x40, 0x00, 0x7F,
+    0xFF, 0xFE, 0xBF, 0xFF, 0xFE, 0x01, 0xBF, 0x90, 0x0B, 0xFF, 0xF4, 0x1F,
+    0x41, 0xBC, 0x3D, 0x00, 0x3D, 0x28, 0x00, 0x2D, 0x00, 0x00, 0x3C, 0x00,
+    0x01, 0xB8, 0x00, 0x2F, 0xD0, 0x00, 0x2F, 0xF4, 0x00, 0x01, 0xBC, 0x00,
+    0x00, 0x2E, 0x00, 0x00, 0x1E, 0x74, 0x00, 0x1E, 0x7C, 0x00, 0x2E, 0x2F,
+    0x41, 0xBC, 0x0F, 0xFF, 0xF4, 0x02, 0xBF, 0x80, 0x00, 0x00, 0xBC, 0x00,
+    0x00, 0x1F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xB7, 0xC0, 0x00, 0x1E,
+    0x3C, 0x00, 0x07, 0xC3, 0xC0, 0x00, 0xF4, 0x3C, 0x00, 0x2D, 0x03, 0xC0,
+    0x07, 0x80, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x2D, 0x00, 0x3C, 0x07, 0xFF,
+    0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x3C,
+    0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x3C, 0x00, 0x07, 0xFF, 0xF8, 0x0B,
+    0xFF, 0xF4, 0x0F, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x1D,
+    0x00, 0x00, 0x2E, 0xFE, 0x40, 0x2F, 0xFF, 0xE0, 0x15, 0x06, 0xF8, 0x00,
+    0x00, 0x7C, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3C, 0x00,
+    0x00, 0xB8, 0x79, 0x06, 0xF4, 0x7F, 0xFF, 0xD0, 0x06, 0xFE, 0x00, 0x00,
+    0x07, 0xD0, 0x00, 0x0F, 0x80, 0x00, 0x2E, 0x00, 0x00, 0xB8, 0x00, 0x01,
+    0xF0, 0x00, 0x03, 0xD0, 0x00, 0x0B, 0xAF, 0x90, 0x1F, 0xFF, 0xF4, 0x3F,
+    0x41, 0xBD, 0x7C, 0x00, 0x3E, 0xB8, 0x00, 0x1E, 0xB4, 0x00, 0x1F, 0xB8,
+    0x00, 0x1E, 0x7C, 0x00, 0x3D, 0x3E, 0x41, 0xFC, 0x0F, 0xFF, 0xF0, 0x02,
+    0xBE, 0x40, 0xBF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0x00, 0x00, 0x2E, 0x00,
+    0x00, 0x3C, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xF0, 0x00, 0x02, 0xD0, 0x00,
+    0x07, 0xC0, 0x00, 0x0B, 0x40, 0x00, 0x1F, 0x00, 0x00, 0x2D, 0x00, 0x00,
+    0x7C, 0x00, 0x00, 0xB4, 0x00, 0x01, 0xF0, 0x00, 0x02, 0xD0, 0x00, 0x07,
+    0xC0, 0x00, 0x0B, 0x40, 0x00, 0x02, 0xFE, 0x40, 0x0F, 0xFF, 0xF0, 0x2E,
+    0x41, 0xF8, 0x3C, 0x00, 0x7C, 0x7C, 0x00, 0x3C, 0x3C, 0x00, 0x7C, 0x2E,
+    0x41, 0xF4, 0x07, 0xFF, 0xD0, 0x0B, 0xFF, 0xE0, 0x3E, 0x41, 0xB8, 0xB8,
+    0x00, 0x3D, 0xB4, 0x00, 0x2E, 0xB4, 0x00, 0x2E, 0xB8, 0x00, 0x3E, 0x7E,
+    0x41, 0xBC, 0x1F, 0xFF, 0xF4, 0x06, 0xFF, 0x80, 0x01, 0xBF, 0x90, 0x0B,
+    0xFF, 0xF4, 0x1F, 0x81, 0xBD, 0x3D, 0x00, 0x2E, 0x3C, 0x00, 0x1F, 0x7C,
+    0x00, 0x1F, 0x3D, 0x00, 0x2E, 0x2F, 0x41, 0xBE, 0x0F, 0xFF, 0xFD, 0x02,
+    0xFE, 0xB8, 0x00, 0x01, 0xF0, 0x00, 0x07, 0xD0, 0x00, 0x0F, 0x80, 0x00,
+    0x2F, 0x00, 0x00, 0x7D, 0x00, 0x01, 0xF4, 0x00, 0x03, 0xE0, 0x00, 0x7D,
+    0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x7D, 0x7D,
+    0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x7D, 0x0D,
+    0x28, 0x30, 0x00, 0x02, 0xC0, 0x07, 0xF0, 0x1F, 0xD0, 0x7F, 0x40, 0xFD,
+    0x00, 0x2F, 0x80, 0x01, 0xBE, 0x00, 0x06, 0xF8, 0x00, 0x1F, 0xC0, 0x00,
+    0x70, 0x7F, 0xFF, 0xFD, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x7F, 0xFF, 0xFD, 0xFF, 0xFF, 0xF0, 0xD0, 0x00, 0x3F, 0x40, 0x01, 0xFD,
+    0x00, 0x07, 0xF4, 0x00, 0x1F, 0x80, 0x0B, 0xE0, 0x2F, 0x90, 0xBE, 0x40,
+    0xF9, 0x00, 0x34, 0x00, 0x00, 0x0B, 0xF8, 0x1F, 0xFF, 0xD7, 0x81, 0xB8,
+    0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0xB4, 0x00, 0xF4, 0x00,
+    0xF4, 0x00, 0xB4, 0x00, 0x2D, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0B, 0x40, 0x02, 0xD0, 0x00, 0x00, 0x0A, 0xFE, 0x40,
+    0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x02, 0xF9, 0x01, 0xBE, 0x00, 0xB8, 0x00,
+    0x00, 0xB4, 0x2E, 0x00, 0x00, 0x02, 0xC3, 0x80, 0x0B, 0xF8, 0x1D, 0xB4,
+    0x07, 0xFF, 0xC0, 0xEB, 0x01, 0xF4, 0x28, 0x0A, 0xE0, 0x3D, 0x03, 0x40,
+    0xEE, 0x07, 0x80, 0x74, 0x0E, 0xE0, 0x74, 0x0B, 0x01, 0xDB, 0x07, 0x82,
+    0xF4, 0x7C, 0xB4, 0x3F, 0xF7, 0xFF, 0x47, 0x81, 0xB9, 0x1F, 0x80, 0x2D,
+    0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xF9, 0x00, 0x5B,
+    0x40, 0x0B, 0xFF, 0xFF, 0xD0, 0x00, 0x06, 0xFF, 0x90, 0x00, 0x00, 0x07,
+    0xE0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x1F,
+    0x78, 0x00, 0x00, 0x2D, 0x3D, 0x00, 0x00, 0x7C, 0x2E, 0x00, 0x00, 0xB8,
+    0x1F, 0x00, 0x00, 0xF4, 0x0F, 0x40, 0x01, 0xF0, 0x0B, 0x80, 0x03, 0xE0,
+    0x07, 0xD0, 0x07, 0xC0, 0x02, 0xE0, 0x0B, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF,
+    0xFF, 0xF4, 0x1F, 0x00, 0x00, 0xB8, 0x3E, 0x00, 0x00, 0x7D, 0x7D, 0x00,
+    0x00, 0x2E, 0xB8, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x90, 0x3F, 0xFF, 0xFD,
+    0x0F, 0x40, 0x1F, 0xC3, 0xD0, 0x00, 0xF4, 0xF4, 0x00, 0x2E, 0x3D, 0x00,
+    0x0B, 0x8F, 0x40, 0x03, 0xD3, 0xD0, 0x07, 0xD0, 0xFF, 0xFF, 0xD0, 0x3F,
+    0xFF, 0xFD, 0x0F, 0x40, 0x07, 0xE3, 0xD0, 0x00, 0x7C, 0xF4, 0x00, 0x0F,
+    0x7D, 0x00, 0x07, 0xCF, 0x40, 0x07, 0xE3, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF,
+    0x90, 0x00, 0x00, 0x1B, 0xFA, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0xBE, 0x40,
+    0x6F, 0x47, 0xE0, 0x00, 0x04, 0x3E, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00,
+    0x0B, 0x80, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x03,
+    0xE0, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x3E,
+    0x00, 0x00, 0x00, 0xBD, 0x00, 0x01, 0x40, 0xBE, 0x40, 0x6F, 0x40, 0xBF,
+    0xFF, 0xF4, 0x00, 0x6B, 0xF9, 0x00, 0xFF, 0xFF, 0xA0, 0x03, 0xFF, 0xFF,
+    0xF8, 0x0F, 0x40, 0x06, 0xF8, 0x3D, 0x00, 0x01, 0xF8, 0xF4, 0x00, 0x01,
+    0xF3, 0xD0, 0x00, 0x03, 0xEF, 0x40, 0x00, 0x0B, 0xBD, 0x00, 0x00, 0x1F,
+    0xF4, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x0B, 0xBD,
+    0x00, 0x00, 0x3E, 0xF4, 0x00, 0x01, 0xF3, 0xD0, 0x00, 0x1F, 0x8F, 0x40,
+    0x06, 0xF8, 0x3F, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xA0, 0x00, 0xFF, 0xFF,
+    0xFB, 0xFF, 0xFF, 0xEF, 0x40, 0x00, 0x3D, 0x00, 0x00, 0xF4, 0x00, 0x03,
+    0xD0, 0x00, 0x0F, 0x40, 0x00, 0x3D, 0x00, 0x00, 0xFF, 0xFF, 0xC3, 0xFF,
+    0xFF, 0x0F, 0x40, 0x00, 0x3D, 0x00, 0x00, 0xF4, 0x00, 0x03, 0xD0, 0x00,
+    0x0F, 0x40, 0x00, 0x3F, 0xFF, 0xFE, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFB,
+    0xFF, 0xFF, 0xEF, 0x40, 0x00, 0x3D, 0x00, 0x00, 0xF4, 0x00, 0x03, 0xD0,
+    0x00, 0x0F, 0x40, 0x00, 0x3D, 0x00, 0x00, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF,
+    0x4F, 0x40, 0x00, 0x3D, 0x00, 0x00, 0xF4, 0x00, 0x03, 0xD0, 0x00, 0x0F,
+    0x40, 0x00, 0x3D, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x1B, 0xFE, 0x40,
+    0x07, 0xFF, 0xFF, 0xD0, 0xBE, 0x40, 0x5F, 0x87, 0xD0, 0x00, 0x04, 0x3E,
+    0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x3E, 0x00,
+    0x00, 0x00, 0xF4, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x3F, 0xFB, 0x80, 0x00,
+    0xFF, 0xDF, 0x00, 0x00, 0x0F, 0x3E, 0x00, 0x00, 0x3C, 0x7E, 0x00, 0x00,
+    0xF0, 0xBE, 0x40, 0x1B, 0xC0, 0x7F, 0xFF, 0xFD, 0x00, 0x1B, 0xFE, 0x40,
+    0xF4, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x1F, 0xF4, 0x00, 0x01, 0xFF, 0x40,
+    0x00, 0x1F, 0xF4, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x1F, 0xF4, 0x00, 0x01,
+    0xFF, 0x40, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4,
+    0x00, 0x01, 0xFF, 0x40, 0x00, 0x1F, 0xF4, 0x00, 0x01, 0xFF, 0x40, 0x00,
+    0x1F, 0xF4, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x1F, 0xF4, 0x00, 0x01, 0xF0,
+    0x7D, 0xF7, 0xDF, 0x7D, 0xF7, 0xDF, 0x7D, 0xF7, 0xDF, 0x7D, 0xF7, 0xDF,
+    0x7C, 0x00, 0x0B, 0x80, 0x02, 0xE0, 0x00, 0xB8, 0x00, 0x2E, 0x00, 0x0B,
+    0x80, 0x02, 0xE0, 0x00, 0xB8, 0x00, 0x2E, 0x00, 0x0B, 0x80, 0x02, 0xE0,
+    0x00, 0xB8, 0x00, 0x2E, 0x00, 0x0F, 0x40, 0x07, 0xD0, 0x07, 0xE0, 0xFF,
+    0xF0, 0x7F, 0xE0, 0x00, 0xB8, 0x00, 0x07, 0xDB, 0x80, 0x01, 0xF4, 0xB8,
+    0x00, 0x7D, 0x0B, 0x80, 0x1F, 0x40, 0xB8, 0x07, 0xD0, 0x0B, 0x81, 0xF4,
+    0x00, 0xB8, 0x7E, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0xBF, 0xFC, 0x00, 0x0B,
+    0x87, 0xF0, 0x00, 0xB8, 0x1F, 0x80, 0x0B, 0x80, 0x7E, 0x00, 0xB8, 0x01,
+    0xF4, 0x0B, 0x80, 0x0B, 0xD0, 0xB8, 0x00, 0x2F, 0x0B, 0x80, 0x00, 0xB8,
+    0xB8, 0x00, 0x03, 0xE0, 0xF4, 0x00, 0x0F, 0x40, 0x00, 0xF4, 0x00, 0x0F,
+    0x40, 0x00, 0xF4, 0x00, 0x0F, 0x40, 0x00, 0xF4, 0x00, 0x0F, 0x40, 0x00,
+    0xF4, 0x00, 0x0F, 0x40, 0x00, 0xF4, 0x00, 0x0F, 0x40, 0x00, 0xF4, 0x00,
+    0x0F, 0x40, 0x00, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xF8,
+    0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x0B,
+    0xFF, 0xF4, 0x00, 0x01, 0xFF, 0xF7, 0xC0, 0x00, 0x2D, 0xFF, 0x2E, 0x00,
+    0x07, 0x8F, 0xF0, 0xF0, 0x00, 0xF4, 0xFF, 0x0B, 0x80, 0x2E, 0x0F, 0xF0,
+    0x3D, 0x03, 0xC0, 0xFF, 0x01, 0xE0, 0xB8, 0x0F, 0xF0, 0x0F, 0x5F, 0x00,
+    0xFF, 0x00, 0x7E, 0xD0, 0x0F, 0xF0, 0x02, 0xFC, 0x00, 0xFF, 0x00, 0x1F,
+    0x40, 0x0F, 0xF0, 0x00, 0x50, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF0,
+    0x00, 0x00, 0x00, 0xF0, 0xF4, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFE,
+    0x00, 0x00, 0xFF, 0xF4, 0x00, 0x0F, 0xF7, 0xD0, 0x00, 0xFF, 0x1F, 0x00,
+    0x0F, 0xF0, 0xB8, 0x00, 0xFF, 0x03, 0xE0, 0x0F, 0xF0, 0x1F, 0x40, 0xFF,
+    0x00, 0x7C, 0x0F, 0xF0, 0x02, 0xE0, 0xFF, 0x00, 0x0B, 0x8F, 0xF0, 0x00,
+    0x3D, 0xFF, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x2F,
+    0xF0, 0x00, 0x00, 0xF0, 0x00, 0x1B, 0xFA, 0x00, 0x00, 0x7F, 0xFF, 0xF8,
+    0x00, 0xBE, 0x40, 0x6F, 0x80, 0x7D, 0x00, 0x01, 0xF8, 0x3E, 0x00, 0x00,
+    0x1F, 0x1F, 0x00, 0x00, 0x03, 0xEB, 0x80, 0x00, 0x00, 0xBE, 0xE0, 0x00,
+    0x00, 0x1F, 0xF8, 0x00, 0x00, 0x07, 0xEE, 0x00, 0x00, 0x01, 0xFB, 0x80,
+    0x00, 0x00, 0xBD, 0xF0, 0x00, 0x00, 0x3E, 0x3E, 0x00, 0x00, 0x1F, 0x47,
+    0xD0, 0x00, 0x1F, 0x80, 0xBE, 0x40, 0x6F, 0x80, 0x07, 0xFF, 0xFF, 0x80,
+    0x00, 0x1B, 0xFA, 0x00, 0x00, 0xBF, 0xFE, 0x40, 0xBF, 0xFF, 0xF4, 0xB8,
+    0x01, 0xFC, 0xB8, 0x00, 0x3D, 0xB8, 0x00, 0x2E, 0xB8, 0x00, 0x2E, 0xB8,
+    0x00, 0x2E, 0xB8, 0x00, 0x7D, 0xB8, 0x01, 0xFC, 0xBF, 0xFF, 0xF0, 0xBF,
+    0xFE, 0x40, 0xB8, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xB8,
+    0x00, 0x00, 0xB8, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x1B, 0xFA, 0x00,
+    0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x0B, 0xE4, 0x06, 0xF8, 0x01, 0xF4, 0x00,
+    0x07, 0xE0, 0x3E, 0x00, 0x00, 0x1F, 0x07, 0xC0, 0x00, 0x00, 0xF8, 0xB8,
+    0x00, 0x00, 0x0B, 0xCB, 0x80, 0x00, 0x00, 0x7C, 0xF8, 0x00, 0x00, 0x07,
+    0xCB, 0x80, 0x00, 0x00, 0x7C, 0xB8, 0x00, 0x00, 0x0B, 0x87, 0xC0, 0x00,
+    0x00, 0xF8, 0x3E, 0x00, 0x00, 0x1F, 0x01, 0xF4, 0x00, 0x07, 0xE0, 0x0B,
+    0xE4, 0x06, 0xF8, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x1B, 0xFA, 0xF4,
+    0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00,
+    0x00, 0xBC, 0x00, 0x00, 0x00, 0x01, 0x90, 0xBF, 0xFE, 0x40, 0x2F, 0xFF,
+    0xFD, 0x0B, 0x80, 0x1F, 0xC2, 0xE0, 0x00, 0xF4, 0xB8, 0x00, 0x2D, 0x2E,
+    0x00, 0x0F, 0x4B, 0x80, 0x07, 0xC2, 0xE0, 0x17, 0xE0, 0xBF, 0xFF, 0xE0,
+    0x2F, 0xFF, 0x80, 0x0B, 0x82, 0xF4, 0x02, 0xE0, 0x2F, 0x00, 0xB8, 0x03,
+    0xE0, 0x2E, 0x00, 0x7D, 0x0B, 0x80, 0x07, 0xD2, 0xE0, 0x00, 0xBC, 0xB8,
+    0x00, 0x0F, 0x80, 0x02, 0xFE, 0x40, 0x7F, 0xFF, 0xC3, 0xE4, 0x1B, 0x1F,
+    0x00, 0x00, 0xB8, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xE4, 0x00, 0x07, 0xFE,
+    0x40, 0x02, 0xFF, 0x80, 0x00, 0x6F, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x1E,
+    0x00, 0x00, 0x79, 0x40, 0x02, 0xEF, 0x90, 0x6F, 0x1F, 0xFF, 0xF4, 0x0A,
+    0xFE, 0x00, 0xBF, 0xFF, 0xFF, 0xEB, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0x40,
+    0x00, 0x00, 0xF4, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xF4, 0x00, 0x00,
+    0x0F, 0x40, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xF4,
+    0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x0F, 0x40, 0x00,
+    0x00, 0xF4, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x0F,
+    0x40, 0x00, 0xF4, 0x00, 0x02, 0xEF, 0x40, 0x00, 0x2E, 0xF4, 0x00, 0x02,
+    0xEF, 0x40, 0x00, 0x2E, 0xF4, 0x00, 0x02, 0xEF, 0x40, 0x00, 0x2E, 0xF4,
+    0x00, 0x02, 0xEF, 0x40, 0x00, 0x2E, 0xF4, 0x00, 0x02, 0xEF, 0x40, 0x00,
+    0x2E, 0xF4, 0x00, 0x02, 0xEF, 0x40, 0x00, 0x3D, 0xB8, 0x00, 0x07, 0xD7,
+    0xD0, 0x00, 0xBC, 0x2F, 0x90, 0x6F, 0x40, 0xBF, 0xFF, 0xD0, 0x01, 0xBF,
+    0xA0, 0x00, 0xB8, 0x00, 0x00, 0x1F, 0x7C, 0x00, 0x00, 0x3E, 0x3E, 0x00,
+    0x00, 0x7D, 0x1F, 0x00, 0x00, 0xB8, 0x0F, 0x40, 0x00, 0xF4, 0x0B, 0x80,
+    0x01, 0xF0, 0x07, 0xC0, 0x03, 0xE0, 0x02, 0xE0, 0x07, 0xC0, 0x01, 0xF0,
+    0x0B, 0x80, 0x00, 0xF4, 0x0F, 0x40, 0x00, 0xB8, 0x1F, 0x00, 0x00, 0x3D,
+    0x3D, 0x00, 0x00, 0x2E, 0x7C, 0x00, 0x00, 0x1F, 0xB8, 0x00, 0x00, 0x0F,
+    0xF4, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0xB8, 0x00,
+    0x02, 0xD0, 0x00, 0x1F, 0x7D, 0x00, 0x03, 0xE0, 0x00, 0x2E, 0x3D, 0x00,
+    0x0B, 0xF0, 0x00, 0x3D, 0x2E, 0x00, 0x0F, 0xB4, 0x00, 0x7D, 0x1F, 0x00,
+    0x1F, 0x78, 0x00, 0xBC, 0x0F, 0x40, 0x2E, 0x3C, 0x00, 0xB8, 0x0B, 0x80,
+    0x3C, 0x2D, 0x00, 0xF4, 0x07, 0xC0, 0x78, 0x1E, 0x01, 0xF0, 0x03, 0xD0,
+    0xB4, 0x0F, 0x02, 0xE0, 0x03, 0xE0, 0xF0, 0x0B, 0x43, 0xD0, 0x02, 0xF1,
+    0xE0, 0x07, 0x87, 0xC0, 0x01, 0xF6, 0xD0, 0x03, 0xCB, 0x80, 0x00, 0xF7,
+    0xC0, 0x02, 0xDF, 0x40, 0x00, 0xBF, 0x80, 0x01, 0xFF, 0x00, 0x00, 0x7F,
+    0x40, 0x00, 0xFE, 0x00, 0x00, 0x3F, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x2E,
+    0x00, 0x00, 0x7C, 0x00, 0x7D, 0x00, 0x00, 0xB8, 0xBC, 0x00, 0x07, 0xC0,
+    0xF8, 0x00, 0x7D, 0x01, 0xF4, 0x02, 0xE0, 0x02, 0xF0, 0x1F, 0x00, 0x02,
+    0xE1, 0xF4, 0x00, 0x03, 0xDB, 0x40, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x0F,
+    0xE0, 0x00, 0x00, 0xBB, 0xD0, 0x00, 0x07, 0xCB, 0xC0, 0x00, 0x3D, 0x0F,
+    0x80, 0x02, 0xE0, 0x1F, 0x40, 0x1F, 0x00, 0x2F, 0x00, 0xF4, 0x00, 0x3E,
+    0x0B, 0x80, 0x00, 0x7D, 0x7C, 0x00, 0x00, 0xBC, 0xB8, 0x00, 0x00, 0xB8,
+    0xF8, 0x00, 0x07, 0xC1, 0xF0, 0x00, 0x3D, 0x02, 0xE0, 0x02, 0xF0, 0x03,
+    0xD0, 0x1F, 0x40, 0x0B, 0xC0, 0xB8, 0x00, 0x0F, 0x47, 0xC0, 0x00, 0x1F,
+    0x3D, 0x00, 0x00, 0x2E, 0xE0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xB8,
+    0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x2E, 0x00,
+    0x00, 0x00, 0xB8, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x0B, 0x80, 0x00,
+    0xBF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xE0, 0x00, 0x01, 0xF4, 0x00, 0x00,
+    0xF4, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x7D, 0x00, 0x00,
+    0x3E, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x40, 0x00,
+    0x0F, 0x80, 0x00, 0x0B, 0xC0, 0x00, 0x07, 0xD0, 0x00, 0x03, 0xD0, 0x00,
+    0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xDF, 0xF7, 0x81,
+    0xE0, 0x78, 0x1E, 0x07, 0x81, 0xE0, 0x78, 0x1E, 0x07, 0x81, 0xE0, 0x78,
+    0x1E, 0x07, 0x81, 0xE0, 0x78, 0x1E, 0x07, 0x81, 0xE0, 0x7F, 0xDF, 0xF0,
+    0xE0, 0x00, 0x2C, 0x00, 0x07, 0x80, 0x00, 0xB0, 0x00, 0x1D, 0x00, 0x03,
+    0x80, 0x00, 0xB4, 0x00, 0x0E, 0x00, 0x02, 0xC0, 0x00, 0x74, 0x00, 0x0F,
+    0x00, 0x01, 0xD0, 0x00, 0x38, 0x00, 0x0B, 0x00, 0x01, 0xE0, 0x00, 0x2C,
+    0x00, 0x07, 0x40, 0x00, 0xA0, 0xFF, 0xAF, 0xE0, 0x78, 0x1E, 0x07, 0x81,
+    0xE0, 0x78, 0x1E, 0x07, 0x81, 0xE0, 0x78, 0x1E, 0x07, 0x81, 0xE0, 0x78,
+    0x1E, 0x07, 0x81, 0xE0, 0x78, 0x1E, 0xBF, 0xBF, 0xE0, 0x00, 0xF0, 0x00,
+    0x2F, 0x40, 0x07, 0xBC, 0x00, 0xB5, 0xE0, 0x1E, 0x0B, 0x43, 0xC0, 0x78,
+    0xB4, 0x02, 0xD5, 0x00, 0x05, 0xFF, 0xFF, 0xDF, 0xFF, 0xFD, 0x7D, 0x07,
+    0xC0, 0x78, 0x05, 0x06, 0xFE, 0x02, 0xFF, 0xF8, 0x39, 0x07, 0xD0, 0x00,
+    0x2E, 0x00, 0x01, 0xE0, 0x2B, 0xFE, 0x2F, 0xFF, 0xEB, 0xD4, 0x1E, 0xF4,
+    0x01, 0xEB, 0x80, 0xBE, 0x7F, 0xFD, 0xE1, 0xFE, 0x0E, 0x7C, 0x00, 0x00,
+    0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00,
+    0x7C, 0x6F, 0x90, 0x7D, 0xFF, 0xF4, 0x7F, 0x41, 0xFC, 0x7D, 0x00, 0x3D,
+    0x7C, 0x00, 0x2D, 0x7C, 0x00, 0x2E, 0x7C, 0x00, 0x2E, 0x7C, 0x00, 0x3D,
+    0x7C, 0x00, 0x7C, 0x7E, 0x41, 0xF8, 0x7A, 0xFF, 0xE0, 0x78, 0xBF, 0x40,
+    0x06, 0xFE, 0x01, 0xFF, 0xFD, 0x7E, 0x41, 0x8B, 0x80, 0x00, 0xF4, 0x00,
+    0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x40, 0x00, 0xB8, 0x00, 0x07, 0xE4,
+    0x1D, 0x1F, 0xFF, 0xD0, 0x6F, 0xE0, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xE0,
+    0x00, 0x0B, 0x80, 0x00, 0x2E, 0x00, 0x00, 0xB8, 0x1B, 0xE6, 0xE1, 0xFF,
+    0xFB, 0x9F, 0x80, 0xBE, 0xB8, 0x00, 0xBB, 0xD0, 0x02, 0xEF, 0x00, 0x0B,
+    0xBC, 0x00, 0x2E, 0xF4, 0x00, 0xBA, 0xE0, 0x02, 0xE7, 0xD0, 0x6F, 0x8B,
+    0xFF, 0x9E, 0x0B, 0xF4, 0x78, 0x06, 0xFE, 0x40, 0x7F, 0xFF, 0x47, 0xD0,
+    0x1F, 0x2D, 0x00, 0x1D, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xEF, 0x00, 0x00,
+    0x3D, 0x00, 0x00, 0xB8, 0x00, 0x01, 0xF9, 0x06, 0xD1, 0xFF, 0xFE, 0x00,
+    0xBF, 0x90, 0x00, 0xBE, 0x03, 0xFE, 0x0B, 0xD0, 0x0B, 0x40, 0x0B, 0x40,
+    0xBF, 0xFE, 0x7F, 0xFE, 0x0B, 0x40, 0x0B, 0x40, 0x0B, 0x40, 0x0B, 0x40,
+    0x0B, 0x40, 0x0B, 0x40, 0x0B, 0x40, 0x0B, 0x40, 0x0B, 0x40, 0x0B, 0x40,
+    0x01, 0xFF, 0xFF, 0x0B, 0xFF, 0xFE, 0x1F, 0x41, 0xF4, 0x2D, 0x00, 0xB4,
+    0x2D, 0x00, 0xB4, 0x1F, 0x41, 0xF0, 0x0B, 0xFF, 0xE0, 0x07, 0xBE, 0x40,
+    0x1E, 0x00, 0x00, 0x1F, 0xFF, 0xE4, 0x0B, 0xFF, 0xFD, 0x3C, 0x00, 0x6E,
+    0x78, 0x00, 0x1E, 0x7D, 0x00, 0x7C, 0x2F, 0xFF, 0xF4, 0x06, 0xFF, 0x80,
+    0x7C, 0x00, 0x01, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0x7C,
+    0x00, 0x01, 0xF1, 0xBE, 0x07, 0xDF, 0xFF, 0x1F, 0xD0, 0x7E, 0x7D, 0x00,
+    0xB9, 0xF0, 0x01, 0xF7, 0xC0, 0x07, 0xDF, 0x00, 0x1F, 0x7C, 0x00, 0x7D,
+    0xF0, 0x01, 0xF7, 0xC0, 0x07, 0xDF, 0x00, 0x1F, 0x7C, 0x00, 0x7C, 0x7D,
+    0x7D, 0x00, 0x00, 0x00, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C,
+    0x3C, 0x3C, 0x3C, 0x3C, 0x07, 0xD0, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0,
+    0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x07, 0xCB, 0xF8, 0xBE, 0x00,
+    0x7C, 0x00, 0x01, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0x7C,
+    0x00, 0x01, 0xF0, 0x02, 0xD7, 0xC0, 0x2E, 0x1F, 0x02, 0xE0, 0x7C, 0x2E,
+    0x01, 0xF2, 0xF0, 0x07, 0xFF, 0x00, 0x1F, 0xFE, 0x00, 0x7C, 0x7D, 0x01,
+    0xF0, 0x7D, 0x07, 0xC0, 0xBC, 0x1F, 0x00, 0xBC, 0x7C, 0x00, 0xB8, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x74, 0x7E, 0x02, 0xF9,
+    0x07, 0xAF, 0xF8, 0xFF, 0xF4, 0x7F, 0x47, 0xED, 0x0B, 0xC7, 0xC0, 0x1F,
+    0x40, 0x3C, 0x7C, 0x00, 0xF0, 0x03, 0xD7, 0xC0, 0x0F, 0x00, 0x3D, 0x7C,
+    0x00, 0xF0, 0x03, 0xD7, 0xC0, 0x0F, 0x00, 0x3D, 0x7C, 0x00, 0xF0, 0x03,
+    0xD7, 0xC0, 0x0F, 0x00, 0x3D, 0x7C, 0x00, 0xF0, 0x03, 0xD7, 0xC0, 0x0F,
+    0x00, 0x3D, 0x78, 0x6F, 0x81, 0xE7, 0xFF, 0xC7, 0xF4, 0x1F, 0x9F, 0x40,
+    0x2E, 0x7C, 0x00, 0x7D, 0xF0, 0x01, 0xF7, 0xC0, 0x07, 0xDF, 0x00, 0x1F,
+    0x7C, 0x00, 0x7D, 0xF0, 0x01, 0xF7, 0xC0, 0x07, 0xDF, 0x00, 0x1F, 0x06,
+    0xFE, 0x40, 0x1F, 0xFF, 0xE0, 0x7E, 0x41, 0xF8, 0xB8, 0x00, 0x7C, 0xF4,
+    0x00, 0x3D, 0xF0, 0x00, 0x2D, 0xF0, 0x00, 0x2D, 0xF4, 0x00, 0x3D, 0xB8,
+    0x00, 0x7C, 0x7E, 0x01, 0xF8, 0x1F, 0xFF, 0xE0, 0x06, 0xFE, 0x40, 0x78,
+    0x6F, 0x90, 0x79, 0xFF, 0xF4, 0x7F, 0x41, 0xF8, 0x7C, 0x00, 0x7C, 0x7C,
+    0x00, 0x3D, 0x7C, 0x00, 0x2D, 0x7C, 0x00, 0x2D, 0x7C, 0x00, 0x3D, 0x7C,
+    0x00, 0x7C, 0x7E, 0x41, 0xF8, 0x7F, 0xFF, 0xE0, 0x7C, 0xBE, 0x40, 0x7C,
+    0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x06,
+    0xF9, 0x78, 0x7F, 0xFE, 0xE7, 0xE0, 0x2F, 0xAE, 0x00, 0x2E, 0xF4, 0x00,
+    0xBB, 0xC0, 0x02, 0xEF, 0x00, 0x0B, 0xBD, 0x00, 0x2E, 0xB8, 0x00, 0xB9,
+    0xF4, 0x1B, 0xE2, 0xFF, 0xEB, 0x82, 0xFD, 0x2E, 0x00, 0x00, 0xB8, 0x00,
+    0x02, 0xE0, 0x00, 0x0B, 0x80, 0x00, 0x2E, 0x78, 0x7F, 0x7A, 0xFF, 0x7F,
+    0x40, 0x7D, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0x7C,
+    0x00, 0x7C, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0x1B, 0xF8, 0x1F, 0xFF, 0x8B,
+    0x80, 0x63, 0xC0, 0x00, 0xB8, 0x00, 0x0B, 0xE4, 0x00, 0x1B, 0xD0, 0x00,
+    0x3D, 0x00, 0x0B, 0x69, 0x07, 0xDB, 0xFF, 0xE0, 0x6F, 0x90, 0x03, 0x80,
+    0x03, 0x80, 0x07, 0x80, 0x07, 0x80, 0x6F, 0xFF, 0x7F, 0xFF, 0x0B, 0x80,
+    0x0B, 0x80, 0x0B, 0x80, 0x0B, 0x80, 0x0B, 0x80, 0x0B, 0x80, 0x0B, 0x80,
+    0x07, 0xC1, 0x07, 0xFF, 0x01, 0xFD, 0xB8, 0x00, 0xBA, 0xE0, 0x02, 0xEB,
+    0x80, 0x0B, 0xAE, 0x00, 0x2E, 0xB8, 0x00, 0xBA, 0xE0, 0x02, 0xEB, 0x80,
+    0x0B, 0xAE, 0x00, 0x2E, 0x78, 0x00, 0xB9, 0xF8, 0x1B, 0xE2, 0xFF, 0xE7,
+    0x81, 0xFE, 0x1E, 0xB8, 0x00, 0x1F, 0x3C, 0x00, 0x2D, 0x2D, 0x00, 0x3C,
+    0x1F, 0x00, 0x78, 0x0F, 0x40, 0xF4, 0x0B, 0x81, 0xE0, 0x03, 0xC2, 0xD0,
+    0x02, 0xD3, 0xC0, 0x01, 0xE7, 0x80, 0x00, 0xFB, 0x00, 0x00, 0x7E, 0x00,
+    0x00, 0x3D, 0x00, 0xB4, 0x00, 0xB4, 0x00, 0xF7, 0xC0, 0x0F, 0x80, 0x1E,
+    0x3C, 0x01, 0xFC, 0x02, 0xD2, 0xD0, 0x2E, 0xD0, 0x3C, 0x1E, 0x03, 0x9E,
+    0x07, 0x80, 0xF0, 0x74, 0xF0, 0xB4, 0x0B, 0x4B, 0x0B, 0x4F, 0x00, 0x78,
+    0xE0, 0x78, 0xE0, 0x03, 0xDD, 0x03, 0xDD, 0x00, 0x2F, 0xC0, 0x2F, 0xC0,
+    0x01, 0xF8, 0x01, 0xF8, 0x00, 0x0F, 0x40, 0x0F, 0x40, 0x7D, 0x00, 0x3D,
+    0x1F, 0x00, 0xB8, 0x0B, 0x81, 0xE0, 0x03, 0xD3, 0xC0, 0x01, 0xEB, 0x40,
+    0x00, 0xBE, 0x00, 0x00, 0xBF, 0x00, 0x02, 0xEB, 0x80, 0x07, 0xC3, 0xD0,
+    0x0F, 0x41, 0xF0, 0x2E, 0x00, 0xB8, 0x7C, 0x00, 0x3D, 0xB8, 0x00, 0x1F,
+    0x7C, 0x00, 0x2D, 0x2E, 0x00, 0x3C, 0x1F, 0x00, 0xB8, 0x0B, 0x40, 0xF0,
+    0x07, 0xC1, 0xE0, 0x03, 0xD2, 0xD0, 0x02, 0xE7, 0x80, 0x00, 0xFB, 0x40,
+    0x00, 0xBF, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x78, 0x00,
+    0x00, 0xF4, 0x00, 0x01, 0xE0, 0x00, 0x02, 0xD0, 0x00, 0xBF, 0xFF, 0xDB,
+    0xFF, 0xFC, 0x00, 0x0B, 0x40, 0x01, 0xD0, 0x00, 0x78, 0x00, 0x0F, 0x00,
+    0x02, 0xC0, 0x00, 0xB4, 0x00, 0x1E, 0x00, 0x07, 0x80, 0x00, 0xFF, 0xFF,
+    0xCF, 0xFF, 0xFC, 0x02, 0xF0, 0xBF, 0x1F, 0x41, 0xE0, 0x1D, 0x01, 0xE0,
+    0x0E, 0x00, 0xF0, 0x0F, 0x01, 0xE0, 0x7D, 0x07, 0xD0, 0x1E, 0x00, 0xF0,
+    0x0F, 0x00, 0xE0, 0x1E, 0x01, 0xD0, 0x1E, 0x01, 0xF4, 0x0B, 0xF0, 0x2F,
+    0x75, 0xD7, 0x5D, 0x75, 0xD7, 0x5D, 0x75, 0xD7, 0x5D, 0x75, 0xD7, 0x5D,
+    0x75, 0xD7, 0x5D, 0x75, 0xD0, 0xF8, 0x0F, 0xF0, 0x0B, 0x40, 0x78, 0x07,
+    0x80, 0x74, 0x0B, 0x40, 0xB0, 0x0B, 0x00, 0xB8, 0x02, 0xE0, 0x2E, 0x0B,
+    0x80, 0xB0, 0x0B, 0x00, 0xB4, 0x07, 0x40, 0x78, 0x07, 0x80, 0xB4, 0xFF,
+    0x0F, 0x80, 0x00, 0x00, 0x09, 0x1B, 0xE4, 0x2D, 0x3F, 0xFF, 0xFC, 0x78,
+    0x1B, 0xE0, 0x60, 0x00, 0x00 };
+
+const GFXglyph Lato12pt2bGlyphs[] = {
+    {0, 0, 0, 5, 0, 0}, // 0x20 ' '
+    {0, 4, 17, 8, 2, -17}, // 0x21 '!'
+    {17, 7, 6, 10, 1, -17}, // 0x22 '"'
+    {28, 14, 17, 14, 0, -17}, // 0x23 '#'
+    {88, 12, 22, 14, 1, -19}, // 0x24 '$'
+    {154, 17, 17, 19, 1, -17}, // 0x25 '%'
+    {227, 16, 17, 17, 1, -17}, // 0x26 '&'
+    {295, 3, 6, 6, 1, -17}, // 0x27 '\x27'
+    {300, 5, 23, 7, 1, -19}, // 0x28 '('
+    {329, 5, 22, 7, 1, -19}, // 0x29 ')'
+    {357, 8, 8, 10, 1, -17}, // 0x2A '*'
+    {373, 12, 12, 14, 1, -14}, // 0x2B '+'
+    {409, 3, 5, 5, 1, -2}, // 0x2C ','
+    {413, 6, 2, 8, 1, -8}, // 0x2D '-'
+    {416, 3, 2, 5, 1, -2}, // 0x2E '.'
+    {418, 9, 18, 9, 0, -17}, // 0x2F '/'
+    {459, 14, 17, 14, 0, -17}, // 0x30 '0'
+    {519, 11, 17, 14, 2, -17}, // 0x31 '1'
+    {566, 12, 17, 14, 1, -17}, // 0x32 '2'
+    {617, 12, 17, 14, 1, -17}, // 0x33 '3'
+    {668, 14, 17, 14, 0, -17}, // 0x34 '4'
+    {728, 12, 17, 14, 1, -17}, // 0x35 '5'
+    {779, 12, 17, 14, 1, -17}, // 0x36 '6'
+    {830, 12, 17, 14, 1, -17}, // 0x37 '7'
+    {881, 12, 17, 14, 1, -17}, // 0x38 '8'
+    {932, 12, 17, 14, 1, -17}, // 0x39 '9'
+    {983, 4, 12, 6, 1, -12}, // 0x3A ':'
+    {995, 4, 15, 6, 1, -12}, // 0x3B ';'
+    {1010, 9, 10, 14, 2, -13}, // 0x3C '<'
+    {1033, 11, 6, 14, 1, -11}, // 0x3D '='
+    {1050, 9, 10, 14, 3, -13}, // 0x3E '>'
+    {1073, 9, 17, 10, 0, -17}, // 0x3F '?'
+    {1112, 18, 19, 20, 1, -16}, // 0x40 '@'
+    {1198, 16, 17, 16, 0, -17}, // 0x41 'A'
+    {1266, 13, 17, 16, 2, -17}, // 0x42 'B'
+    {1322, 15, 17, 16, 1, -17}, // 0x43 'C'
+    {1386, 15, 17, 18, 2, -17}, // 0x44 'D'
+    {1450, 11, 17, 14, 2, -17}, // 0x45 'E'
+    {1497, 11, 17, 14, 2, -17}, // 0x46 'F'
+    {1544, 15, 17, 18, 1, -17}, // 0x47 'G'
+    {1608, 14, 17, 18, 2, -17}, // 0x48 'H'
+    {1668, 3, 17, 7, 2, -17}, // 0x49 'I'
+    {1681, 9, 17, 11, 0, -17}, // 0x4A 'J'
+    {1720, 14, 17, 16, 2, -17}, // 0x4B 'K'
+    {1780, 10, 17, 12, 2, -17}, // 0x4C 'L'
+    {1823, 18, 17, 22, 2, -17}, // 0x4D 'M'
+    {1900, 14, 17, 18, 2, -17}, // 0x4E 'N'
+    {1960, 17, 17, 19, 1, -17}, // 0x4F 'O'
+    {2033, 12, 17, 15, 2, -17}, // 0x50 'P'
+    {2084, 18, 21, 19, 1, -17}, // 0x51 'Q'
+    {2179, 13, 17, 15, 2, -17}, // 0x52 'R'
+    {2235, 11, 17, 13, 1, -17}, // 0x53 'S'
+    {2282, 14, 17, 14, 0, -17}, // 0x54 'T'
+    {2342, 14, 17, 18, 2, -17}, // 0x55 'U'
+    {2402, 16, 17, 16, 0, -17}, // 0x56 'V'
+    {2470, 24, 17, 24, 0, -17}, // 0x57 'W'
+    {2572, 15, 17, 15, 0, -17}, // 0x58 'X'
+    {2636, 15, 17, 15, 0, -17}, // 0x59 'Y'
+    {2700, 13, 17, 15, 1, -17}, // 0x5A 'Z'
+    {2756, 5, 22, 7, 1, -19}, // 0x5B '['
+    {2784, 9, 18, 9, 0, -17}, // 0x5C '\x5C'
+    {2825, 5, 22, 7, 1, -19}, // 0x5D ']'
+    {2853, 10, 8, 14, 2, -17}, // 0x5E '^'
+    {2873, 10, 2, 9, 0, 1}, // 0x5F '_'
+    {2878, 5, 4, 7, 0, -17}, // 0x60 '`'
+    {2883, 10, 12, 12, 1, -12}, // 0x61 'a'
+    {2913, 12, 17, 13, 1, -17}, // 0x62 'b'
+    {2964, 10, 12, 11, 1, -12}, // 0x63 'c'
+    {2994, 11, 17, 13, 1, -17}, // 0x64 'd'
+    {3041, 11, 12, 13, 1, -12}, // 0x65 'e'
+    {3074, 8, 17, 8, 0, -17}, // 0x66 'f'
+    {3108, 12, 16, 12, 0, -12}, // 0x67 'g'
+    {3156, 11, 17, 13, 1, -17}, // 0x68 'h'
+    {3203, 4, 17, 6, 1, -17}, // 0x69 'i'
+    {3220, 6, 21, 6, -1, -17}, // 0x6A 'j'
+    {3252, 11, 17, 13, 1, -17}, // 0x6B 'k'
+    {3299, 2, 17, 6, 2, -17}, // 0x6C 'l'
+    {3308, 18, 12, 20, 1, -12}, // 0x6D 'm'
+    {3362, 11, 12, 13, 1, -12}, // 0x6E 'n'
+    {3395, 12, 12, 13, 1, -12}, // 0x6F 'o'
+    {3431, 12, 16, 13, 1, -12}, // 0x70 'p'
+    {3479, 11, 16, 13, 1, -12}, // 0x71 'q'
+    {3523, 8, 12, 10, 1, -12}, // 0x72 'r'
+    {3547, 9, 12, 10, 1, -12}, // 0x73 's'
+    {3574, 8, 16, 9, 0, -16}, // 0x74 't'
+    {3606, 11, 12, 13, 1, -12}, // 0x75 'u'
+    {3639, 12, 12, 12, 0, -12}, // 0x76 'v'
+    {3675, 18, 12, 18, 0, -12}, // 0x77 'w'
+    {3729, 12, 12, 12, 0, -12}, // 0x78 'x'
+    {3765, 12, 16, 12, 0, -12}, // 0x79 'y'
+    {3813, 10, 12, 11, 1, -12}, // 0x7A 'z'
+    {3843, 6, 22, 7, 0, -19}, // 0x7B '{'
+    {3876, 3, 22, 7, 2, -18}, // 0x7C '|'
+    {3893, 6, 22, 7, 1, -19}, // 0x7D '}'
+    {3926, 12, 5, 14, 1, -9}}; // 0x7E '~'
+
+const LCD_AAFont Lato12pt2b = { Lato12pt2bBitmaps, Lato12pt2bGlyphs, 0x20, 0x7E, 30, 2 };
+
+// Approx. 4618 bytes
@@ -0,0 +1,592 @@
+// Lato-Regular.ttf 12 pt, 1-bit coverage, 0x20 to 0x7E, 0xA0 to 0xFF, 0x2022, 0x20AC (generated by fontconv.py)
+// Lato, Copyright (c) 2010-2014 Lukasz Dziedzic, SIL Open Font License 1.1
+// LatoLatin12pt, 193 of 193 glyphs, 80 packed (generated by fontpack.py)
+
+const uint8_t LatoLatin12ptBitmaps[] = {
+    0xDB, 0x6D, 0xB6, 0xDB, 0x00, 0x06, 0xE0, 0xCF, 0x3C, 0xF3, 0xCE, 0x20,
+    0x0C, 0x60, 0xC4, 0x0C, 0xC0, 0x8C, 0x18, 0xCF, 0xFF, 0xFF, 0xF1, 0x88,
+    0x11, 0x83, 0x18, 0xFF, 0xEF, 0xFE, 0x31, 0x02, 0x30, 0x63, 0x06, 0x30,
+    0x63, 0x00, 0x03, 0x00, 0x30, 0x0F, 0x83, 0xFE, 0x32, 0x66, 0x20, 0x62,
+    0x06, 0x20, 0x72, 0x03, 0xE0, 0x0F, 0xC0, 0x3E, 0x06, 0x70, 0x63, 0x06,
+    0x30, 0x66, 0xE6, 0x67, 0xFC, 0x1F, 0x80, 0x40, 0x04, 0x00, 0x40, 0x3C,
+    0x07, 0x3F, 0x03, 0x31, 0x83, 0x18, 0x43, 0x0C, 0x23, 0x06, 0x11, 0x83,
+    0x19, 0x80, 0xFD, 0x80, 0x39, 0x80, 0x00, 0xCF, 0x00, 0xCF, 0xC0, 0xC6,
+    0x30, 0xC6, 0x18, 0x63, 0x0C, 0x60, 0xC6, 0x60, 0x7E, 0x60, 0x1E, 0x00,
+    0x07, 0x80, 0x1F, 0xC0, 0x18, 0xE0, 0x30, 0x60, 0x30, 0x00, 0x18, 0x00,
+    0x18, 0x00, 0x0C, 0x00, 0x36, 0x0C, 0x63, 0x8C, 0xE1, 0xC8, 0xC0, 0xF8,
+    0xC0, 0x78, 0xE0, 0x38, 0x70, 0xFC, 0x7F, 0xCC, 0x1F, 0x07, 0xFF, 0xE0,
+    0x13, 0x66, 0x6C, 0xCC, 0xC8, 0x88, 0xCC, 0xCC, 0xC6, 0x63, 0x30, 0xCC,
+    0x66, 0x63, 0x33, 0x31, 0x11, 0x33, 0x33, 0x36, 0x6C, 0xC0, 0x10, 0x23,
+    0x59, 0xE3, 0xDA, 0xE4, 0x88, 0x52, 0x5F, 0x30, 0xCF, 0x05, 0x25, 0xF3,
+    0xFC, 0xAC, 0xFF, 0xF0, 0xFC, 0x01, 0x80, 0x80, 0xC0, 0x60, 0x60, 0x30,
+    0x10, 0x18, 0x0C, 0x0C, 0x06, 0x02, 0x03, 0x01, 0x01, 0x80, 0xC0, 0xC0,
+    0x60, 0x00, 0x35, 0x42, 0x82, 0x13, 0x43, 0x11, 0x26, 0x21, 0x03, 0x63,
+    0x02, 0x82, 0xF5, 0x03, 0x63, 0x12, 0x62, 0x11, 0x34, 0x31, 0x28, 0x23,
+    0x54, 0x52, 0x44, 0x34, 0x34, 0x41, 0x31, 0x24, 0x03, 0x22, 0x45, 0x24,
+    0xF8, 0x1A, 0xF0, 0x0F, 0x83, 0xFC, 0x70, 0xE6, 0x06, 0x60, 0x60, 0x06,
+    0x00, 0x60, 0x0E, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80,
+    0x30, 0x07, 0xFF, 0xFF, 0xF0, 0x0F, 0x83, 0xFC, 0x30, 0xE6, 0x06, 0x60,
+    0x60, 0x06, 0x00, 0xE0, 0x78, 0x07, 0xC0, 0x0E, 0x00, 0x70, 0x03, 0xC0,
+    0x36, 0x07, 0x70, 0xE3, 0xFC, 0x1F, 0x80, 0x83, 0x2F, 0x07, 0x42, 0x62,
+    0x12, 0x2F, 0x05, 0x22, 0x22, 0x42, 0x32, 0x23, 0x24, 0x22, 0xF0, 0x22,
+    0x52, 0x21, 0x26, 0x22, 0x0D, 0x1C, 0x92, 0x2F, 0x20, 0x29, 0xF0, 0x22,
+    0x7F, 0x12, 0x18, 0x17, 0x31, 0x91, 0x83, 0x92, 0xF2, 0x83, 0x03, 0x43,
+    0x11, 0x82, 0x26, 0x30, 0x01, 0xC0, 0x38, 0x07, 0x00, 0xE0, 0x0C, 0x01,
+    0x80, 0x37, 0x83, 0xFE, 0x70, 0xE6, 0x07, 0xC0, 0x3C, 0x03, 0xC0, 0x36,
+    0x06, 0x70, 0xE3, 0xFC, 0x1F, 0x80, 0x0C, 0xF0, 0x93, 0x92, 0x18, 0x31,
+    0x82, 0x27, 0x32, 0x72, 0x36, 0x33, 0x62, 0x45, 0x34, 0x52, 0x54, 0x35,
+    0x42, 0x63, 0x36, 0x32, 0x72, 0x28, 0x1F, 0x83, 0xFC, 0x70, 0xE6, 0x06,
+    0x60, 0x66, 0x06, 0x70, 0xC3, 0xF8, 0x3F, 0xC7, 0x0E, 0xE0, 0x6C, 0x07,
+    0xC0, 0x7E, 0x07, 0x70, 0xE3, 0xFC, 0x1F, 0x80, 0x1F, 0x0F, 0xF1, 0x87,
+    0x60, 0x7C, 0x07, 0x80, 0xF0, 0x3F, 0x0F, 0x7F, 0xC7, 0xF8, 0x06, 0x01,
+    0x80, 0x70, 0x1C, 0x03, 0x00, 0xC0, 0x38, 0x00, 0xDC, 0x00, 0x00, 0x03,
+    0x70, 0xDC, 0x00, 0x00, 0x03, 0x75, 0xA0, 0x00, 0x81, 0xC3, 0xC7, 0x8F,
+    0x07, 0x00, 0xE0, 0x1C, 0x03, 0x80, 0x40, 0x0A, 0xF0, 0xAF, 0x00, 0xAF,
+    0x00, 0x80, 0x70, 0x1E, 0x03, 0xC0, 0x78, 0x1C, 0x38, 0x70, 0xE0, 0x40,
+    0x00, 0x3E, 0x3F, 0xB8, 0xE0, 0x30, 0x18, 0x0C, 0x0C, 0x0E, 0x0C, 0x0C,
+    0x06, 0x01, 0x00, 0x00, 0x00, 0x00, 0x38, 0x1C, 0x00, 0x03, 0xF0, 0x03,
+    0xFF, 0x01, 0xE0, 0xF0, 0xE0, 0x0C, 0x60, 0x01, 0x98, 0x3E, 0x2C, 0x1F,
+    0x8F, 0x0C, 0x63, 0xC6, 0x10, 0xF1, 0x04, 0x3C, 0x43, 0x0B, 0x19, 0xC6,
+    0xC7, 0xDF, 0x18, 0xE3, 0x86, 0x00, 0x00, 0xE0, 0x00, 0x1E, 0x03, 0x03,
+    0xFF, 0x80, 0x3F, 0x80, 0x01, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xE0,
+    0x06, 0x60, 0x06, 0x70, 0x0E, 0x30, 0x0C, 0x30, 0x0C, 0x38, 0x1C, 0x18,
+    0x18, 0x1C, 0x3F, 0xFC, 0x3F, 0xFC, 0x30, 0x0E, 0x70, 0x06, 0x60, 0x07,
+    0xE0, 0x03, 0xFF, 0x8F, 0xFC, 0xC0, 0xEC, 0x07, 0xC0, 0x7C, 0x07, 0xC0,
+    0x6C, 0x0E, 0xFF, 0x8F, 0xFE, 0xC0, 0x7C, 0x03, 0xC0, 0x3C, 0x03, 0xC0,
+    0x7F, 0xFE, 0xFF, 0x80, 0x66, 0x24, 0xA2, 0x45, 0x32, 0x39, 0x13, 0xA1,
+    0x2B, 0x03, 0xB0, 0x2C, 0xF0, 0x03, 0xBF, 0x11, 0x3A, 0x13, 0x91, 0x24,
+    0x53, 0x3A, 0x15, 0x63, 0x0A, 0x50, 0xC3, 0x02, 0x74, 0x20, 0x29, 0x31,
+    0x02, 0xA2, 0x10, 0x2A, 0x3F, 0x00, 0x2B, 0x2F, 0x10, 0x2A, 0x3F, 0x00,
+    0x2A, 0x21, 0x02, 0x93, 0x10, 0x27, 0x42, 0x0C, 0x30, 0xA5, 0x0B, 0xF0,
+    0x02, 0x9F, 0x40, 0x92, 0xF0, 0x02, 0x9F, 0x30, 0xBF, 0x00, 0x0B, 0xF0,
+    0x02, 0x9F, 0x40, 0x92, 0xF0, 0x02, 0x9F, 0x50, 0x66, 0x34, 0xA1, 0x24,
+    0x63, 0x13, 0x91, 0x11, 0x3B, 0x12, 0xC0, 0x3C, 0x02, 0xDF, 0x00, 0x37,
+    0x5F, 0x01, 0x2A, 0x21, 0x39, 0x2F, 0x02, 0x46, 0x33, 0xB1, 0x57, 0x30,
+    0x02, 0xA2, 0xF6, 0x0E, 0xF0, 0x02, 0xA2, 0xF5, 0x02, 0xFF, 0x53, 0xFA,
+    0x52, 0x1F, 0x04, 0x31, 0x06, 0x20, 0x53, 0xE0, 0x3F, 0x80, 0xCE, 0x06,
+    0x38, 0x30, 0xE1, 0x83, 0x8C, 0x0E, 0x70, 0x3F, 0x80, 0xFE, 0x03, 0x9C,
+    0x0E, 0x38, 0x38, 0x70, 0xE0, 0xC3, 0x83, 0x8E, 0x07, 0x38, 0x0E, 0xE0,
+    0x1C, 0x02, 0x8F, 0xD0, 0xAF, 0x00, 0xE0, 0x01, 0xF8, 0x00, 0x7F, 0x00,
+    0x3F, 0xC0, 0x0F, 0xD8, 0x06, 0xF7, 0x01, 0xBC, 0xC0, 0xCF, 0x38, 0x73,
+    0xC6, 0x18, 0xF0, 0xCE, 0x3C, 0x33, 0x0F, 0x07, 0x83, 0xC1, 0xE0, 0xF0,
+    0x30, 0x3C, 0x04, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xC0, 0xC0, 0x0F, 0x80,
+    0x3F, 0x00, 0xFC, 0x03, 0xD8, 0x0F, 0x30, 0x3C, 0xE0, 0xF1, 0xC3, 0xC3,
+    0x0F, 0x06, 0x3C, 0x1C, 0xF0, 0x3B, 0xC0, 0x6F, 0x00, 0xFC, 0x03, 0xF0,
+    0x07, 0xC0, 0x0C, 0x57, 0x53, 0xB3, 0x24, 0x54, 0x22, 0x29, 0x31, 0x13,
+    0xA2, 0x11, 0x2B, 0x30, 0x3B, 0x30, 0x3C, 0x20, 0x2D, 0x20, 0x3C, 0x20,
+    0x3B, 0x31, 0x2B, 0x31, 0x3A, 0x21, 0x22, 0x93, 0x12, 0x45, 0x42, 0x3B,
+    0x35, 0x75, 0x09, 0x30, 0xA2, 0x03, 0x53, 0x10, 0x36, 0x3F, 0x20, 0x36,
+    0x21, 0x03, 0x53, 0x10, 0xA2, 0x09, 0x30, 0x39, 0xF4, 0x57, 0x63, 0xB4,
+    0x24, 0x54, 0x32, 0x29, 0x32, 0x13, 0xA2, 0x21, 0x2B, 0x31, 0x03, 0xB3,
+    0x10, 0x3C, 0x21, 0x02, 0xD2, 0x10, 0x3C, 0x21, 0x03, 0xB3, 0x11, 0x2B,
+    0x31, 0x13, 0xA2, 0x22, 0x29, 0x32, 0x24, 0x54, 0x33, 0xB4, 0x59, 0x4C,
+    0x33, 0xD3, 0x2E, 0x31, 0xE0, 0x22, 0xFF, 0x87, 0xFE, 0x38, 0x39, 0xC0,
+    0xCE, 0x06, 0x70, 0x33, 0x81, 0x9C, 0x1C, 0xFF, 0xC7, 0xF8, 0x38, 0xC1,
+    0xC7, 0x0E, 0x1C, 0x70, 0x63, 0x81, 0x9C, 0x0E, 0xE0, 0x38, 0x1F, 0x07,
+    0xF9, 0xC3, 0x30, 0x0E, 0x01, 0xC0, 0x1C, 0x01, 0xF0, 0x1F, 0x80, 0x78,
+    0x03, 0x80, 0x30, 0x07, 0x01, 0xF8, 0x73, 0xFC, 0x3F, 0x00, 0x0E, 0xF0,
+    0x62, 0x6F, 0xD0, 0x02, 0x93, 0xF9, 0x02, 0x92, 0x10, 0x38, 0x21, 0x12,
+    0x73, 0x11, 0x44, 0x32, 0x29, 0x34, 0x64, 0xE0, 0x03, 0x60, 0x07, 0x70,
+    0x06, 0x30, 0x0E, 0x30, 0x0C, 0x38, 0x0C, 0x18, 0x1C, 0x1C, 0x18, 0x0C,
+    0x38, 0x0C, 0x30, 0x0E, 0x30, 0x06, 0x60, 0x07, 0x60, 0x03, 0xE0, 0x03,
+    0xC0, 0x03, 0xC0, 0x01, 0x80, 0xE0, 0x18, 0x03, 0x60, 0x1C, 0x07, 0x60,
+    0x3C, 0x07, 0x70, 0x3C, 0x06, 0x30, 0x36, 0x0E, 0x30, 0x76, 0x0E, 0x38,
+    0x66, 0x0C, 0x18, 0x63, 0x0C, 0x18, 0xE3, 0x1C, 0x1C, 0xC3, 0x18, 0x1C,
+    0xC1, 0x98, 0x0D, 0x81, 0xB8, 0x0D, 0x81, 0xF0, 0x0F, 0x80, 0xF0, 0x07,
+    0x00, 0xF0, 0x07, 0x00, 0xE0, 0x07, 0x00, 0x60, 0xE0, 0x0E, 0xE0, 0x18,
+    0xE0, 0x60, 0xC1, 0xC1, 0xC7, 0x01, 0xCC, 0x01, 0xB8, 0x01, 0xE0, 0x03,
+    0xC0, 0x0F, 0x80, 0x1B, 0x80, 0x63, 0x81, 0xC3, 0x03, 0x07, 0x0C, 0x07,
+    0x38, 0x06, 0xE0, 0x0E, 0x03, 0x93, 0x13, 0x82, 0x12, 0x27, 0x31, 0x23,
+    0x53, 0x23, 0x25, 0x23, 0x33, 0x33, 0x34, 0x32, 0x24, 0x52, 0x12, 0x55,
+    0x55, 0x63, 0x6F, 0x60, 0x0D, 0xF0, 0xA2, 0x19, 0x22, 0x83, 0x27, 0x33,
+    0x72, 0x46, 0x34, 0x53, 0x55, 0x26, 0x42, 0x73, 0x37, 0x23, 0x82, 0x29,
+    0x12, 0xA0, 0xDF, 0x00, 0x04, 0xF0, 0x02, 0x2F, 0xFF, 0x00, 0x4F, 0x00,
+    0xC0, 0x60, 0x18, 0x0C, 0x02, 0x01, 0x80, 0xC0, 0x30, 0x18, 0x04, 0x03,
+    0x00, 0x80, 0x60, 0x30, 0x0C, 0x06, 0x01, 0x00, 0xC0, 0x05, 0xF0, 0x32,
+    0xFF, 0xF0, 0x05, 0xF0, 0x0C, 0x07, 0x01, 0xE0, 0xCC, 0x33, 0x18, 0x6E,
+    0x1B, 0x03, 0x09, 0xF0, 0xE1, 0x86, 0x10, 0x1F, 0x1F, 0xE6, 0x18, 0x07,
+    0x00, 0xC7, 0xF7, 0xFF, 0x83, 0xC0, 0xF8, 0xF7, 0xED, 0xF3, 0xC0, 0x18,
+    0x03, 0x00, 0x60, 0x0C, 0x01, 0x9E, 0x37, 0xE7, 0x0E, 0xC0, 0xD8, 0x1B,
+    0x03, 0xE0, 0x7C, 0x0D, 0x81, 0xB8, 0x77, 0xFC, 0xDF, 0x00, 0x1F, 0x0F,
+    0xF7, 0x0B, 0x80, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xE0, 0x1C, 0x37, 0xF8,
+    0x7C, 0x83, 0xF3, 0x34, 0x13, 0x1A, 0x13, 0x43, 0x03, 0x53, 0x02, 0x63,
+    0xF2, 0x03, 0x53, 0x03, 0x44, 0x17, 0x12, 0x25, 0x22, 0x1F, 0x07, 0xF1,
+    0x83, 0x60, 0x2F, 0xFF, 0xFF, 0xF0, 0x06, 0x00, 0xE0, 0x0E, 0x18, 0xFF,
+    0x0F, 0x80, 0x44, 0x35, 0x23, 0x32, 0x24, 0xF0, 0x08, 0xF0, 0x22, 0x4F,
+    0x80, 0x3F, 0xEF, 0xFF, 0x86, 0x60, 0xCC, 0x18, 0xC3, 0x1F, 0xE3, 0xF0,
+    0x60, 0x0F, 0xF1, 0xFF, 0x60, 0x78, 0x07, 0x81, 0xBF, 0xE1, 0xF8, 0x02,
+    0x8F, 0x30, 0x22, 0x42, 0x02, 0x16, 0x10, 0x34, 0x30, 0x26, 0x2F, 0x70,
+    0xDC, 0x01, 0xB6, 0xDB, 0x6D, 0xB6, 0xC0, 0x32, 0x13, 0x36, 0xF1, 0x32,
+    0x1F, 0xC0, 0x51, 0x04, 0x20, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30,
+    0x7C, 0x3B, 0x1C, 0xCE, 0x37, 0x0F, 0x83, 0xF0, 0xCC, 0x31, 0x8C, 0x73,
+    0x0E, 0xC1, 0xC0, 0x02, 0xFF, 0x02, 0x14, 0x34, 0x20, 0x81, 0x61, 0x03,
+    0x34, 0x33, 0x02, 0x52, 0x52, 0xF7, 0x02, 0x24, 0x20, 0x91, 0x03, 0x43,
+    0x02, 0x62, 0xF7, 0x1F, 0x07, 0xF9, 0xC3, 0xF0, 0x3C, 0x07, 0x80, 0xF0,
+    0x1E, 0x03, 0xE0, 0x6E, 0x1C, 0xFF, 0x0F, 0x80, 0x02, 0x24, 0x20, 0x21,
+    0x61, 0x03, 0x43, 0x02, 0x62, 0xF4, 0x03, 0x43, 0x09, 0x10, 0x21, 0x52,
+    0x02, 0x8F, 0x20, 0x34, 0x22, 0x17, 0x12, 0x13, 0x34, 0x03, 0x53, 0x02,
+    0x63, 0xF2, 0x03, 0x53, 0x03, 0x44, 0x1A, 0x24, 0x23, 0x83, 0xF2, 0x02,
+    0x23, 0x07, 0x03, 0x40, 0x25, 0xF7, 0x3E, 0x7F, 0xE1, 0xC0, 0xE0, 0x78,
+    0x0E, 0x03, 0x03, 0xC3, 0xFF, 0x3C, 0x22, 0x3F, 0x20, 0x7F, 0x01, 0x33,
+    0xF5, 0x13, 0x21, 0x25, 0x33, 0x10, 0x03, 0x53, 0xF6, 0x12, 0x53, 0x12,
+    0x44, 0x17, 0x12, 0x25, 0x22, 0xE0, 0x36, 0x06, 0x60, 0x63, 0x06, 0x30,
+    0xC3, 0x8C, 0x19, 0x81, 0x98, 0x0D, 0x80, 0xF0, 0x07, 0x00, 0x60, 0xE0,
+    0xC0, 0xD8, 0x38, 0x36, 0x1E, 0x19, 0x87, 0x86, 0x31, 0xB1, 0x8C, 0x4C,
+    0xC3, 0x33, 0x30, 0x6C, 0x6C, 0x1A, 0x1A, 0x07, 0x87, 0x80, 0xE0, 0xE0,
+    0x30, 0x30, 0xE0, 0x73, 0x0E, 0x38, 0xC1, 0x98, 0x0F, 0x00, 0xF0, 0x0F,
+    0x01, 0xF8, 0x19, 0x83, 0x0C, 0x70, 0xEE, 0x07, 0xE0, 0x36, 0x06, 0x70,
+    0x63, 0x0E, 0x30, 0xC1, 0x8C, 0x19, 0x81, 0xD8, 0x0F, 0x00, 0xF0, 0x07,
+    0x00, 0x60, 0x06, 0x00, 0xC0, 0x0C, 0x01, 0x80, 0xFF, 0xFF, 0xC0, 0xC0,
+    0x40, 0x60, 0x60, 0x60, 0x60, 0x30, 0x30, 0x3F, 0xFF, 0xF0, 0x3B, 0xD8,
+    0xC4, 0x31, 0x8C, 0x63, 0x31, 0x86, 0x31, 0x8C, 0x62, 0x18, 0xC7, 0x9C,
+    0xFF, 0xFF, 0xFC, 0xE3, 0xC3, 0x86, 0x18, 0x43, 0x0C, 0x30, 0xC1, 0xC7,
+    0x30, 0xC3, 0x0C, 0x10, 0x61, 0x8C, 0xF3, 0x80, 0x00, 0x33, 0xC6, 0x7F,
+    0xEE, 0x3C, 0xC0, 0x00, 0xDC, 0x01, 0xB6, 0xDB, 0x6D, 0xB6, 0x02, 0x00,
+    0x80, 0x20, 0x7E, 0x7F, 0xD9, 0x8C, 0x63, 0x18, 0xC6, 0x31, 0x0C, 0x43,
+    0x90, 0x74, 0xDF, 0xF1, 0xF0, 0x10, 0x04, 0x01, 0x00, 0x55, 0x23, 0x81,
+    0x32, 0x43, 0x22, 0x61, 0x12, 0x28, 0xF2, 0x09, 0x3F, 0x02, 0x28, 0xF3,
+    0x0C, 0xF0, 0x80, 0x77, 0xB7, 0xF9, 0x86, 0x41, 0x90, 0x26, 0x19, 0x86,
+    0x7F, 0xB7, 0xB8, 0x04, 0xC0, 0x3E, 0x06, 0x60, 0x67, 0x0C, 0x30, 0xC1,
+    0x98, 0x19, 0x80, 0xF0, 0x0F, 0x07, 0xFE, 0x7F, 0xE0, 0x60, 0x7F, 0xE7,
+    0xFE, 0x06, 0x00, 0x60, 0x06, 0x00, 0xFF, 0x87, 0xFC, 0x1F, 0x0F, 0xE7,
+    0x09, 0x80, 0x60, 0x0E, 0x03, 0xE1, 0x9E, 0xC1, 0xF8, 0x37, 0x0C, 0xF6,
+    0x0F, 0x00, 0xE0, 0x18, 0x06, 0x61, 0x9F, 0xC3, 0xE0, 0xE7, 0xDC, 0x03,
+    0xF0, 0x07, 0xFE, 0x0F, 0x07, 0x8E, 0x7C, 0xE6, 0x7F, 0x96, 0x70, 0x8E,
+    0x30, 0x03, 0x30, 0x01, 0x98, 0x00, 0xCC, 0x00, 0x63, 0x00, 0x39, 0xC3,
+    0x36, 0x7F, 0x13, 0x9F, 0x38, 0xF0, 0x38, 0x1F, 0xF8, 0x03, 0xE0, 0x00,
+    0x3B, 0xF0, 0x4F, 0xFF, 0x1F, 0xDD, 0x22, 0x6D, 0x96, 0x6D, 0x99, 0x13,
+    0x33, 0x32, 0x0A, 0xF0, 0x82, 0xF2, 0xFF, 0xF0, 0x03, 0xF0, 0x07, 0xFE,
+    0x0F, 0x07, 0x8E, 0xFC, 0xE6, 0x7F, 0x16, 0x31, 0x8E, 0x18, 0x43, 0x0C,
+    0x61, 0x87, 0xF0, 0xC3, 0xE0, 0x61, 0x98, 0x38, 0xC6, 0x36, 0x63, 0x93,
+    0x80, 0x38, 0xF0, 0x38, 0x1F, 0xF8, 0x03, 0xE0, 0x00, 0xFF, 0xFC, 0x3C,
+    0x7E, 0xC6, 0x83, 0x83, 0xC6, 0x7E, 0x3C, 0x52, 0x5F, 0x20, 0xCF, 0x05,
+    0x25, 0xF2, 0xC0, 0xCF, 0x00, 0x79, 0xFC, 0xC3, 0x08, 0x42, 0x1F, 0xFC,
+    0x39, 0xFC, 0xC3, 0x18, 0x78, 0x7F, 0x78, 0x39, 0x99, 0x80, 0x03, 0x53,
+    0xF7, 0x03, 0x44, 0x08, 0x12, 0x02, 0x14, 0x22, 0x02, 0x9F, 0x11, 0x19,
+    0x3D, 0x2E, 0x17, 0x32, 0x3F, 0x00, 0x83, 0x23, 0x17, 0x32, 0x3F, 0x13,
+    0x53, 0x23, 0x62, 0x32, 0x3F, 0x90, 0x7F, 0x70, 0xC3, 0xFE, 0x10, 0xCF,
+    0x14, 0x10, 0x41, 0x1F, 0x7C, 0x3C, 0xFF, 0x1E, 0x1C, 0x38, 0xDF, 0x9E,
+    0x89, 0xB1, 0x33, 0x33, 0x64, 0xD9, 0x66, 0x98, 0x30, 0x0C, 0x70, 0x08,
+    0xD0, 0x18, 0x10, 0x30, 0x10, 0x20, 0x10, 0x60, 0x10, 0x40, 0x7C, 0xC0,
+    0x7D, 0x86, 0x01, 0x0E, 0x03, 0x1E, 0x06, 0x16, 0x06, 0x26, 0x0C, 0x7F,
+    0x08, 0x7F, 0x18, 0x06, 0x30, 0x06, 0x30, 0x0C, 0xE0, 0x33, 0x40, 0xC0,
+    0x81, 0x01, 0x06, 0x02, 0x08, 0x04, 0x30, 0x3E, 0xC0, 0x7D, 0x1C, 0x06,
+    0x7C, 0x09, 0x98, 0x30, 0x10, 0xC0, 0x41, 0x01, 0x06, 0x04, 0x08, 0x1F,
+    0x30, 0x7E, 0x78, 0x0C, 0xFC, 0x08, 0x8C, 0x18, 0x38, 0x30, 0x38, 0x20,
+    0x0C, 0x60, 0xCC, 0x40, 0xFC, 0xC0, 0x79, 0x86, 0x01, 0x0E, 0x03, 0x1E,
+    0x02, 0x16, 0x06, 0x26, 0x0C, 0x7F, 0x08, 0x7F, 0x18, 0x06, 0x30, 0x06,
+    0x1C, 0x1C, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x70, 0xE0, 0xC0, 0xC0,
+    0xC0, 0xC3, 0xFF, 0x3C, 0x34, 0x95, 0x38, 0x72, 0x7E, 0x02, 0x73, 0x66,
+    0x46, 0xF0, 0x65, 0x55, 0x22, 0x25, 0x52, 0x23, 0x44, 0x33, 0x24, 0x42,
+    0x42, 0x44, 0x24, 0x33, 0x33, 0x52, 0x33, 0x26, 0x32, 0x2C, 0x2F, 0x02,
+    0x28, 0x31, 0x13, 0x92, 0x11, 0x2A, 0x30, 0x3B, 0x20, 0x84, 0x47, 0x36,
+    0x63, 0x7E, 0x02, 0x73, 0x66, 0x46, 0xF0, 0x65, 0x55, 0x22, 0x25, 0x52,
+    0x23, 0x44, 0x33, 0x24, 0x42, 0x42, 0x44, 0x24, 0x33, 0x33, 0x52, 0x33,
+    0x26, 0x32, 0x2C, 0x2F, 0x02, 0x28, 0x31, 0x13, 0x92, 0x11, 0x2A, 0x30,
+    0x3B, 0x20, 0x01, 0x80, 0x07, 0xC0, 0x0C, 0x70, 0x00, 0x00, 0x01, 0xC0,
+    0x03, 0xC0, 0x03, 0xC0, 0x03, 0xE0, 0x06, 0x60, 0x06, 0x70, 0x0E, 0x30,
+    0x0C, 0x30, 0x0C, 0x38, 0x1C, 0x18, 0x18, 0x1C, 0x3F, 0xFC, 0x3F, 0xFC,
+    0x30, 0x0E, 0x70, 0x06, 0x60, 0x07, 0xE0, 0x03, 0x07, 0x20, 0x07, 0xE0,
+    0x0C, 0xC0, 0x00, 0x00, 0x01, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xE0,
+    0x06, 0x60, 0x06, 0x70, 0x0E, 0x30, 0x0C, 0x30, 0x0C, 0x38, 0x1C, 0x18,
+    0x18, 0x1C, 0x3F, 0xFC, 0x3F, 0xFC, 0x30, 0x0E, 0x70, 0x06, 0x60, 0x07,
+    0xE0, 0x03, 0x0C, 0x60, 0x0C, 0x70, 0x00, 0x00, 0x01, 0xC0, 0x03, 0xC0,
+    0x03, 0xC0, 0x03, 0xE0, 0x06, 0x60, 0x06, 0x70, 0x0E, 0x30, 0x0C, 0x30,
+    0x0C, 0x38, 0x1C, 0x18, 0x18, 0x1C, 0x3F, 0xFC, 0x3F, 0xFC, 0x30, 0x0E,
+    0x70, 0x06, 0x60, 0x07, 0xE0, 0x03, 0x63, 0x76, 0x46, 0x51, 0x31, 0x66,
+    0x46, 0x63, 0x77, 0x36, 0x64, 0x6F, 0x06, 0x55, 0x52, 0x22, 0x55, 0x22,
+    0x34, 0x43, 0x32, 0x44, 0x24, 0x24, 0x42, 0x43, 0x33, 0x35, 0x23, 0x32,
+    0x63, 0x22, 0xC2, 0xF0, 0x22, 0x83, 0x11, 0x39, 0x21, 0x12, 0xA3, 0x03,
+    0xB2, 0x9C, 0x8D, 0x75, 0x97, 0x21, 0x29, 0x63, 0x12, 0x96, 0x22, 0x29,
+    0x53, 0x23, 0x85, 0x24, 0x28, 0x43, 0x48, 0x24, 0x25, 0x82, 0x33, 0x52,
+    0x83, 0xA8, 0x2B, 0x82, 0x27, 0x37, 0x13, 0x73, 0x71, 0x29, 0x90, 0x2A,
+    0x90, 0x66, 0x24, 0xA2, 0x45, 0x32, 0x39, 0x13, 0xA1, 0x2B, 0x03, 0xB0,
+    0x2C, 0xF0, 0x03, 0xBF, 0x11, 0x3A, 0x13, 0x91, 0x24, 0x53, 0x3A, 0x15,
+    0x72, 0x72, 0x59, 0x14, 0x65, 0x37, 0x34, 0x14, 0x63, 0x35, 0x52, 0x4B,
+    0x0B, 0xF0, 0x02, 0x9F, 0x40, 0x92, 0xF0, 0x02, 0x9F, 0x30, 0xBF, 0x00,
+    0x64, 0x15, 0x33, 0x43, 0x4B, 0x0B, 0xF0, 0x02, 0x9F, 0x40, 0x92, 0xF0,
+    0x02, 0x9F, 0x30, 0xBF, 0x00, 0x52, 0x43, 0x53, 0x22, 0x33, 0x1B, 0x0B,
+    0xF0, 0x02, 0x9F, 0x40, 0x92, 0xF0, 0x02, 0x9F, 0x30, 0xBF, 0x00, 0x22,
+    0x32, 0x22, 0x23, 0x31, 0xB0, 0xBF, 0x00, 0x29, 0xF4, 0x09, 0x2F, 0x00,
+    0x29, 0xF3, 0x0B, 0xF0, 0x04, 0x22, 0x31, 0x42, 0x64, 0x2F, 0xF0, 0x24,
+    0x13, 0x20, 0x33, 0x61, 0x23, 0xFF, 0x32, 0x31, 0x52, 0x02, 0x33, 0x83,
+    0x23, 0xFF, 0x02, 0x32, 0x10, 0x23, 0x38, 0x32, 0x3F, 0xF0, 0x2A, 0x52,
+    0xC3, 0x22, 0x74, 0x22, 0x29, 0x22, 0x22, 0x93, 0x12, 0x2A, 0x21, 0x22,
+    0xA3, 0xF0, 0x09, 0x53, 0xF0, 0x22, 0xA3, 0x22, 0xA2, 0x12, 0x29, 0x31,
+    0x22, 0x92, 0x22, 0x27, 0x42, 0x2B, 0x42, 0x96, 0x07, 0x20, 0x1F, 0x80,
+    0xCC, 0x00, 0x00, 0xC0, 0x0F, 0x80, 0x3F, 0x00, 0xFC, 0x03, 0xD8, 0x0F,
+    0x30, 0x3C, 0xE0, 0xF1, 0xC3, 0xC3, 0x0F, 0x06, 0x3C, 0x1C, 0xF0, 0x3B,
+    0xC0, 0x6F, 0x00, 0xFC, 0x03, 0xF0, 0x07, 0xC0, 0x0C, 0x44, 0x96, 0x38,
+    0x82, 0x7E, 0x03, 0x57, 0x53, 0xB3, 0x24, 0x54, 0x22, 0x29, 0x31, 0x13,
+    0xA2, 0x11, 0x2B, 0x30, 0x3B, 0x30, 0x3C, 0x20, 0x2D, 0x20, 0x3C, 0x20,
+    0x3B, 0x31, 0x2B, 0x31, 0x3A, 0x21, 0x22, 0x93, 0x12, 0x45, 0x42, 0x3B,
+    0x35, 0x75, 0x94, 0x48, 0x36, 0x73, 0x7E, 0x03, 0x57, 0x53, 0xB3, 0x24,
+    0x54, 0x22, 0x29, 0x31, 0x13, 0xA2, 0x11, 0x2B, 0x30, 0x3B, 0x30, 0x3C,
+    0x20, 0x2D, 0x20, 0x3C, 0x20, 0x3B, 0x31, 0x2B, 0x31, 0x3A, 0x21, 0x22,
+    0x93, 0x12, 0x45, 0x42, 0x3B, 0x35, 0x75, 0x82, 0x76, 0x56, 0x52, 0x33,
+    0x4E, 0x03, 0x57, 0x53, 0xB3, 0x24, 0x54, 0x22, 0x29, 0x31, 0x13, 0xA2,
+    0x11, 0x2B, 0x30, 0x3B, 0x30, 0x3C, 0x20, 0x2D, 0x20, 0x3C, 0x20, 0x3B,
+    0x31, 0x2B, 0x31, 0x3A, 0x21, 0x22, 0x93, 0x12, 0x45, 0x42, 0x3B, 0x35,
+    0x75, 0x63, 0x21, 0x56, 0x65, 0x52, 0x22, 0x6E, 0x03, 0x57, 0x53, 0xB3,
+    0x24, 0x54, 0x22, 0x29, 0x31, 0x13, 0xA2, 0x11, 0x2B, 0x30, 0x3B, 0x30,
+    0x3C, 0x20, 0x2D, 0x20, 0x3C, 0x20, 0x3B, 0x31, 0x2B, 0x31, 0x3A, 0x21,
+    0x22, 0x93, 0x12, 0x45, 0x42, 0x3B, 0x35, 0x75, 0x52, 0x32, 0x55, 0x23,
+    0x34, 0xE0, 0x35, 0x75, 0x3B, 0x32, 0x45, 0x42, 0x22, 0x93, 0x11, 0x3A,
+    0x21, 0x12, 0xB3, 0x03, 0xB3, 0x03, 0xC2, 0x02, 0xD2, 0x03, 0xC2, 0x03,
+    0xB3, 0x12, 0xB3, 0x13, 0xA2, 0x12, 0x29, 0x31, 0x24, 0x54, 0x23, 0xB3,
+    0x57, 0x50, 0x80, 0x70, 0x36, 0x38, 0xDC, 0x1E, 0x07, 0x03, 0xE1, 0xCC,
+    0xE1, 0xF0, 0x30, 0x07, 0xF3, 0x8F, 0xFF, 0x0F, 0x07, 0x86, 0x01, 0xE7,
+    0x01, 0xB3, 0x01, 0x9F, 0x81, 0x8F, 0xC0, 0x83, 0xC0, 0xC1, 0xF0, 0xC0,
+    0xF8, 0xC0, 0xEC, 0x40, 0x77, 0x60, 0x33, 0xE0, 0x38, 0xF0, 0x78, 0x3F,
+    0xF8, 0x37, 0xF0, 0x30, 0x00, 0x00, 0x24, 0x84, 0x37, 0x62, 0x6E, 0x02,
+    0x93, 0xF9, 0x02, 0x92, 0x10, 0x38, 0x21, 0x12, 0x73, 0x11, 0x44, 0x32,
+    0x29, 0x34, 0x64, 0x74, 0x36, 0x35, 0x53, 0x6E, 0x02, 0x93, 0xF9, 0x02,
+    0x92, 0x10, 0x38, 0x21, 0x12, 0x73, 0x11, 0x44, 0x32, 0x29, 0x34, 0x64,
+    0x62, 0x64, 0x55, 0x32, 0x33, 0x3E, 0x02, 0x93, 0xF9, 0x02, 0x92, 0x10,
+    0x38, 0x21, 0x12, 0x73, 0x11, 0x44, 0x32, 0x29, 0x34, 0x64, 0x32, 0x32,
+    0x43, 0x23, 0x33, 0xE0, 0x29, 0x3F, 0x90, 0x29, 0x21, 0x03, 0x82, 0x11,
+    0x27, 0x31, 0x14, 0x43, 0x22, 0x93, 0x46, 0x40, 0x84, 0x37, 0x35, 0x63,
+    0x6E, 0x01, 0x03, 0x93, 0x13, 0x82, 0x12, 0x27, 0x31, 0x23, 0x53, 0x23,
+    0x25, 0x23, 0x33, 0x33, 0x34, 0x32, 0x24, 0x52, 0x12, 0x55, 0x55, 0x63,
+    0x6F, 0x60, 0x03, 0x9F, 0x10, 0x93, 0x0A, 0x20, 0x35, 0x31, 0x03, 0x63,
+    0xF2, 0x03, 0x62, 0x10, 0x35, 0x31, 0x0A, 0x20, 0x93, 0x03, 0x9F, 0x10,
+    0x1F, 0x83, 0xFC, 0x70, 0xE6, 0x06, 0xE0, 0x6C, 0x0C, 0xC3, 0x8C, 0x70,
+    0xC6, 0x0C, 0x78, 0xC3, 0xCC, 0x0E, 0xC0, 0x3C, 0x03, 0xCC, 0x6D, 0xFE,
+    0xC7, 0xC0, 0x38, 0x03, 0x00, 0x60, 0x08, 0x00, 0x07, 0xC7, 0xF9, 0x86,
+    0x01, 0xC0, 0x31, 0xFD, 0xFF, 0xE0, 0xF0, 0x3E, 0x3D, 0xFB, 0x7C, 0xC0,
+    0x03, 0x80, 0xC0, 0x60, 0x30, 0x00, 0x07, 0xC7, 0xF9, 0x86, 0x01, 0xC0,
+    0x31, 0xFD, 0xFF, 0xE0, 0xF0, 0x3E, 0x3D, 0xFB, 0x7C, 0xC0, 0x0E, 0x06,
+    0xC3, 0x18, 0x00, 0x00, 0x07, 0xC7, 0xF9, 0x86, 0x01, 0xC0, 0x31, 0xFD,
+    0xFF, 0xE0, 0xF0, 0x3E, 0x3D, 0xFB, 0x7C, 0xC0, 0x1C, 0x8F, 0xE3, 0x30,
+    0x00, 0x00, 0x07, 0xC7, 0xF9, 0x86, 0x01, 0xC0, 0x31, 0xFD, 0xFF, 0xE0,
+    0xF0, 0x3E, 0x3D, 0xFB, 0x7C, 0xC0, 0x39, 0x8E, 0xE0, 0x00, 0x00, 0x00,
+    0x07, 0xC7, 0xF9, 0x86, 0x01, 0xC0, 0x31, 0xFD, 0xFF, 0xE0, 0xF0, 0x3E,
+    0x3D, 0xFB, 0x7C, 0xC0, 0x0E, 0x03, 0xC1, 0x90, 0x64, 0x0F, 0x07, 0xC7,
+    0xF9, 0x86, 0x01, 0xC0, 0x31, 0xFD, 0xFF, 0xE0, 0xF0, 0x3E, 0x3D, 0xFB,
+    0x7C, 0xC0, 0x1E, 0x1E, 0x1F, 0xCF, 0xC6, 0x1E, 0x18, 0x07, 0x06, 0x00,
+    0xC0, 0x87, 0xFF, 0xF7, 0xFF, 0xFF, 0xC3, 0x00, 0xC1, 0xC0, 0x38, 0xF8,
+    0x27, 0xF7, 0xF8, 0xF0, 0x78, 0x1F, 0x1F, 0xF7, 0x0B, 0x80, 0xC0, 0x30,
+    0x0C, 0x03, 0x00, 0xE0, 0x1C, 0x73, 0xF8, 0x30, 0x0E, 0x00, 0xC1, 0xF0,
+    0x38, 0x38, 0x01, 0x80, 0x18, 0x01, 0x00, 0x00, 0x3E, 0x0F, 0xE3, 0x06,
+    0xC0, 0x5F, 0xFF, 0xFF, 0xE0, 0x0C, 0x01, 0xC0, 0x1C, 0x31, 0xFE, 0x1F,
+    0x00, 0x03, 0x80, 0x60, 0x18, 0x06, 0x00, 0x00, 0x3E, 0x0F, 0xE3, 0x06,
+    0xC0, 0x5F, 0xFF, 0xFF, 0xE0, 0x0C, 0x01, 0xC0, 0x1C, 0x31, 0xFE, 0x1F,
+    0x00, 0x0E, 0x03, 0x60, 0xC6, 0x00, 0x00, 0x00, 0x3E, 0x0F, 0xE3, 0x06,
+    0xC0, 0x5F, 0xFF, 0xFF, 0xE0, 0x0C, 0x01, 0xC0, 0x1C, 0x31, 0xFE, 0x1F,
+    0x00, 0x39, 0x87, 0x70, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x0F, 0xE3, 0x06,
+    0xC0, 0x5F, 0xFF, 0xFF, 0xE0, 0x0C, 0x01, 0xC0, 0x1C, 0x31, 0xFE, 0x1F,
+    0x00, 0x03, 0x22, 0x21, 0x32, 0x41, 0x53, 0x2F, 0xA0, 0x23, 0x22, 0x11,
+    0x22, 0x02, 0x35, 0x12, 0x2F, 0xA0, 0x23, 0x21, 0x21, 0x21, 0x02, 0x32,
+    0x7F, 0x03, 0x22, 0xFA, 0x03, 0x22, 0x03, 0x13, 0x7F, 0x13, 0x22, 0xFA,
+    0x10, 0x87, 0xF8, 0x1C, 0x07, 0xC0, 0x8C, 0x01, 0x87, 0x9B, 0xFF, 0x70,
+    0xFC, 0x0F, 0x01, 0xE0, 0x3C, 0x07, 0xC0, 0xDC, 0x71, 0xFE, 0x1F, 0x00,
+    0x23, 0x21, 0x21, 0x72, 0x12, 0x22, 0x3A, 0xF0, 0x02, 0x24, 0x20, 0x91,
+    0x03, 0x43, 0x02, 0x62, 0xF7, 0x38, 0x01, 0x80, 0x18, 0x01, 0x00, 0x00,
+    0x3E, 0x0F, 0xF3, 0x87, 0xE0, 0x78, 0x0F, 0x01, 0xE0, 0x3C, 0x07, 0xC0,
+    0xDC, 0x39, 0xFE, 0x1F, 0x00, 0x03, 0x80, 0x60, 0x18, 0x06, 0x00, 0x00,
+    0x3E, 0x0F, 0xF3, 0x87, 0xE0, 0x78, 0x0F, 0x01, 0xE0, 0x3C, 0x07, 0xC0,
+    0xDC, 0x39, 0xFE, 0x1F, 0x00, 0x0E, 0x03, 0x60, 0xC6, 0x00, 0x00, 0x00,
+    0x3E, 0x0F, 0xF3, 0x87, 0xE0, 0x78, 0x0F, 0x01, 0xE0, 0x3C, 0x07, 0xC0,
+    0xDC, 0x39, 0xFE, 0x1F, 0x00, 0x1C, 0x87, 0xF0, 0xCC, 0x00, 0x00, 0x00,
+    0x3E, 0x0F, 0xF3, 0x87, 0xE0, 0x78, 0x0F, 0x01, 0xE0, 0x3C, 0x07, 0xC0,
+    0xDC, 0x39, 0xFE, 0x1F, 0x00, 0x39, 0x87, 0x70, 0x00, 0x00, 0x00, 0x00,
+    0x3E, 0x0F, 0xF3, 0x87, 0xE0, 0x78, 0x0F, 0x01, 0xE0, 0x3C, 0x07, 0xC0,
+    0xDC, 0x39, 0xFE, 0x1F, 0x00, 0x52, 0x54, 0x35, 0xCF, 0x00, 0xCF, 0x0C,
+    0xF1, 0x52, 0x54, 0x35, 0x00, 0x31, 0xF6, 0x7F, 0xC7, 0x0C, 0xE1, 0xEC,
+    0x36, 0xC6, 0x6C, 0x46, 0xC8, 0x6F, 0x06, 0x70, 0xE7, 0xFC, 0xDF, 0x08,
+    0x00, 0x23, 0x64, 0x25, 0x52, 0x46, 0x14, 0xB0, 0x35, 0x3F, 0x61, 0x25,
+    0x31, 0x24, 0x41, 0x71, 0x22, 0x52, 0x20, 0x63, 0x26, 0x23, 0x52, 0x44,
+    0x25, 0xB0, 0x35, 0x3F, 0x61, 0x25, 0x31, 0x24, 0x41, 0x71, 0x22, 0x52,
+    0x20, 0x43, 0x43, 0x21, 0x23, 0x22, 0x32, 0x2B, 0xF0, 0x03, 0x53, 0xF6,
+    0x12, 0x53, 0x12, 0x44, 0x17, 0x12, 0x25, 0x22, 0x23, 0x22, 0x22, 0x31,
+    0x32, 0xBF, 0x10, 0x35, 0x3F, 0x61, 0x25, 0x31, 0x24, 0x41, 0x71, 0x22,
+    0x52, 0x20, 0x01, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x00, 0x0E, 0x03, 0x60,
+    0x67, 0x06, 0x30, 0xE3, 0x0C, 0x18, 0xC1, 0x98, 0x1D, 0x80, 0xF0, 0x0F,
+    0x00, 0x70, 0x06, 0x00, 0x60, 0x0C, 0x00, 0xC0, 0x18, 0x00, 0x02, 0x8F,
+    0x30, 0x22, 0x42, 0x02, 0x16, 0x10, 0x34, 0x30, 0x26, 0x2F, 0x40, 0x34,
+    0x30, 0x91, 0x02, 0x15, 0x20, 0x28, 0xF2, 0x1C, 0xC1, 0xDC, 0x00, 0x00,
+    0x00, 0x00, 0x0E, 0x03, 0x60, 0x67, 0x06, 0x30, 0xE3, 0x0C, 0x18, 0xC1,
+    0x98, 0x1D, 0x80, 0xF0, 0x0F, 0x00, 0x70, 0x06, 0x00, 0x60, 0x0C, 0x00,
+    0xC0, 0x18, 0x00, 0x1E, 0x1F, 0x9F, 0xEF, 0xFF, 0xFB, 0xFD, 0xFE, 0x7E,
+    0x1E, 0x00, 0x65, 0x35, 0x81, 0x43, 0x42, 0x13, 0x38, 0x32, 0x92, 0x2A,
+    0x0B, 0x3F, 0x02, 0x2A, 0x0A, 0x4F, 0x02, 0x2A, 0x23, 0x93, 0x29, 0x34,
+    0x43, 0x49, 0x16, 0x53 };
+
+const GFXglyph LatoLatin12ptGlyphs[] = {
+    {0, 0, 0, 5, 0, 0}, // 0x20 ' '
+    {LCD_GLYPH_PLAIN | 0, 3, 17, 8, 3, -17}, // 0x21 '!'
+    {LCD_GLYPH_PLAIN | 7, 6, 6, 10, 2, -17}, // 0x22 '"'
+    {LCD_GLYPH_PLAIN | 12, 12, 17, 14, 1, -17}, // 0x23 '#'
+    {LCD_GLYPH_PLAIN | 38, 12, 22, 14, 1, -19}, // 0x24 '$'
+    {LCD_GLYPH_PLAIN | 71, 17, 17, 19, 1, -17}, // 0x25 '%'
+    {LCD_GLYPH_PLAIN | 108, 16, 17, 17, 1, -17}, // 0x26 '&'
+    {LCD_GLYPH_PLAIN | 142, 2, 6, 6, 2, -17}, // 0x27 '\x27'
+    {LCD_GLYPH_PLAIN | 144, 4, 21, 7, 2, -19}, // 0x28 '('
+    {LCD_GLYPH_PLAIN | 155, 4, 21, 7, 1, -19}, // 0x29 ')'
+    {LCD_GLYPH_PLAIN | 166, 7, 8, 10, 1, -17}, // 0x2A '*'
+    {173, 12, 12, 14, 1, -14}, // 0x2B '+'
+    {LCD_GLYPH_PLAIN | 180, 3, 5, 5, 1, -2}, // 0x2C ','
+    {LCD_GLYPH_PLAIN | 182, 6, 2, 8, 1, -8}, // 0x2D '-'
+    {LCD_GLYPH_PLAIN | 184, 3, 2, 5, 1, -2}, // 0x2E '.'
+    {LCD_GLYPH_PLAIN | 185, 9, 18, 9, -1, -17}, // 0x2F '/'
+    {206, 12, 17, 14, 1, -17}, // 0x30 '0'
+    {229, 11, 17, 14, 2, -17}, // 0x31 '1'
+    {LCD_GLYPH_PLAIN | 243, 12, 17, 14, 1, -17}, // 0x32 '2'
+    {LCD_GLYPH_PLAIN | 269, 12, 17, 14, 1, -17}, // 0x33 '3'
+    {295, 13, 17, 14, 0, -17}, // 0x34 '4'
+    {321, 11, 17, 14, 1, -17}, // 0x35 '5'
+    {LCD_GLYPH_PLAIN | 340, 12, 17, 14, 1, -17}, // 0x36 '6'
+    {366, 12, 17, 14, 1, -17}, // 0x37 '7'
+    {LCD_GLYPH_PLAIN | 390, 12, 17, 14, 1, -17}, // 0x38 '8'
+    {LCD_GLYPH_PLAIN | 416, 11, 17, 14, 2, -17}, // 0x39 '9'
+    {LCD_GLYPH_PLAIN | 440, 3, 12, 6, 2, -12}, // 0x3A ':'
+    {LCD_GLYPH_PLAIN | 445, 3, 15, 6, 2, -12}, // 0x3B ';'
+    {LCD_GLYPH_PLAIN | 451, 9, 10, 14, 2, -13}, // 0x3C '<'
+    {463, 10, 6, 14, 2, -11}, // 0x3D '='
+    {LCD_GLYPH_PLAIN | 469, 9, 10, 14, 3, -13}, // 0x3E '>'
+    {LCD_GLYPH_PLAIN | 481, 9, 17, 10, 0, -17}, // 0x3F '?'
+    {LCD_GLYPH_PLAIN | 501, 18, 19, 20, 1, -16}, // 0x40 '@'
+    {LCD_GLYPH_PLAIN | 544, 16, 17, 16, 0, -17}, // 0x41 'A'
+    {LCD_GLYPH_PLAIN | 578, 12, 17, 16, 2, -17}, // 0x42 'B'
+    {604, 14, 17, 16, 1, -17}, // 0x43 'C'
+    {628, 15, 17, 18, 2, -17}, // 0x44 'D'
+    {658, 11, 17, 14, 2, -17}, // 0x45 'E'
+    {670, 11, 17, 14, 2, -17}, // 0x46 'F'
+    {680, 15, 17, 18, 1, -17}, // 0x47 'G'
+    {708, 14, 17, 18, 2, -17}, // 0x48 'H'
+    {716, 2, 17, 7, 3, -17}, // 0x49 'I'
+    {718, 8, 17, 11, 1, -17}, // 0x4A 'J'
+    {LCD_GLYPH_PLAIN | 727, 14, 17, 16, 2, -17}, // 0x4B 'K'
+    {757, 10, 17, 12, 2, -17}, // 0x4C 'L'
+    {LCD_GLYPH_PLAIN | 762, 18, 17, 22, 2, -17}, // 0x4D 'M'
+    {LCD_GLYPH_PLAIN | 801, 14, 17, 18, 2, -17}, // 0x4E 'N'
+    {831, 17, 17, 19, 1, -17}, // 0x4F 'O'
+    {866, 12, 17, 15, 2, -17}, // 0x50 'P'
+    {885, 18, 21, 19, 1, -17}, // 0x51 'Q'
+    {LCD_GLYPH_PLAIN | 930, 13, 17, 15, 2, -17}, // 0x52 'R'
+    {LCD_GLYPH_PLAIN | 958, 11, 17, 13, 1, -17}, // 0x53 'S'
+    {982, 14, 17, 14, 0, -17}, // 0x54 'T'
+    {987, 14, 17, 18, 2, -17}, // 0x55 'U'
+    {LCD_GLYPH_PLAIN | 1003, 16, 17, 16, 0, -17}, // 0x56 'V'
+    {LCD_GLYPH_PLAIN | 1037, 24, 17, 24, 0, -17}, // 0x57 'W'
+    {LCD_GLYPH_PLAIN | 1088, 15, 17, 15, 0, -17}, // 0x58 'X'
+    {1120, 15, 17, 15, 0, -17}, // 0x59 'Y'
+    {1144, 13, 17, 15, 1, -17}, // 0x5A 'Z'
+    {1168, 4, 22, 7, 2, -19}, // 0x5B '['
+    {LCD_GLYPH_PLAIN | 1176, 9, 18, 9, -1, -17}, // 0x5C '\x5C'
+    {1197, 5, 22, 7, 1, -19}, // 0x5D ']'
+    {LCD_GLYPH_PLAIN | 1204, 10, 8, 14, 2, -17}, // 0x5E '^'
+    {1214, 9, 2, 9, 0, 1}, // 0x5F '_'
+    {LCD_GLYPH_PLAIN | 1216, 5, 4, 7, 0, -17}, // 0x60 '`'
+    {LCD_GLYPH_PLAIN | 1219, 10, 12, 12, 1, -12}, // 0x61 'a'
+    {LCD_GLYPH_PLAIN | 1234, 11, 17, 13, 2, -17}, // 0x62 'b'
+    {LCD_GLYPH_PLAIN | 1258, 10, 12, 11, 1, -12}, // 0x63 'c'
+    {1273, 11, 17, 13, 1, -17}, // 0x64 'd'
+    {LCD_GLYPH_PLAIN | 1293, 11, 12, 13, 1, -12}, // 0x65 'e'
+    {1310, 8, 17, 8, 0, -17}, // 0x66 'f'
+    {LCD_GLYPH_PLAIN | 1321, 11, 16, 12, 1, -12}, // 0x67 'g'
+    {1343, 10, 17, 13, 2, -17}, // 0x68 'h'
+    {LCD_GLYPH_PLAIN | 1356, 3, 17, 6, 2, -17}, // 0x69 'i'
+    {1363, 6, 21, 6, -1, -17}, // 0x6A 'j'
+    {LCD_GLYPH_PLAIN | 1373, 10, 17, 13, 2, -17}, // 0x6B 'k'
+    {1395, 2, 17, 6, 2, -17}, // 0x6C 'l'
+    {1397, 16, 12, 20, 2, -12}, // 0x6D 'm'
+    {1410, 10, 12, 13, 2, -12}, // 0x6E 'n'
+    {LCD_GLYPH_PLAIN | 1419, 11, 12, 13, 1, -12}, // 0x6F 'o'
+    {1436, 10, 16, 13, 2, -12}, // 0x70 'p'
+    {1455, 11, 16, 13, 1, -12}, // 0x71 'q'
+    {1475, 7, 12, 10, 2, -12}, // 0x72 'r'
+    {LCD_GLYPH_PLAIN | 1482, 8, 12, 10, 1, -12}, // 0x73 's'
+    {1494, 7, 16, 9, 1, -16}, // 0x74 't'
+    {1506, 11, 12, 13, 1, -12}, // 0x75 'u'
+    {LCD_GLYPH_PLAIN | 1517, 12, 12, 12, 0, -12}, // 0x76 'v'
+    {LCD_GLYPH_PLAIN | 1535, 18, 12, 18, 0, -12}, // 0x77 'w'
+    {LCD_GLYPH_PLAIN | 1562, 12, 12, 12, 0, -12}, // 0x78 'x'
+    {LCD_GLYPH_PLAIN | 1580, 12, 16, 12, 0, -12}, // 0x79 'y'
+    {LCD_GLYPH_PLAIN | 1604, 9, 12, 11, 1, -12}, // 0x7A 'z'
+    {LCD_GLYPH_PLAIN | 1618, 5, 22, 7, 1, -19}, // 0x7B '{'
+    {LCD_GLYPH_PLAIN | 1632, 1, 22, 7, 3, -18}, // 0x7C '|'
+    {LCD_GLYPH_PLAIN | 1635, 6, 22, 7, 1, -19}, // 0x7D '}'
+    {LCD_GLYPH_PLAIN | 1652, 12, 5, 14, 1, -9}, // 0x7E '~'
+    {1660, 0, 0, 5, 0, 0}, // 0xA0 '\xA0'
+    {LCD_GLYPH_PLAIN | 1660, 3, 16, 8, 3, -12}, // 0xA1 '\xA1'
+    {LCD_GLYPH_PLAIN | 1666, 10, 18, 14, 2, -15}, // 0xA2 '\xA2'
+    {1689, 12, 17, 14, 1, -17}, // 0xA3 '\xA3'
+    {LCD_GLYPH_PLAIN | 1706, 10, 11, 14, 2, -14}, // 0xA4 '\xA4'
+    {LCD_GLYPH_PLAIN | 1720, 12, 17, 14, 1, -17}, // 0xA5 '\xA5'
+    {LCD_GLYPH_PLAIN | 1746, 1, 22, 7, 3, -18}, // 0xA6 '\xA6'
+    {LCD_GLYPH_PLAIN | 1749, 10, 19, 12, 1, -17}, // 0xA7 '\xA7'
+    {LCD_GLYPH_PLAIN | 1773, 7, 2, 7, 0, -17}, // 0xA8 '\xA8'
+    {LCD_GLYPH_PLAIN | 1775, 17, 17, 19, 1, -17}, // 0xA9 '\xA9'
+    {LCD_GLYPH_PLAIN | 1812, 6, 8, 8, 1, -17}, // 0xAA '\xAA'
+    {LCD_GLYPH_PLAIN | 1818, 7, 9, 11, 2, -11}, // 0xAB '\xAB'
+    {1826, 10, 6, 14, 2, -9}, // 0xAC '\xAC'
+    {LCD_GLYPH_PLAIN | 1830, 6, 2, 8, 1, -8}, // 0xAD '\xAD'
+    {LCD_GLYPH_PLAIN | 1832, 17, 17, 19, 1, -17}, // 0xAE '\xAE'
+    {LCD_GLYPH_PLAIN | 1869, 7, 2, 7, 0, -16}, // 0xAF '\xAF'
+    {LCD_GLYPH_PLAIN | 1871, 8, 8, 10, 1, -17}, // 0xB0 '\xB0'
+    {1879, 12, 13, 14, 1, -14}, // 0xB1 '\xB1'
+    {LCD_GLYPH_PLAIN | 1889, 6, 9, 8, 1, -19}, // 0xB2 '\xB2'
+    {LCD_GLYPH_PLAIN | 1896, 6, 9, 8, 1, -19}, // 0xB3 '\xB3'
+    {LCD_GLYPH_PLAIN | 1903, 5, 4, 7, 2, -17}, // 0xB4 '\xB4'
+    {1906, 11, 16, 13, 1, -12}, // 0xB5 '\xB5'
+    {1920, 16, 20, 16, 0, -17}, // 0xB6 '\xB6'
+    {LCD_GLYPH_PLAIN | 1938, 4, 3, 7, 1, -8}, // 0xB7 '\xB7'
+    {LCD_GLYPH_PLAIN | 1940, 4, 4, 7, 2, 0}, // 0xB8 '\xB8'
+    {LCD_GLYPH_PLAIN | 1942, 6, 9, 8, 1, -19}, // 0xB9 '\xB9'
+    {LCD_GLYPH_PLAIN | 1949, 7, 8, 9, 1, -17}, // 0xBA '\xBA'
+    {LCD_GLYPH_PLAIN | 1956, 7, 9, 11, 2, -11}, // 0xBB '\xBB'
+    {LCD_GLYPH_PLAIN | 1964, 16, 17, 17, 1, -17}, // 0xBC '\xBC'
+    {LCD_GLYPH_PLAIN | 1998, 15, 17, 17, 1, -17}, // 0xBD '\xBD'
+    {LCD_GLYPH_PLAIN | 2030, 16, 17, 17, 1, -17}, // 0xBE '\xBE'
+    {LCD_GLYPH_PLAIN | 2064, 8, 16, 10, 1, -12}, // 0xBF '\xBF'
+    {2080, 16, 21, 16, 0, -21}, // 0xC0 '\xC0'
+    {2121, 16, 21, 16, 0, -21}, // 0xC1 '\xC1'
+    {LCD_GLYPH_PLAIN | 2162, 16, 21, 16, 0, -21}, // 0xC2 '\xC2'
+    {LCD_GLYPH_PLAIN | 2204, 16, 21, 16, 0, -21}, // 0xC3 '\xC3'
+    {LCD_GLYPH_PLAIN | 2246, 16, 20, 16, 0, -20}, // 0xC4 '\xC4'
+    {2286, 16, 22, 16, 0, -22}, // 0xC5 '\xC5'
+    {2329, 21, 17, 22, -1, -17}, // 0xC6 '\xC6'
+    {2365, 14, 21, 16, 1, -17}, // 0xC7 '\xC7'
+    {2395, 11, 21, 14, 2, -21}, // 0xC8 '\xC8'
+    {2412, 11, 21, 14, 2, -21}, // 0xC9 '\xC9'
+    {2429, 11, 21, 14, 2, -21}, // 0xCA '\xCA'
+    {2447, 11, 20, 14, 2, -20}, // 0xCB '\xCB'
+    {2464, 6, 21, 7, -1, -21}, // 0xCC '\xCC'
+    {2471, 6, 21, 7, 2, -21}, // 0xCD '\xCD'
+    {2478, 8, 21, 7, -1, -21}, // 0xCE '\xCE'
+    {2486, 8, 20, 7, -1, -20}, // 0xCF '\xCF'
+    {2494, 17, 17, 19, 1, -17}, // 0xD0 '\xD0'
+    {LCD_GLYPH_PLAIN | 2528, 14, 21, 18, 2, -21}, // 0xD1 '\xD1'
+    {2565, 17, 21, 19, 1, -21}, // 0xD2 '\xD2'
+    {2606, 17, 21, 19, 1, -21}, // 0xD3 '\xD3'
+    {2647, 17, 21, 19, 1, -21}, // 0xD4 '\xD4'
+    {2689, 17, 21, 19, 1, -21}, // 0xD5 '\xD5'
+    {2732, 17, 20, 19, 1, -20}, // 0xD6 '\xD6'
+    {LCD_GLYPH_PLAIN | 2774, 10, 10, 14, 2, -13}, // 0xD7 '\xD7'
+    {LCD_GLYPH_PLAIN | 2787, 17, 18, 19, 1, -17}, // 0xD8 '\xD8'
+    {2826, 14, 21, 18, 2, -21}, // 0xD9 '\xD9'
+    {2847, 14, 21, 18, 2, -21}, // 0xDA '\xDA'
+    {2868, 14, 21, 18, 2, -21}, // 0xDB '\xDB'
+    {2890, 14, 20, 18, 2, -20}, // 0xDC '\xDC'
+    {2912, 15, 21, 15, 0, -21}, // 0xDD '\xDD'
+    {2942, 12, 17, 15, 2, -17}, // 0xDE '\xDE'
+    {LCD_GLYPH_PLAIN | 2964, 12, 17, 15, 2, -17}, // 0xDF '\xDF'
+    {LCD_GLYPH_PLAIN | 2990, 10, 17, 12, 1, -17}, // 0xE0 '\xE0'
+    {LCD_GLYPH_PLAIN | 3012, 10, 17, 12, 1, -17}, // 0xE1 '\xE1'
+    {LCD_GLYPH_PLAIN | 3034, 10, 17, 12, 1, -17}, // 0xE2 '\xE2'
+    {LCD_GLYPH_PLAIN | 3056, 10, 17, 12, 1, -17}, // 0xE3 '\xE3'
+    {LCD_GLYPH_PLAIN | 3078, 10, 17, 12, 1, -17}, // 0xE4 '\xE4'
+    {LCD_GLYPH_PLAIN | 3100, 10, 17, 12, 1, -17}, // 0xE5 '\xE5'
+    {LCD_GLYPH_PLAIN | 3122, 18, 12, 20, 1, -12}, // 0xE6 '\xE6'
+    {LCD_GLYPH_PLAIN | 3149, 10, 16, 11, 1, -12}, // 0xE7 '\xE7'
+    {LCD_GLYPH_PLAIN | 3169, 11, 17, 13, 1, -17}, // 0xE8 '\xE8'
+    {LCD_GLYPH_PLAIN | 3193, 11, 17, 13, 1, -17}, // 0xE9 '\xE9'
+    {LCD_GLYPH_PLAIN | 3217, 11, 17, 13, 1, -17}, // 0xEA '\xEA'
+    {LCD_GLYPH_PLAIN | 3241, 11, 17, 13, 1, -17}, // 0xEB '\xEB'
+    {3265, 5, 17, 6, -1, -17}, // 0xEC '\xEC'
+    {3273, 5, 17, 6, 1, -17}, // 0xED '\xED'
+    {3282, 7, 17, 6, -1, -17}, // 0xEE '\xEE'
+    {3292, 7, 17, 6, -1, -17}, // 0xEF '\xEF'
+    {LCD_GLYPH_PLAIN | 3300, 11, 17, 13, 1, -17}, // 0xF0 '\xF0'
+    {3324, 10, 17, 13, 2, -17}, // 0xF1 '\xF1'
+    {LCD_GLYPH_PLAIN | 3341, 11, 17, 13, 1, -17}, // 0xF2 '\xF2'
+    {LCD_GLYPH_PLAIN | 3365, 11, 17, 13, 1, -17}, // 0xF3 '\xF3'
+    {LCD_GLYPH_PLAIN | 3389, 11, 17, 13, 1, -17}, // 0xF4 '\xF4'
+    {LCD_GLYPH_PLAIN | 3413, 11, 17, 13, 1, -17}, // 0xF5 '\xF5'
+    {LCD_GLYPH_PLAIN | 3437, 11, 17, 13, 1, -17}, // 0xF6 '\xF6'
+    {3461, 12, 11, 14, 1, -13}, // 0xF7 '\xF7'
+    {LCD_GLYPH_PLAIN | 3472, 12, 14, 13, 1, -13}, // 0xF8 '\xF8'
+    {3493, 11, 17, 13, 1, -17}, // 0xF9 '\xF9'
+    {3511, 11, 17, 13, 1, -17}, // 0xFA '\xFA'
+    {3529, 11, 17, 13, 1, -17}, // 0xFB '\xFB'
+    {3548, 11, 17, 13, 1, -17}, // 0xFC '\xFC'
+    {LCD_GLYPH_PLAIN | 3566, 12, 21, 12, 0, -17}, // 0xFD '\xFD'
+    {3598, 10, 21, 13, 2, -17}, // 0xFE '\xFE'
+    {LCD_GLYPH_PLAIN | 3619, 12, 21, 12, 0, -17}, // 0xFF '\xFF'
+    {LCD_GLYPH_PLAIN | 3651, 9, 9, 14, 2, -12}, // 0x2022 '\u2022'
+    {3662, 14, 17, 14, 0, -17}}; // 0x20AC '\u20AC'
+
+// 2224 pairs kerned, 25 x 26 classes
+const uint8_t LatoLatin12ptKernLeft[] = {
+    0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 1, 0, 2, 3, 2, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 6, 0, 7, 5, 0, 8, 0, 0, 0, 9, 10, 11, 0, 0, 5,
+    12, 5, 13, 0, 14, 9, 4, 15, 10, 16, 17, 0, 6, 0, 0, 0,
+    0, 18, 19, 0, 0, 19, 20, 0, 18, 0, 0, 21, 0, 18, 18, 19,
+    19, 0, 22, 0, 0, 0, 23, 24, 21, 23, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 3, 0, 3, 5, 0, 1,
+    0, 25, 25, 0, 0, 0, 3, 0, 25, 1, 3, 0, 0, 0, 0, 6,
+    6, 6, 6, 6, 6, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0, 5,
+    0, 5, 5, 5, 5, 5, 0, 0, 9, 9, 9, 9, 16, 5, 0, 18,
+    18, 18, 18, 18, 18, 19, 0, 19, 19, 19, 19, 0, 0, 0, 0, 0,
+    18, 19, 19, 19, 19, 19, 0, 19, 0, 0, 0, 0, 0, 19, 0, 3,
+    0 };
+const uint8_t LatoLatin12ptKernRight[] = {
+    0, 0, 1, 0, 0, 0, 2, 1, 0, 0, 1, 0, 3, 4, 3, 2,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 5, 0, 0, 0, 6,
+    7, 2, 0, 7, 0, 0, 0, 7, 0, 0, 8, 0, 0, 0, 0, 7,
+    0, 7, 0, 0, 9, 10, 11, 12, 13, 14, 15, 0, 11, 0, 0, 0,
+    0, 16, 0, 17, 17, 17, 18, 19, 0, 0, 0, 0, 0, 5, 5, 17,
+    5, 17, 5, 20, 21, 5, 22, 23, 24, 22, 25, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 4, 0, 4, 0, 0, 1,
+    0, 26, 26, 0, 5, 0, 4, 0, 26, 1, 4, 0, 0, 0, 0, 2,
+    2, 2, 2, 2, 2, 2, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 7, 7, 7, 7, 7, 0, 7, 10, 10, 10, 10, 14, 0, 0, 16,
+    16, 16, 16, 16, 16, 16, 17, 17, 17, 17, 17, 0, 0, 0, 0, 17,
+    5, 17, 17, 17, 17, 17, 0, 17, 5, 5, 5, 5, 0, 0, 0, 4,
+    0 };
+const int8_t LatoLatin12ptKernAdjust[] = {
+    0, -2, -3, -2, 0, 0, -1, 0, 0, 0, 1, 1, 0, 0, 0, -1,
+    -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, -2, 0, 0,
+    -1, 0, -2, 0, -2, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, -2,
+    -1, 0, 0, 0, -2, -1, -2, 0, 0, 0, 0, 0, -2, 0, -1, 0,
+    -1, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, -2,
+    -2, -1, -1, 1, -1, -2, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0,
+    -2, -1, -1, -1, 0, -1, -1, 1, -1, -1, -1, 0, 0, 0, 0, 0,
+    -1, 0, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, -1, 0, -1, -1, 1, -2, -1, -2, -1, 0, -2,
+    0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -2, 0, 0, 0, -2,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -2, -2, 0, -1, 0, 0, -2, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1,
+    -1, 0, 0, 0, -3, 0, 1, -2, 0, -1, -1, 0, -2, 0, -2, -2,
+    0, -3, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -2, 0, -2,
+    -3, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0,
+    -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, -2, -2, -2, 0, -1, -2, 0, 0, 0, 0, 0, 0,
+    0, -3, -3, 0, -2, -2, 0, -2, -2, -2, -1, 0, 1, -1, -1, 0,
+    0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1,
+    0, 0, 0, 0, 0, 1, 0, -2, -2, -2, -1, 0, -1, -2, 0, 0,
+    0, 0, 0, 0, 0, -2, -2, 0, -2, -2, 0, -1, -1, -2, 0, 1,
+    0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 1, 0,
+    -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+
+const LCD_Kerning LatoLatin12ptKerning = { LatoLatin12ptKernLeft, LatoLatin12ptKernRight, LatoLatin12ptKernAdjust, 26 };
+
+const LCD_GlyphRange LatoLatin12ptRanges[] = {
+    {0x20, 0x7E, 0},
+    {0xA0, 0xFF, 95},
+    {0x2022, 0x2022, 191},
+    {0x20AC, 0x20AC, 192} };
+
+const GFXfont LatoLatin12pt = { (uint8_t *)LatoLatin12ptBitmaps, (GFXglyph *)LatoLatin12ptGlyphs, 0x20, 0x20AC, 30, LCD_FONT_PACKED, LatoLatin12ptRanges, 4, &LatoLatin12ptKerning };
+
+// Approx. 6119 bytes
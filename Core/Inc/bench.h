@@ -0,0 +1,46 @@
+/**
+ * @file    bench.h
+ * @brief   Header file for throughput benchmarks of the LCD driver
+ */
+
+/**
+ ******************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2021 John Vedder
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************
+ */
+
+#ifndef _BENCH_H
+#define _BENCH_H
+
+/* Function prototypes */
+void BENCH_Run( void );
+void BENCH_Transport( void );
+void BENCH_FillScreen( void );
+void BENCH_Blit( void );
+void BENCH_Text( void );
+void BENCH_Format( void );
+void BENCH_Lines( void );
+void BENCH_Shapes( void );
+void BENCH_Chart( void );
+
+#endif // _BENCH_H
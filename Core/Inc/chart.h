@@ -0,0 +1,72 @@
+/**
+ * @file    chart.h
+ * @brief   Header file for the strip chart: live traces scrolled along the
+ *          time axis by the panel's hardware vertical scrolling
+ */
+/**
+ ******************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2021 John Vedder
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************
+ */
+
+#ifndef _CHART_H
+#define _CHART_H
+
+/*
+ * The chart runs in rotation 1, where the panel's vertical scrolling moves
+ * the picture left. The plot is a ring of columns between a fixed left
+ * margin (for the axis labels) and a fixed right one. A new sample is
+ * drawn as one column, in one address window, over the oldest column,
+ * which then scrolls in at the right edge: 480 bytes of pixels per sample
+ * however wide the plot is. Each trace is joined to its previous sample by
+ * a vertical run, so steep edges stay connected.
+ *
+ * With CHART_autoscale set, a sample out of range doubles the range until
+ * it fits and the plot is redrawn from the history at the new scale. The
+ * history holds the plotted row of each trace in each column:
+ *
+ *      history     CHART_MAX_TRACES * LCD_HEIGHT bytes   (640)
+ */
+#ifndef CHART_MAX_TRACES
+#define CHART_MAX_TRACES    2       // Most traces
+#endif
+#ifndef CHART_CHUNK
+#define CHART_CHUNK         48      // Pixels of a column composited at a time
+#endif
+
+#define CHART_HEIGHT        LCD_WIDTH   // Plot height in pixels
+#define CHART_NONE          0xFF        // No trace, or no sample in a column
+
+extern uint8_t CHART_autoscale; // If set, the range grows to fit the samples
+
+/* Function prototypes */
+void CHART_Open( uint16_t left, uint16_t right, uint16_t bgcolor,
+        uint16_t gridcolor );
+void CHART_Close( void );
+void CHART_SetRange( int16_t min, int16_t max, int16_t step );
+void CHART_SetGridX( uint16_t samples );
+uint8_t CHART_AddTrace( uint16_t color );
+void CHART_Plot( const int16_t *values );
+void CHART_Redraw( void );
+
+#endif // _CHART_H
@@ -0,0 +1,59 @@
+/**
+ * @file    console.h
+ * @brief   Header file for the scrolling text console: new lines scroll the
+ *          panel with VSCRDEF/VSCRSADD instead of redrawing it
+ */
+/**
+ ******************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2021 John Vedder
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************
+ */
+
+#ifndef _CONSOLE_H
+#define _CONSOLE_H
+
+/*
+ * The console is a ring of text lines in panel memory. The panel's
+ * vertical scrolling area shows them starting from any line, so a new
+ * line is made by clearing the line that scrolls off the top, writing it
+ * at the bottom and moving the scroll start address: one line of pixels,
+ * not a full repaint. Fixed header and footer areas above and below are
+ * left alone and may be drawn as usual.
+ *
+ * The panel scrolls along its 320 pixel height, so the console works in
+ * rotation 0, which CON_Open() selects, and the rest of the display must
+ * not be drawn while it is scrolled. CON_Close() ends the scrolling.
+ * Glyphs must fit within the font's yAdvance.
+ */
+
+extern uint8_t CON_open;        // Set while the console is open
+
+/* Function prototypes */
+void CON_Open( uint16_t top, uint16_t bottom, uint16_t color,
+        uint16_t bgcolor );
+void CON_Close( void );
+void CON_Clear( void );
+void CON_PutChar( uint8_t c );
+void CON_Write( const uint8_t *text );
+
+#endif // _CONSOLE_H
@@ -0,0 +1,69 @@
+/**
+ * @file    dirty.h
+ * @brief   Header file for the dirty rectangle tracker
+ */
+
+/**
+ ******************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2021 John Vedder
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************
+ */
+
+#ifndef _DIRTY_H
+#define _DIRTY_H
+
+/*
+ * Repainting a rectangle costs a window setup (CASET, PASET and RAMWR,
+ * 11 bytes) plus 2 bytes per pixel. Two rectangles are merged into their
+ * bounding box whenever that is no dearer than repainting both. Raise
+ * DIRTY_SETUP_BYTES to also account for the CPU time of a window setup,
+ * which favors fewer, larger rectangles.
+ */
+#ifndef DIRTY_MAX_RECTS
+#define DIRTY_MAX_RECTS     8       // Most rectangles in a repaint list
+#endif
+#ifndef DIRTY_SETUP_BYTES
+#define DIRTY_SETUP_BYTES   11      // Cost of a window setup in SPI bytes
+#endif
+
+/**
+ * Repaint cost of the last frame, see DIRTY_EndFrame()
+ */
+typedef struct
+{
+    uint16_t requests;          // Rectangles added
+    uint8_t rects;              // Rectangles in the repaint list
+    uint32_t bytesRequested;    // SPI bytes to repaint each added rectangle
+    uint32_t bytesRepaint;      // SPI bytes to repaint the repaint list
+    int32_t bytesSaved;         // The difference
+} DIRTY_Stats;
+
+extern DIRTY_Stats DIRTY_stats;     // Repaint cost of the last frame
+
+/* Function prototypes */
+void DIRTY_Add( int16_t x, int16_t y, int16_t w, int16_t h );
+void DIRTY_AddAll( void );
+uint8_t DIRTY_GetRects( const LCD_Rect **rects );
+void DIRTY_EndFrame( void );
+
+#endif // _DIRTY_H
@@ -0,0 +1,74 @@
+/**
+ * @file    dlist.h
+ * @brief   Header file for the display list renderer
+ */
+
+/**
+ ******************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2021 John Vedder
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************
+ */
+
+#ifndef _DLIST_H
+#define _DLIST_H
+
+/*
+ * A full 240x320 frame buffer needs 150 KB, the F030R8 has 8 KB of RAM. So
+ * the display list renders the dirty rectangles (see dirty.h) in bands,
+ * one at a time, in a band buffer that holds DLIST_BAND_ROWS rows of the
+ * widest rotation. Narrower rectangles get taller bands. The RAM cost is
+ * fixed:
+ *
+ *      band buffer     2 * DLIST_BAND_ROWS * LCD_HEIGHT bytes  (2560)
+ *      items           24 * DLIST_MAX_ITEMS bytes              (576)
+ *      dirty rects     8 * ( DIRTY_MAX_RECTS + 1 ) bytes       (72)
+ *
+ * Define DLIST_BAND_ROWS or DLIST_MAX_ITEMS (e.g. in the compiler settings)
+ * to trade RAM for fewer window setups or more items.
+ */
+#ifndef DLIST_BAND_ROWS
+#define DLIST_BAND_ROWS     4       // Height of a full width band in rows
+#endif
+#ifndef DLIST_MAX_ITEMS
+#define DLIST_MAX_ITEMS     24      // Capacity of the display list
+#endif
+
+#define DLIST_NONE          0xFF    // Returned when the display list is full
+
+/* Function prototypes */
+void DLIST_Clear( void );
+void DLIST_SetBackground( uint16_t color );
+uint8_t DLIST_AddFillRect( int16_t x, int16_t y, int16_t w, int16_t h,
+        uint16_t color );
+uint8_t DLIST_AddRect( int16_t x, int16_t y, int16_t w, int16_t h,
+        uint16_t color );
+uint8_t DLIST_AddLine( int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+        uint16_t color );
+uint8_t DLIST_AddText( int16_t x, int16_t y, const uint8_t *text,
+        uint16_t color );
+void DLIST_SetColor( uint8_t item, uint16_t color );
+void DLIST_Invalidate( int16_t x, int16_t y, int16_t w, int16_t h );
+void DLIST_InvalidateAll( void );
+void DLIST_Render( void );
+
+#endif // _DLIST_H
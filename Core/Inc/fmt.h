@@ -0,0 +1,69 @@
+/**
+ * @file    fmt.h
+ * @brief   Header file for the lightweight formatter shared by the UART and
+ *          the LCD
+ */
+
+/**
+ ******************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2021 John Vedder
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************
+ */
+
+#ifndef _FMT_H
+#define _FMT_H
+
+#include <stdarg.h>
+
+/*
+ * A small printf for integers and fixed point, without newlib's vfprintf
+ * or a buffer: each character is passed to a FMT_PutFunc as it is made,
+ * so the same formatting feeds the UART (FMT_Printf), the display
+ * (LCD_Printf) or a string (FMT_Format).
+ *
+ * Conversions are %d %i %u %x %X %c %s and %%, with the flags '-', '0',
+ * '+', ' ' and '#', a width, a precision and the length modifiers hh, h,
+ * l, ll, j, z and t, where * takes a width or precision from the
+ * arguments, all as in printf. There is no floating point. Instead the
+ * '\'' flag, grouping in POSIX, makes the precision on %d, %i or %u the
+ * number of decimal places of a fixed point value: "%'.2d" of 1234 is
+ * "12.34". Other printf conversions are shown as they are written, with
+ * their flags and width, and their arguments skipped. Numbers are
+ * converted by subtracting powers of ten, as the Cortex-M0 cannot divide.
+ */
+
+/**
+ * Takes one character of formatted output
+ */
+typedef void (*FMT_PutFunc)( uint8_t c );
+
+/* Function prototypes */
+uint16_t FMT_VPrint( FMT_PutFunc put, const char *format, va_list args );
+uint16_t FMT_Print( FMT_PutFunc put, const char *format, ... )
+        __attribute__(( format( printf, 2, 3 ) ));
+uint16_t FMT_Printf( const char *format, ... )
+        __attribute__(( format( printf, 1, 2 ) ));
+uint16_t FMT_Format( char *buffer, uint16_t size, const char *format, ... )
+        __attribute__(( format( printf, 3, 4 ) ));
+
+#endif // _FMT_H
@@ -37,6 +37,8 @@
 #define LCD_WIDTH       240     // ILI9341 max TFT width
 #define LCD_HEIGHT      320     // ILI9341 max TFT height
 
+#define LCD_DMA_MIN_PIXELS  16  // Shorter pixel runs are not worth a DMA setup
+
 #define ILI9341_NOP     0x00    // No-op register
 #define ILI9341_SWRESET 0x01    // Software reset register
 #define ILI9341_RDDID   0x04    // Read display identification information
@@ -69,6 +71,7 @@
 #define ILI9341_MADCTL  0x36    // Memory Access Control
 #define ILI9341_VSCRSADD 0x37   // Vertical Scrolling Start Address
 #define ILI9341_PIXFMT  0x3A    // COLMOD: Pixel Format Set
+#define ILI9341_RAMWRC  0x3C    // Write Memory Continue
 
 #define ILI9341_FRMCTR1 0xB1    // Frame Rate Control (In Normal Mode/Full Colors)
 #define ILI9341_FRMCTR2 0xB2    // Frame Rate Control (In Idle Mode/8 colors)
@@ -127,6 +130,29 @@ typedef struct
     int8_t yOffset;      // Y dist from cursor pos to UL corner
 } GFXglyph;
 
+/**
+ * A range of consecutive characters of a font with sparse ranges
+ */
+typedef struct
+{
+    uint16_t first;     // First character (Unicode code point) of the range
+    uint16_t last;      // Last character of the range
+    uint16_t glyph;     // Index in GFXfont->glyph of the glyph of 'first'
+} LCD_GlyphRange;
+
+/**
+ * Pair kerning of a font by classes: each glyph has a class as the first
+ * and as the second character of a pair, and each pair of classes an
+ * adjustment. Class 0 is never kerned.
+ */
+typedef struct
+{
+    const uint8_t *left;    // Class of each glyph as the first character
+    const uint8_t *right;   // Class of each glyph as the second character
+    const int8_t *adjust;   // Pixels added to the advance, rightClasses per left class
+    uint8_t rightClasses;   // Number of right classes, not counting 0
+} LCD_Kerning;
+
 /**
  * Data stored for FONT AS A WHOLE
  */
@@ -137,8 +163,85 @@ typedef struct
     uint16_t first;     // ASCII extents (first char)
     uint16_t last;      // ASCII extents (last char)
     uint8_t yAdvance;  // Newline distance (y axis)
+    uint8_t flags;      // LCD_FONT_PACKED, 0 for the GFX fonts
+    const LCD_GlyphRange *ranges;   // Sorted character ranges, NULL for the one range first..last
+    uint8_t rangeCount; // Number of ranges
+    const LCD_Kerning *kerning;     // Pair kerning, NULL for none
 } GFXfont;
 
+#define LCD_UTF8_INVALID    0xFFFD  // Decoded from a malformed UTF-8 sequence or past U+FFFF
+
+/*
+ * A packed font, as written by Tools/fontpack, has the glyph table of a
+ * GFX font but its glyphs are run-length encoded in 4-bit codes, MSB
+ * first, each glyph from a byte boundary, row by row:
+ *
+ *  - A row is a sequence of run lengths 0 to 14 that alternate between
+ *    clear and set pixels, starting with clear ones, and add up to the
+ *    glyph width. A run longer than 14 is split by runs of 0 of the
+ *    other color: 20 set pixels are 14, 0, 6.
+ *  - A row starting with 15 repeats the previous row 1 to 16 times, the
+ *    next code plus 1.
+ *
+ * A glyph that would not be smaller packed is stored as plain GFX bits,
+ * marked by LCD_GLYPH_PLAIN in its bitmapOffset.
+ */
+#define LCD_FONT_PACKED     0x01    // GFXfont flag, the glyphs are packed
+#define LCD_GLYPH_PLAIN     0x8000  // bitmapOffset flag of a plain glyph in a packed font
+#define LCD_GLYPH_LONG_RUN  14      // Longest run length of a code
+#define LCD_GLYPH_REPEAT    15      // Code of a repeated row
+
+/**
+ * Reads the pixels of a glyph of a plain or a packed font as runs along
+ * its rows, see LCD_OpenGlyph(). It can be copied to read a row again.
+ */
+typedef struct
+{
+    const uint8_t *data;    // Bitmap of the glyph
+    uint16_t pos;           // Next bit (plain) or code (packed) of data
+    uint16_t rowPos;        // Code of the row being repeated
+    uint16_t resume;        // Code after the repeat, 0 if none
+    uint8_t width;          // Glyph width in pixels
+    uint8_t col;            // Column of the next run
+    uint8_t repeat;         // Repeats of the row still to read
+    uint8_t packed;         // Non-zero if data is packed
+    uint8_t set;            // Color of the next packed run, 0x80 if set
+} LCD_GlyphReader;
+
+/**
+ * Called from interrupt context when a DMA transfer to the display completes
+ */
+typedef void (*LCD_DMACallback)( void );
+
+/**
+ * A rectangle in display coordinates
+ */
+typedef struct
+{
+    int16_t x;
+    int16_t y;
+    int16_t w;
+    int16_t h;
+} LCD_Rect;
+
+/**
+ * Receives the spans of a rasterized primitive, see LCD_RasterLine().
+ * Takes the same arguments as LCD_WriteFillRectPreclipped().
+ */
+typedef void (*LCD_SpanFunc)( int16_t x, int16_t y, int16_t w, int16_t h,
+        uint16_t color );
+
+/**
+ * Display traffic counters, cleared by LCD_ResetStats()
+ */
+typedef struct
+{
+    uint32_t transactions;  // SPI transactions (CS assertions)
+    uint32_t cmdBytes;      // Command and parameter bytes sent
+    uint32_t cmdBytesSaved; // Command and parameter bytes elided by the address window tracking
+    uint32_t pixels;        // Pixels sent
+} LCD_Stats;
+
 /**
  * Pointer to font data structure
  */
@@ -146,6 +249,7 @@ extern const GFXfont *LCD_font;
 extern const GFXfont FreeMono12pt7b;
 extern const GFXfont FreeSans12pt7b;
 extern const GFXfont FreeSerif12pt7b;
+extern const GFXfont LatoLatin12pt;
 
 extern uint8_t LCD_rotation;    // Display rotation (0 thru 3)
 extern uint16_t LCD_width;      // Display width as modified by current rotation
@@ -153,11 +257,14 @@ extern uint16_t LCD_height;    // Display height as modified by current rotation
 
 extern int16_t LCD_cursor_x;       // x location to start print()ing text
 extern int16_t LCD_cursor_y;       // y location to start print()ing text
-extern uint16_t LCD_textcolor;     // 16-bit background color for print()
-extern uint16_t LCD_textbgcolor;   // 16-bit text color for print()
+extern uint16_t LCD_textcolor;     // 16-bit text color for print()
+extern uint16_t LCD_textbgcolor;   // 16-bit background color for print(), transparent if LCD_textcolor
 extern uint8_t LCD_textsize_x;  // Desired magnification in X-axis of text to print()
 extern uint8_t LCD_textsize_y;  // Desired magnification in Y-axis of text to print()
 extern uint8_t LCD_wrap;         // If set, 'wrap' text at right edge of display
+extern uint8_t LCD_useDMA;       // If set, long pixel runs are sent by DMA
+extern uint8_t LCD_glyphSpans;   // If set, glyphs are drawn in spans rather than pixel by pixel
+extern LCD_Stats LCD_stats;     // Display traffic counters
 
 /**
  * Public Method Definitions
@@ -168,10 +275,27 @@ void LCD_SetRotation( uint8_t m );
 void LCD_InvertDisplay( uint8_t invert );
 void LCD_ScrollTo( uint16_t y );
 void LCD_SetScrollMargins( uint16_t top, uint16_t bottom );
+void LCD_ResetStats( void );
+void LCD_StartWrite( void );
+void LCD_EndWrite( void );
 void LCD_SetAddrWindow( uint16_t x1, uint16_t y1, uint16_t w, uint16_t h );
 void LCD_WriteColor( uint16_t color, uint32_t len );
+void LCD_ContinueColor( uint16_t color, uint32_t len );
+void LCD_WriteColorDMA( uint16_t color, uint32_t len, LCD_DMACallback callback );
+void LCD_WritePixelsDMA( const uint16_t *pixels, uint32_t len,
+        LCD_DMACallback callback );
+void LCD_WritePixels( const uint16_t *pixels, uint32_t len );
+void LCD_ContinuePixels( const uint16_t *pixels, uint32_t len );
+void LCD_ContinuePixelsDMA( const uint16_t *pixels, uint32_t len,
+        LCD_DMACallback callback );
+uint8_t LCD_IsBusy( void );
+void LCD_WaitDMA( void );
 void LCD_WriteFillRectPreclipped( int16_t x, int16_t y, int16_t w, int16_t h,
         uint16_t color );
+void LCD_WriteLine( int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+        uint16_t color );
+void LCD_RasterLine( int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+        uint16_t color, const LCD_Rect *clip, LCD_SpanFunc span );
 void LCD_DrawPixel( int16_t x, int16_t y, uint16_t color );
 void LCD_DrawFillRect( int16_t x, int16_t y, int16_t w, int16_t h,
         uint16_t color );
@@ -185,9 +309,31 @@ void LCD_FillScreen( uint16_t color );
 void LCD_SetTextSize( uint8_t size_x, uint8_t size_y );
 void LCD_SetCursor( uint8_t curs_x, uint8_t curs_y );
 void LCD_SetTextColor( uint16_t color );
-void LCD_WriteChar( int16_t x, int16_t y, unsigned char c, uint16_t color,
+void LCD_SetTextColors( uint16_t color, uint16_t bgcolor );
+void LCD_WriteChar( int16_t x, int16_t y, uint16_t c, uint16_t color,
         uint8_t size_x, uint8_t size_y );
-void LCD_DrawChar( uint8_t c );
+void LCD_WriteGlyphSpans( int16_t x, int16_t y, const GFXfont *font,
+        const GFXglyph *glyph, uint16_t color, uint8_t size_x, uint8_t size_y );
+void LCD_OpenGlyph( LCD_GlyphReader *reader, const GFXfont *font,
+        const GFXglyph *glyph );
+uint8_t LCD_ReadGlyphRun( LCD_GlyphReader *reader, uint8_t *set );
+void LCD_SkipGlyphRows( LCD_GlyphReader *reader, uint8_t rows );
+const GFXglyph *LCD_GetGlyph( const GFXfont *font, uint16_t c );
+uint16_t LCD_GetGlyphCount( const GFXfont *font );
+void LCD_GetFontExtent( const GFXfont *font, uint16_t *ascent,
+        uint16_t *descent );
+int8_t LCD_GetKerning( const GFXfont *font, const GFXglyph *left,
+        const GFXglyph *right );
+void LCD_DrawChar( uint16_t c );
 void LCD_DrawText( const uint8_t *text );
+uint16_t LCD_DecodeUTF8( const uint8_t **text );
+uint16_t LCD_NextChar( const uint8_t **text, uint8_t utf8 );
+void LCD_DrawTextUTF8( const uint8_t *text );
+uint16_t LCD_Printf( const char *format, ... )
+        __attribute__(( format( printf, 1, 2 ) ));
+void LCD_GetTextBounds( int16_t x, int16_t y, const uint8_t *text,
+        LCD_Rect *bounds );
+void LCD_GetTextBoundsUTF8( int16_t x, int16_t y, const uint8_t *text,
+        LCD_Rect *bounds );
 
 #endif // _LCD_H
@@ -0,0 +1,75 @@
+/**
+ * @file    lcd_aafont.h
+ * @brief   Header file for the anti-aliased fonts: 1, 2 or 4 bits of
+ *          coverage per glyph pixel, blended against the background
+ */
+/**
+ ******************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2021 John Vedder
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************
+ */
+
+#ifndef _LCD_AAFONT_H
+#define _LCD_AAFONT_H
+
+/*
+ * An anti-aliased font has the glyph table of a GFX font, but each glyph
+ * pixel is a coverage level of 'bpp' bits, packed MSB first in rows, each
+ * glyph from a byte boundary. Tools/fontconv converts TrueType fonts.
+ *
+ * The levels are blended between LCD_textbgcolor and the text color
+ * through a ramp of RGB565 colors, computed once per pair of colors, so a
+ * glyph pixel costs a table lookup. Each glyph is drawn opaque, its whole
+ * bounding box in one address window, in chunks of LCD_AA_CHUNK pixels
+ * (2 * LCD_AA_CHUNK bytes of RAM).
+ */
+#ifndef LCD_AA_CHUNK
+#define LCD_AA_CHUNK        64      // Pixels decoded at a time
+#endif
+
+/**
+ * An anti-aliased font, as written by Tools/fontconv
+ */
+typedef struct
+{
+    const uint8_t *bitmap;  // Coverage levels of the glyphs, concatenated
+    const GFXglyph *glyph;  // Glyph array
+    uint16_t first;         // First character
+    uint16_t last;          // Last character
+    uint8_t yAdvance;       // Newline distance (y axis)
+    uint8_t bpp;            // Bits per coverage level: 1, 2 or 4
+} LCD_AAFont;
+
+extern const LCD_AAFont Lato12pt2b;
+
+/* Function prototypes */
+void LCD_SetAARamp( uint16_t color, uint16_t bgcolor, uint8_t bpp );
+void LCD_GetAAPixels( const LCD_AAFont *font, uint8_t c, uint16_t index,
+        uint16_t count, uint16_t *pixels );
+void LCD_DrawAAChar( int16_t x, int16_t y, const LCD_AAFont *font, uint8_t c,
+        uint16_t color );
+int16_t LCD_DrawAAText( int16_t x, int16_t y, const LCD_AAFont *font,
+        const uint8_t *text, uint16_t color );
+uint16_t LCD_GetAATextWidth( const LCD_AAFont *font, const uint8_t *text );
+
+#endif // _LCD_AAFONT_H
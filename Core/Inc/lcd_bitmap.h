@@ -0,0 +1,83 @@
+/**
+ * @file    lcd_bitmap.h
+ * @brief   Header file for the bitmap blits of the ILI9341 LCD driver
+ */
+
+/**
+ ******************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2021 John Vedder
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************
+ */
+
+#ifndef _LCD_BITMAP_H
+#define _LCD_BITMAP_H
+
+/*
+ * Each bitmap is sent through one address window, clipped to the display.
+ * Indexed bitmaps are expanded through their palette in chunks of
+ * LCD_BITMAP_CHUNK pixels, into two buffers so one can be filled while the
+ * DMA sends the other (4 * LCD_BITMAP_CHUNK bytes of RAM).
+ */
+#ifndef LCD_BITMAP_CHUNK
+#define LCD_BITMAP_CHUNK    64      // Pixels expanded at a time
+#endif
+
+/*
+ * Compressed images: the pixels are palette indexes, run-length encoded in
+ * one stream from the top left, row after row. Each packet starts with a
+ * control byte:
+ *
+ *      0nnnnnnn                    n+1 literal pixels, packed 'bpp' bits
+ *                                  each MSB first, padded to a whole byte
+ *      10nnnnnn i                  n+1 pixels of index i (1 to 64)
+ *      11nnnnnn nnnnnnnn i         n+1 pixels of index i (1 to 16384)
+ *
+ * Runs are sent as a streamed color, with no buffer, so large areas of one
+ * color cost a few bytes of flash and draw at fill speed. Tools/imgconv
+ * converts PNG files to this format.
+ */
+#define LCD_IMAGE_RUN       0x80    // Control byte of a run
+#define LCD_IMAGE_LONG_RUN  0x40    // Run length has a second byte
+
+/**
+ * A compressed image, as written by Tools/imgconv
+ */
+typedef struct
+{
+    const uint16_t *palette;    // 16-bit 5-6-5 colors of the indexes
+    const uint8_t *data;        // The packets
+    uint16_t width;             // Width in pixels
+    uint16_t height;            // Height in pixels
+    uint8_t bpp;                // Bits per literal index: 1, 2, 4 or 8
+} LCD_Image;
+
+/* Function prototypes */
+void LCD_DrawRGBBitmap( int16_t x, int16_t y, const uint16_t *bitmap,
+        int16_t w, int16_t h );
+void LCD_DrawBitmap( int16_t x, int16_t y, const uint8_t *bitmap, int16_t w,
+        int16_t h, uint16_t color, uint16_t bg );
+void LCD_DrawIndexedBitmap( int16_t x, int16_t y, const uint8_t *bitmap,
+        int16_t w, int16_t h, uint8_t bpp, const uint16_t *palette );
+void LCD_DrawImage( int16_t x, int16_t y, const LCD_Image *image );
+
+#endif // _LCD_BITMAP_H
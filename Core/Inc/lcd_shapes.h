@@ -0,0 +1,84 @@
+/**
+ * @file    lcd_shapes.h
+ * @brief   Header file for the circles, ellipses, rounded rectangles,
+ *          triangles and polygons of the ILI9341 LCD driver
+ */
+
+/**
+ ******************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2021 John Vedder
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************
+ */
+
+#ifndef _LCD_SHAPES_H
+#define _LCD_SHAPES_H
+
+/*
+ * The shapes are rasterized into horizontal spans, clipped before anything
+ * is sent. Spans of consecutive rows that have the same extent, like the
+ * sides of a circle or the middle of a rounded rectangle, are merged into
+ * one rectangle, so each costs a single window setup and one streamed
+ * color.
+ */
+#ifndef LCD_POLY_MAX_CROSSINGS
+#define LCD_POLY_MAX_CROSSINGS  16  // Most polygon edges crossing one row
+#endif
+#define LCD_SHAPE_MAX_RADIUS    16383   // Largest circle or ellipse radius
+
+/**
+ * A vertex of a triangle or polygon
+ */
+typedef struct
+{
+    int16_t x;
+    int16_t y;
+} LCD_Point;
+
+/* Function prototypes */
+void LCD_RasterRoundRect( int16_t x, int16_t y, int16_t w, int16_t h,
+        int16_t rx, int16_t ry, uint8_t fill, uint16_t color,
+        const LCD_Rect *clip, LCD_SpanFunc span );
+void LCD_RasterTriangle( int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+        int16_t x2, int16_t y2, uint16_t color, const LCD_Rect *clip,
+        LCD_SpanFunc span );
+void LCD_RasterPolygon( const LCD_Point *points, uint8_t count,
+        uint16_t color, const LCD_Rect *clip, LCD_SpanFunc span );
+
+void LCD_DrawCircle( int16_t x0, int16_t y0, int16_t r, uint16_t color );
+void LCD_FillCircle( int16_t x0, int16_t y0, int16_t r, uint16_t color );
+void LCD_DrawEllipse( int16_t x0, int16_t y0, int16_t rx, int16_t ry,
+        uint16_t color );
+void LCD_FillEllipse( int16_t x0, int16_t y0, int16_t rx, int16_t ry,
+        uint16_t color );
+void LCD_DrawRoundRect( int16_t x, int16_t y, int16_t w, int16_t h,
+        int16_t r, uint16_t color );
+void LCD_FillRoundRect( int16_t x, int16_t y, int16_t w, int16_t h,
+        int16_t r, uint16_t color );
+void LCD_DrawTriangle( int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+        int16_t x2, int16_t y2, uint16_t color );
+void LCD_FillTriangle( int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+        int16_t x2, int16_t y2, uint16_t color );
+void LCD_DrawPolygon( const LCD_Point *points, uint8_t count, uint16_t color );
+void LCD_FillPolygon( const LCD_Point *points, uint8_t count, uint16_t color );
+
+#endif // _LCD_SHAPES_H
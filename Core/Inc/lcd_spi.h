@@ -0,0 +1,59 @@
+/**
+ * @file    lcd_spi.h
+ * @brief   Header file for the SPI transport used by the ILI9341 LCD driver
+ */
+
+/**
+ ******************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2021 John Vedder
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************
+ * Portions adapted from Adafruit Arduino Libraries. See LICENSE file.
+ ******************************************************************************
+ */
+
+
+#ifndef _LCD_SPI_H
+#define _LCD_SPI_H
+
+/*
+ * The transport writes the SPI1 and GPIO registers directly by default. The
+ * HAL functions do state checks, locking and timeout bookkeeping on every
+ * call, which costs more than sending a 1-byte command. Define LCD_SPI_HAL
+ * (e.g. in the compiler settings) to go through the HAL instead.
+ */
+#ifndef LCD_SPI_HAL
+#define LCD_SPI_DIRECT
+#endif
+
+/* Function prototypes */
+void LCD_SPI_Begin( void );
+void LCD_SPI_End( void );
+void LCD_SPI_Command( uint8_t cmd );
+void LCD_SPI_Data( const uint8_t *data, uint16_t len );
+void LCD_SPI_Color( uint16_t color, uint32_t len );
+void LCD_SPI_Pixels( const uint16_t *pixels, uint32_t len );
+void LCD_SPI_ColorDMA( uint16_t color, uint32_t len, LCD_DMACallback callback );
+void LCD_SPI_PixelsDMA( const uint16_t *pixels, uint32_t len,
+        LCD_DMACallback callback );
+
+#endif // _LCD_SPI_H
@@ -0,0 +1,136 @@
+/**
+ * @file    lcd_text.h
+ * @brief   Header file for text measurement and layout: word wrap,
+ *          alignment, ellipsis and clipped drawing
+ */
+/**
+ ******************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2021 John Vedder
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************
+ */
+
+#ifndef _LCD_TEXT_H
+#define _LCD_TEXT_H
+
+/*
+ * A layout breaks a string into lines that fit the width of a box, at
+ * spaces, or inside a word too long for a line, and at '\n'. It holds the
+ * offset, length and aligned x of each line, so it can be kept with a
+ * static label and drawn again without measuring the text again. It is
+ * valid while the text, the font and the box are unchanged.
+ * The text is not copied. It is ASCII or Latin-1, one byte a character,
+ * or UTF-8 with LCD_LAYOUT_UTF8, drawn as LCD_DrawTextUTF8() draws it.
+ */
+#ifndef LCD_LAYOUT_MAX_LINES
+#define LCD_LAYOUT_MAX_LINES    8       // Most lines in a layout
+#endif
+
+/*
+ * Layout flags
+ */
+#define LCD_ALIGN_LEFT          0x00
+#define LCD_ALIGN_CENTER        0x01
+#define LCD_ALIGN_RIGHT         0x02
+#define LCD_ALIGN_MASK          0x03
+#define LCD_LAYOUT_ELLIPSIS     0x04    // End the last line with "..." if the text does not fit
+#define LCD_LAYOUT_UTF8         0x08    // The text is UTF-8
+
+/**
+ * A line of a layout
+ */
+typedef struct
+{
+    uint16_t start;     // Offset of its first byte in the text
+    uint16_t length;    // Bytes drawn, without the spaces at its ends
+    int16_t x;          // Cursor x coordinate of its first character
+    uint16_t width;     // Advance width in pixels, with the ellipsis
+    uint8_t ellipsis;   // If set, "..." follows it
+} LCD_Line;
+
+/**
+ * Text laid out in a box
+ */
+typedef struct
+{
+    const uint8_t *text;    // The text, not copied
+    const GFXfont *font;    // LCD_font when laid out
+    LCD_Rect box;           // The box the lines fit in
+    uint8_t sizeX;          // LCD_textsize_x when laid out
+    uint8_t sizeY;          // LCD_textsize_y when laid out
+    uint8_t utf8;           // Set if the text is UTF-8
+    uint16_t lineHeight;    // Pixels from a baseline to the next one
+    uint16_t ascent;        // Pixels from the top of a line to its baseline
+    uint8_t lines;          // Lines laid out
+    uint8_t truncated;      // Set if some of the text did not fit
+    uint16_t width;         // Width of the widest line in pixels
+    LCD_Line line[LCD_LAYOUT_MAX_LINES];
+} LCD_Layout;
+
+/*
+ * A text field shows a short string that changes, such as a readout, in
+ * opaque cells: each character's advance width by the font's full height.
+ * It remembers what it shows, and an update repaints only the cells whose
+ * character changed, each in one address window with its background.
+ * With a monospace font, a readout whose last digit changes costs one
+ * cell. With a proportional font, the cells after a change of width are
+ * repainted too. Glyphs are clipped to their cells, and not kerned, so a
+ * change does not move the cells around it.
+ */
+#ifndef LCD_FIELD_MAX
+#define LCD_FIELD_MAX           16      // Most characters in a text field
+#endif
+#ifndef LCD_FIELD_CHUNK
+#define LCD_FIELD_CHUNK         32      // Pixels of a cell composited at a time
+#endif
+
+/**
+ * A text field
+ */
+typedef struct
+{
+    const GFXfont *font;    // LCD_font when initialized
+    int16_t x;              // Cursor x coordinate of the first character
+    int16_t y;              // Cursor y coordinate (baseline)
+    int16_t top;            // Top row of the cells
+    uint16_t height;        // Height of the cells in pixels
+    uint16_t width;         // Width of the text shown in pixels
+    uint16_t color;         // 16-bit 5-6-5 Color of the text
+    uint16_t bgcolor;       // 16-bit 5-6-5 Color of the background
+    uint8_t sizeX;          // LCD_textsize_x when initialized
+    uint8_t sizeY;          // LCD_textsize_y when initialized
+    uint8_t length;         // Characters shown
+    uint8_t text[LCD_FIELD_MAX];
+} LCD_TextField;
+
+/* Function prototypes */
+uint16_t LCD_GetTextWidth( const uint8_t *text, uint16_t length );
+uint16_t LCD_GetTextWidthUTF8( const uint8_t *text, uint16_t length );
+void LCD_LayoutText( LCD_Layout *layout, const uint8_t *text,
+        const LCD_Rect *box, uint8_t flags );
+uint16_t LCD_GetLayoutHeight( const LCD_Layout *layout );
+void LCD_DrawLayout( const LCD_Layout *layout, const LCD_Rect *clip );
+void LCD_InitTextField( LCD_TextField *field, int16_t x, int16_t y,
+        uint16_t color, uint16_t bgcolor );
+void LCD_SetTextField( LCD_TextField *field, const uint8_t *text );
+
+#endif // _LCD_TEXT_H
@@ -0,0 +1,88 @@
+/**
+ * @file    sprite.h
+ * @brief   Header file for the sprites: small images moved over a background
+ *          that is restored from its source
+ */
+
+/**
+ ******************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2021 John Vedder
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************
+ */
+
+#ifndef _SPRITE_H
+#define _SPRITE_H
+
+/*
+ * Sprites are RGB565 bitmaps with a transparent color, drawn over a
+ * background that the module can regenerate: a solid color, a tile map or
+ * a callback. Nothing is ever erased, each repainted pixel is composited
+ * (background, then the sprites in the order they were added) and written
+ * once. When a sprite moves, only its new area and the part of the old one
+ * it uncovered are repainted. The RAM cost is fixed:
+ *
+ *      compositing buffer  2 * SPRITE_BUFFER_PIXELS bytes  (256)
+ *      sprites             20 * SPRITE_MAX bytes           (80)
+ */
+#ifndef SPRITE_MAX
+#define SPRITE_MAX              4       // Most sprites
+#endif
+#ifndef SPRITE_BUFFER_PIXELS
+#define SPRITE_BUFFER_PIXELS    128     // Pixels composited at a time
+#endif
+
+#define SPRITE_NONE             0xFF    // Returned when all sprites are in use
+
+/**
+ * Generates 'w' pixels of background from (x,y) to the right
+ */
+typedef void (*SPRITE_BackgroundFunc)( int16_t x, int16_t y, uint16_t w,
+        uint16_t *pixels );
+
+/**
+ * A background of tiles, repeated past its edges
+ */
+typedef struct
+{
+    const uint16_t *tiles;  // RGB565 tiles of tileW x tileH pixels, one after the other
+    const uint8_t *map;     // Tile of each cell, in rows of 'cols'
+    uint8_t tileW;          // Tile width in pixels
+    uint8_t tileH;          // Tile height in pixels
+    uint8_t cols;           // Cells per row of the map
+    uint8_t rows;           // Rows of the map
+} SPRITE_TileMap;
+
+/* Function prototypes */
+void SPRITE_SetBackgroundColor( uint16_t color );
+void SPRITE_SetBackgroundTiles( const SPRITE_TileMap *map );
+void SPRITE_SetBackgroundFunc( SPRITE_BackgroundFunc func );
+uint8_t SPRITE_Add( const uint16_t *pixels, uint8_t w, uint8_t h,
+        uint16_t key );
+void SPRITE_Remove( uint8_t sprite );
+void SPRITE_SetPixels( uint8_t sprite, const uint16_t *pixels );
+void SPRITE_MoveTo( uint8_t sprite, int16_t x, int16_t y );
+void SPRITE_Show( uint8_t sprite, uint8_t visible );
+void SPRITE_Update( void );
+void SPRITE_Repaint( int16_t x, int16_t y, int16_t w, int16_t h );
+
+#endif // _SPRITE_H
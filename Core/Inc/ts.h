@@ -51,8 +51,13 @@
 #define FT6206_REG_X_LO         (0x04)  // X Low bits
 #define FT6206_REG_Y_HI         (0x05)  // Y High bits and flags
 #define FT6206_REG_Y_LO         (0x06)  // Y Low bits
+#define FT6206_REG_WEIGHT       (0x07)  // Touch weight
+#define FT6206_REG_MISC         (0x08)  // Touch area in the high bits
+#define FT6206_POINT_STRIDE     (0x06)  // Offset of the second point's registers
 
 #define FT6206_REG_THRESHHOLD   (0x80)  // Threshold for touch detection
+#define FT6206_REG_GMODE        (0xA4)  // Interrupt mode, polling or trigger
+#define FT6206_VAL_TRIGGERMODE  (0x01)  // INT pulses low once for each new report
 #define FT6206_REG_POINTRATE    (0x88)  // Point rate
 #define FT6206_REG_FIRMVERS     (0xA6)  // Firmware version
 #define FT6206_REG_CHIPID       (0xA3)  // Chip selecting
@@ -64,6 +69,37 @@
 // calibrated for Adafruit 2.8" Cap Touch Screen
 #define FT6206_DEFAULT_THRESHOLD  (128) // Default threshold for touch detection
 
+#define TS_MAX_POINTS           (2)     // Touch points the FT6206 tracks
+#define TS_DATA_SIZE            (FT6206_REG_MISC + FT6206_POINT_STRIDE + 1) // Registers read for each report
+#define TS_QUEUE_SIZE           (8)     // Events held for the main loop, a power of two
+
+#define TS_EVENT_DOWN           (0)     // The point has just touched
+#define TS_EVENT_UP             (1)     // The point has just been lifted
+#define TS_EVENT_CONTACT        (2)     // The point is still touching
+#define TS_EVENT_NONE           (3)     // No event
+
+/**
+ * One touch point, with the coordinates adjusted for the rotation.
+ */
+typedef struct
+{
+    uint16_t x;         // x coordinate of the touch
+    uint16_t y;         // y coordinate of the touch
+    uint8_t id;         // touch ID, the same for a finger from down to up
+    uint8_t event;      // TS_EVENT_DOWN, TS_EVENT_UP or TS_EVENT_CONTACT
+    uint8_t weight;     // touch weight (pressure)
+    uint8_t area;       // touch area
+} TS_Point;
+
+/**
+ * A touch report, all the points read in one burst.
+ */
+typedef struct
+{
+    uint8_t touched;    // number of points touching, zero when released
+    TS_Point points[TS_MAX_POINTS]; // the first touched points valid
+} TS_Event;
+
 /* Global variables */
 extern uint8_t TS_rotation;    // Display rotation (0 thru 3)
 extern uint16_t TS_width;       // Display width as modified by current rotation
@@ -73,9 +109,13 @@ extern uint8_t TS_isTouched;    // non-zero if touch screen is being touched
 extern uint16_t TS_touchX;  // x coordinate of current touch after accounting for current rotation
 extern uint16_t TS_touchY;  // y coordinate of current touch after accounting for current rotation
 
+extern TS_Event TS_touch;        // latest report, all of its points
+extern volatile uint8_t TS_dropped; // events lost to a full queue
+
 /* Function prototypes */
 int8_t TS_Init( uint8_t thresh );
 void TS_ReadData( void );
+uint8_t TS_GetEvent( TS_Event *event );
 void TS_SetRotation( uint8_t m );
 
 #endif // _TS_H
@@ -0,0 +1,736 @@
+/**
+ * @file    bench.c
+ * @brief   Throughput benchmarks of the LCD driver. Results are printed to
+ *          the ST-LINK serial port.
+ */
+
+/**
+ ******************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2021 John Vedder
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************
+ */
+
+#include "main.h"
+#include "lcd.h"
+#include "lcd_spi.h"
+#include "lcd_shapes.h"
+#include "lcd_bitmap.h"
+#include "lcd_aafont.h"
+#include "chart.h"
+#include "bench.h"
+#include "fmt.h"
+#include <stdio.h>
+
+#include "Fonts/FreeSans12pt7bPacked.h"
+
+#define BENCH_FILLS         4       // Number of full screen fills to time
+#define BENCH_TILE          64      // Width and height of the blit tile
+#define BENCH_TILE_ROWS     16      // Rows of the indexed bitmap, drawn down the tile
+#define BENCH_COMMANDS      4000    // Number of commands to time
+#define BENCH_PIXELS        76800   // Number of polled pixels to time
+#define BENCH_TEXT_REPEAT   3       // Number of times BENCH_text is drawn per font
+#define BENCH_DECODES       20      // Number of times the glyphs of BENCH_text are decoded
+#define BENCH_LINE_STEP     8       // Spacing of the end points of the line fan
+#define BENCH_SHAPES        16      // Number of each shape to time
+#define BENCH_STAR_POINTS   10      // Vertices of the star polygon
+#define BENCH_CHART_SAMPLES 320     // Samples plotted by the strip chart
+#define BENCH_CHART_REDRAWS 8       // Samples plotted by redrawing a whole chart
+#define BENCH_FORMATS       1000    // Number of touch readouts formatted
+#define BENCH_STACK_WORDS   256     // Words of stack painted below the caller to measure stack use
+#define BENCH_STACK_GAP     16      // Words left unpainted just below the caller
+#define BENCH_STACK_FILL    0xA5A5A5A5u
+
+#ifdef LCD_SPI_DIRECT
+#define BENCH_TRANSPORT     "direct"
+#else
+#define BENCH_TRANSPORT     "HAL"
+#endif
+
+/*
+ * Private Variables
+ */
+static const uint16_t BENCH_colors[] = { LCD_RED, LCD_GREEN, LCD_BLUE, LCD_WHITE };
+static const uint8_t BENCH_text[] = "The quick brown fox jumps over the lazy dog 0123456789";
+static const GFXfont *const BENCH_fonts[] = { &FreeMono12pt7b, &FreeSans12pt7b,
+        &FreeSans12pt7bPacked, &FreeSerif12pt7b, &LatoLatin12pt };
+static const char *const BENCH_fontNames[] = { "Mono", "Sans", "Sans packed", "Serif",
+        "Lato kerned" };
+static const char *const BENCH_shapeNames[] = { "Circle", "FillCircle", "Ellipse",
+        "FillEllipse", "RoundRect", "FillRoundRect", "Triangle", "FillTriangle",
+        "Polygon", "FillPolygon" };
+static const LCD_Point BENCH_star[BENCH_STAR_POINTS] = { { 0, -40 }, { 9, -12 },
+        { 38, -12 }, { 15, 5 }, { 24, 32 }, { 0, 15 }, { -24, 32 }, { -15, 5 },
+        { -38, -12 }, { -9, -12 } };
+static char BENCH_line[32];                             // Formatted readout
+static volatile int16_t BENCH_touch[2] = { 123, 45 };   // Readout values, not constants to fold
+
+/*
+ * Private Function Prototypes
+ */
+static void BENCH_Report( const char *name, uint32_t ms, uint32_t count,
+        const char *unit );
+static uint32_t BENCH_DrawText( void );
+static uint32_t BENCH_DrawAAText( const LCD_AAFont *font );
+static uint32_t BENCH_ReadGlyphs( const GFXfont *font );
+static uint32_t BENCH_LookUpGlyphs( const GFXfont *font, uint8_t kern );
+static void BENCH_DrawShape( uint8_t shape, int16_t x, int16_t y );
+static void BENCH_ReportCycles( const char *name, uint32_t ms, uint32_t count );
+static int16_t BENCH_Wave( int32_t sample, uint8_t trace );
+static void BENCH_FormatLibc( void );
+static void BENCH_FormatFmt( void );
+static uint32_t BENCH_StackUse( void (*func)( void ) );
+
+/*
+ *  -------------------
+ *  Public Functions
+ * -------------------
+ */
+
+/**
+ * Runs all of the benchmarks. The display is left filled with white.
+ */
+void BENCH_Run( void )
+{
+    printf( "BENCH: SPI payload is %u bytes per full screen\r\n",
+            (unsigned) ( 2u * LCD_width * LCD_height ) );
+    BENCH_Transport( );
+    BENCH_FillScreen( );
+    BENCH_Blit( );
+    BENCH_Text( );
+    BENCH_Format( );
+    BENCH_Lines( );
+    BENCH_Shapes( );
+    BENCH_Chart( );
+    LCD_FillScreen( LCD_WHITE );
+}
+
+/**
+ * Times the SPI transport selected in lcd_spi.h: a 1-byte command and a
+ * polled (non-DMA) pixel, reported in CPU cycles.
+ */
+void BENCH_Transport( void )
+{
+    uint8_t useDMA = LCD_useDMA;
+    uint32_t start;
+    uint16_t i;
+
+    start = HAL_GetTick( );
+    for ( i = 0; i < BENCH_COMMANDS; i++ )
+    {
+        LCD_InvertDisplay( 0 );
+    }
+    BENCH_ReportCycles( BENCH_TRANSPORT " command", HAL_GetTick( ) - start,
+            BENCH_COMMANDS );
+
+    LCD_useDMA = 0;
+    LCD_SetAddrWindow( 0, 0, LCD_width, LCD_height );
+    start = HAL_GetTick( );
+    LCD_WriteColor( LCD_BLACK, BENCH_PIXELS );
+    BENCH_ReportCycles( BENCH_TRANSPORT " pixel", HAL_GetTick( ) - start,
+            BENCH_PIXELS );
+    LCD_useDMA = useDMA;
+}
+
+/**
+ * Times LCD_FillScreen() polled, over the transport selected in lcd_spi.h
+ * (one HAL_SPI_Transmit() per pixel without LCD_SPI_DIRECT), then with DMA.
+ */
+void BENCH_FillScreen( void )
+{
+    uint8_t useDMA = LCD_useDMA;
+    uint32_t pixels = (uint32_t) LCD_width * LCD_height * BENCH_FILLS;
+    uint32_t start;
+    uint8_t i;
+
+    LCD_useDMA = 0;
+    start = HAL_GetTick( );
+    for ( i = 0; i < BENCH_FILLS; i++ )
+    {
+        LCD_FillScreen( BENCH_colors[i] );
+    }
+    BENCH_Report( "FillScreen polled " BENCH_TRANSPORT, HAL_GetTick( ) - start,
+            pixels, "pixels/s" );
+
+    LCD_useDMA = 1;
+    start = HAL_GetTick( );
+    for ( i = 0; i < BENCH_FILLS; i++ )
+    {
+        LCD_FillScreen( BENCH_colors[i] );
+    }
+    BENCH_Report( "FillScreen DMA", HAL_GetTick( ) - start, pixels,
+            "pixels/s" );
+
+    LCD_useDMA = useDMA;
+}
+
+/**
+ * Times a BENCH_TILE x BENCH_TILE image blit, one row at a time, using
+ * LCD_DrawPixel() and LCD_WritePixels(), then as 1, 2 and 4 bit indexed
+ * bitmaps. Their indexes are the bytes of a font bitmap, any flash will do.
+ */
+void BENCH_Blit( void )
+{
+    uint16_t row[BENCH_TILE];
+    uint16_t palette[16];
+    char name[32];
+    uint32_t start;
+    uint16_t x;
+    uint16_t y;
+    uint8_t bpp;
+
+    for ( x = 0; x < BENCH_TILE; x++ )
+    {
+        row[x] = (uint16_t) ( x << 11 );
+    }
+
+    start = HAL_GetTick( );
+    for ( y = 0; y < BENCH_TILE; y++ )
+    {
+        for ( x = 0; x < BENCH_TILE; x++ )
+        {
+            LCD_DrawPixel( x, y, row[x] );
+        }
+    }
+    BENCH_Report( "Blit DrawPixel", HAL_GetTick( ) - start,
+            BENCH_TILE * BENCH_TILE, "pixels/s" );
+
+    start = HAL_GetTick( );
+    for ( y = 0; y < BENCH_TILE; y++ )
+    {
+        LCD_SetAddrWindow( BENCH_TILE, y, BENCH_TILE, 1 );
+        LCD_WritePixels( row, BENCH_TILE );
+    }
+    BENCH_Report( "Blit WritePixels", HAL_GetTick( ) - start,
+            BENCH_TILE * BENCH_TILE, "pixels/s" );
+
+    for ( x = 0; x < 16; x++ )
+    {
+        palette[x] = row[x * 4];
+    }
+    for ( bpp = 1; bpp <= 4; bpp <<= 1 )
+    {
+        start = HAL_GetTick( );
+        for ( y = 0; y < BENCH_TILE; y += BENCH_TILE_ROWS )
+        {
+            LCD_DrawIndexedBitmap( 2 * BENCH_TILE, y, FreeMono12pt7b.bitmap,
+                    BENCH_TILE, BENCH_TILE_ROWS, bpp, palette );
+        }
+        snprintf( name, sizeof( name ), "Blit %ubpp bitmap", bpp );
+        BENCH_Report( name, HAL_GetTick( ) - start, BENCH_TILE * BENCH_TILE,
+                "pixels/s" );
+    }
+}
+
+/**
+ * Times text drawing in each of the 12pt fonts, FreeSans also packed,
+ * pixel by pixel and in spans with a transparent and an opaque background,
+ * and the decoding of the plain and packed glyphs alone, and the lookup of
+ * the glyphs with and without their kerning. Then the same in the
+ * anti-aliased font.
+ */
+void BENCH_Text( void )
+{
+    const GFXfont *font = LCD_font;
+    uint8_t glyphSpans = LCD_glyphSpans;
+    uint16_t textbgcolor = LCD_textbgcolor;
+    char name[32];
+    uint16_t pixels[LCD_AA_CHUNK];
+    const GFXglyph *glyph;
+    const uint8_t *c;
+    uint32_t start;
+    uint32_t chars;
+    uint16_t index;
+    uint16_t size;
+    uint8_t i;
+
+    LCD_SetTextColor( LCD_BLACK );
+    for ( i = 0; i < sizeof( BENCH_fonts ) / sizeof( BENCH_fonts[0] ); i++ )
+    {
+        LCD_font = BENCH_fonts[i];
+
+        LCD_glyphSpans = 0;
+        LCD_textbgcolor = LCD_textcolor;
+        start = HAL_GetTick( );
+        chars = BENCH_DrawText( );
+        snprintf( name, sizeof( name ), "Text %s pixels", BENCH_fontNames[i] );
+        BENCH_Report( name, HAL_GetTick( ) - start, chars, "chars/s" );
+
+        LCD_glyphSpans = 1;
+        start = HAL_GetTick( );
+        chars = BENCH_DrawText( );
+        snprintf( name, sizeof( name ), "Text %s spans", BENCH_fontNames[i] );
+        BENCH_Report( name, HAL_GetTick( ) - start, chars, "chars/s" );
+
+        LCD_textbgcolor = LCD_WHITE;
+        start = HAL_GetTick( );
+        chars = BENCH_DrawText( );
+        snprintf( name, sizeof( name ), "Text %s opaque", BENCH_fontNames[i] );
+        BENCH_Report( name, HAL_GetTick( ) - start, chars, "chars/s" );
+    }
+
+    // The glyphs read as runs, without drawing them
+    start = HAL_GetTick( );
+    chars = BENCH_ReadGlyphs( &FreeSans12pt7b );
+    BENCH_ReportCycles( "Glyph runs plain", HAL_GetTick( ) - start, chars );
+    start = HAL_GetTick( );
+    chars = BENCH_ReadGlyphs( &FreeSans12pt7bPacked );
+    BENCH_ReportCycles( "Glyph runs packed", HAL_GetTick( ) - start, chars );
+
+    // The glyphs looked up, and the pairs kerned, without drawing them
+    start = HAL_GetTick( );
+    chars = BENCH_LookUpGlyphs( &LatoLatin12pt, 0 );
+    BENCH_ReportCycles( "Glyph lookup", HAL_GetTick( ) - start, chars );
+    start = HAL_GetTick( );
+    chars = BENCH_LookUpGlyphs( &LatoLatin12pt, 1 );
+    BENCH_ReportCycles( "Glyph lookup kerned", HAL_GetTick( ) - start, chars );
+
+    LCD_textbgcolor = LCD_WHITE;
+    start = HAL_GetTick( );
+    chars = BENCH_DrawAAText( &Lato12pt2b );
+    BENCH_Report( "Text Lato 2bpp AA", HAL_GetTick( ) - start, chars, "chars/s" );
+
+    // The same glyphs decoded through the ramp, without drawing them
+    LCD_SetAARamp( LCD_BLACK, LCD_WHITE, Lato12pt2b.bpp );
+    chars = 0;
+    start = HAL_GetTick( );
+    for ( i = 0; i < BENCH_DECODES; i++ )
+    {
+        for ( c = BENCH_text; *c; c++, chars++ )
+        {
+            glyph = &Lato12pt2b.glyph[*c - Lato12pt2b.first];
+            size = glyph->width * glyph->height;
+            for ( index = 0; index < size; index += LCD_AA_CHUNK )
+            {
+                LCD_GetAAPixels( &Lato12pt2b, *c, index,
+                        ( size - index > LCD_AA_CHUNK ) ? LCD_AA_CHUNK : size - index,
+                        pixels );
+            }
+        }
+    }
+    BENCH_ReportCycles( "AA glyph decode", HAL_GetTick( ) - start, chars );
+
+    LCD_font = font;
+    LCD_glyphSpans = glyphSpans;
+    LCD_textbgcolor = textbgcolor;
+}
+
+/**
+ * Times formatting a touch readout with newlib's snprintf() and with
+ * FMT_Format() of fmt.h, and measures the stack each takes. Their flash
+ * is in the linker map: _svfprintf_r and the rest of newlib's printf
+ * against fmt.o.
+ */
+void BENCH_Format( void )
+{
+    uint32_t start;
+    uint16_t i;
+
+    start = HAL_GetTick( );
+    for ( i = 0; i < BENCH_FORMATS; i++ )
+    {
+        BENCH_FormatLibc( );
+    }
+    BENCH_ReportCycles( "Format snprintf", HAL_GetTick( ) - start, BENCH_FORMATS );
+    start = HAL_GetTick( );
+    for ( i = 0; i < BENCH_FORMATS; i++ )
+    {
+        BENCH_FormatFmt( );
+    }
+    BENCH_ReportCycles( "Format FMT_Format", HAL_GetTick( ) - start, BENCH_FORMATS );
+
+    printf( "BENCH: %-24s %6lu bytes\r\n", "Stack snprintf",
+            (unsigned long) BENCH_StackUse( BENCH_FormatLibc ) );
+    printf( "BENCH: %-24s %6lu bytes\r\n", "Stack FMT_Format",
+            (unsigned long) BENCH_StackUse( BENCH_FormatFmt ) );
+}
+
+/**
+ * Times a fan of sloped lines from the center of the display to points
+ * along its edges, and the same fan from a center far off screen so most
+ * of each line is clipped.
+ */
+void BENCH_Lines( void )
+{
+    int16_t cx = LCD_width / 2;
+    int16_t cy = LCD_height / 2;
+    uint32_t start;
+    uint32_t lines;
+    uint8_t pass;
+    int16_t i;
+
+    for ( pass = 0; pass < 2; pass++ )
+    {
+        lines = 0;
+        start = HAL_GetTick( );
+        for ( i = 1; i < LCD_width; i += BENCH_LINE_STEP )
+        {
+            LCD_DrawLine( cx, cy, i, 0, BENCH_colors[i & 3] );
+            LCD_DrawLine( cx, cy, i, LCD_height - 1, BENCH_colors[i & 3] );
+            lines += 2;
+        }
+        for ( i = 1; i < LCD_height; i += BENCH_LINE_STEP )
+        {
+            LCD_DrawLine( cx, cy, 0, i, BENCH_colors[i & 3] );
+            LCD_DrawLine( cx, cy, LCD_width - 1, i, BENCH_colors[i & 3] );
+            lines += 2;
+        }
+        BENCH_Report( pass ? "Lines clipped" : "Lines", HAL_GetTick( ) - start,
+                lines, "lines/s" );
+
+        // Second pass: from far off screen, most of each line is clipped
+        cx = -4 * LCD_width;
+        cy = -4 * LCD_height;
+    }
+}
+
+/**
+ * Times each of the shapes of lcd_shapes.h, about 80 pixels across, and
+ * reports the SPI bytes each one costs: commands, parameters and pixels.
+ */
+void BENCH_Shapes( void )
+{
+    char name[32];
+    uint32_t start;
+    uint32_t ms;
+    uint8_t shape;
+    uint8_t i;
+
+    for ( shape = 0;
+            shape < sizeof( BENCH_shapeNames ) / sizeof( BENCH_shapeNames[0] );
+            shape++ )
+    {
+        LCD_ResetStats( );
+        start = HAL_GetTick( );
+        for ( i = 0; i < BENCH_SHAPES; i++ )
+        {
+            BENCH_DrawShape( shape, 40 + ( i & 3 ) * ( LCD_width - 80 ) / 3,
+                    40 + ( i >> 2 ) * ( LCD_height - 80 ) / 3 );
+        }
+        ms = HAL_GetTick( ) - start;
+        BENCH_Report( BENCH_shapeNames[shape], ms, BENCH_SHAPES, "shapes/s" );
+        snprintf( name, sizeof( name ), "%s SPI bytes",
+                BENCH_shapeNames[shape] );
+        printf( "BENCH: %-24s %6lu bytes each\r\n", name,
+                (unsigned long) ( ( LCD_stats.cmdBytes + 2 * LCD_stats.pixels )
+                        / BENCH_SHAPES ) );
+    }
+}
+
+/**
+ * Times the strip chart of chart.h plotting two traces, against plotting
+ * each sample by redrawing a chart of the same size: a fill and a line
+ * through the samples of each trace. The rotation is restored.
+ */
+void BENCH_Chart( void )
+{
+    static const uint16_t colors[] = { LCD_YELLOW, LCD_CYAN };
+    uint8_t rotation = LCD_rotation;
+    int16_t values[2];
+    uint32_t start;
+    int32_t i;
+    int32_t x;
+    uint8_t t;
+
+    CHART_SetRange( -128, 127, 64 );
+    CHART_SetGridX( 32 );
+    CHART_Open( 0, 0, LCD_BLACK, LCD_DARKGREY );
+    CHART_AddTrace( colors[0] );
+    CHART_AddTrace( colors[1] );
+    LCD_ResetStats( );
+    start = HAL_GetTick( );
+    for ( i = 0; i < BENCH_CHART_SAMPLES; i++ )
+    {
+        values[0] = BENCH_Wave( i, 0 );
+        values[1] = BENCH_Wave( i, 1 );
+        CHART_Plot( values );
+    }
+    BENCH_Report( "Chart scrolled", HAL_GetTick( ) - start,
+            BENCH_CHART_SAMPLES, "samples/s" );
+    printf( "BENCH: %-24s %6lu bytes each\r\n", "Chart scrolled SPI bytes",
+            (unsigned long) ( ( LCD_stats.cmdBytes + 2 * LCD_stats.pixels )
+                    / BENCH_CHART_SAMPLES ) );
+    CHART_Close( );
+
+    LCD_ResetStats( );
+    start = HAL_GetTick( );
+    for ( i = 0; i < BENCH_CHART_REDRAWS; i++ )
+    {
+        LCD_FillScreen( LCD_BLACK );
+        for ( t = 0; t < 2; t++ )
+        {
+            for ( x = 1; x < LCD_width; x++ )
+            {
+                LCD_DrawLine( x - 1, 119 - BENCH_Wave( i + x - 1, t ) * 15 / 16,
+                        x, 119 - BENCH_Wave( i + x, t ) * 15 / 16, colors[t] );
+            }
+        }
+    }
+    BENCH_Report( "Chart redrawn", HAL_GetTick( ) - start,
+            BENCH_CHART_REDRAWS, "samples/s" );
+    printf( "BENCH: %-24s %6lu bytes each\r\n", "Chart redrawn SPI bytes",
+            (unsigned long) ( ( LCD_stats.cmdBytes + 2 * LCD_stats.pixels )
+                    / BENCH_CHART_REDRAWS ) );
+    LCD_SetRotation( rotation );
+}
+
+/**
+ * -------------------
+ *  Private Functions
+ * -------------------
+ */
+
+static void BENCH_Report( const char *name, uint32_t ms, uint32_t count,
+        const char *unit )
+{
+    printf( "BENCH: %-24s %6lu ms %8lu %s\r\n", name, (unsigned long) ms,
+            ms ? (unsigned long) ( ( (uint64_t) count * 1000 ) / ms ) : 0ul,
+            unit );
+}
+
+static void BENCH_ReportCycles( const char *name, uint32_t ms, uint32_t count )
+{
+    printf( "BENCH: %-24s %6lu ms %8lu cycles each\r\n", name,
+            (unsigned long) ms, (unsigned long) ( ( (uint64_t) ms
+                    * ( SystemCoreClock / 1000 ) ) / count ) );
+}
+
+/**
+ * Draws BENCH_text BENCH_TEXT_REPEAT times from the top of the display,
+ * wrapping at the right edge.
+ *
+ * @return  The number of characters drawn
+ */
+static uint32_t BENCH_DrawText( void )
+{
+    uint8_t i;
+
+    LCD_cursor_x = 0;
+    LCD_cursor_y = LCD_font->yAdvance;
+    for ( i = 0; i < BENCH_TEXT_REPEAT; i++ )
+    {
+        LCD_DrawText( BENCH_text );
+    }
+    return ( sizeof( BENCH_text ) - 1 ) * BENCH_TEXT_REPEAT;
+}
+
+/**
+ * Draws BENCH_text BENCH_TEXT_REPEAT times from the top of the display in
+ * an anti-aliased font, wrapping at the right edge.
+ *
+ * @return  The number of characters drawn
+ */
+static uint32_t BENCH_DrawAAText( const LCD_AAFont *font )
+{
+    const GFXglyph *glyph;
+    const uint8_t *c;
+    int16_t x = 0;
+    int16_t y = font->yAdvance;
+    uint8_t i;
+
+    for ( i = 0; i < BENCH_TEXT_REPEAT; i++ )
+    {
+        for ( c = BENCH_text; *c; c++ )
+        {
+            glyph = &font->glyph[*c - font->first];
+            if ( x + glyph->xAdvance > LCD_width )
+            {
+                x = 0;
+                y += font->yAdvance;
+            }
+            LCD_DrawAAChar( x, y, font, *c, LCD_textcolor );
+            x += glyph->xAdvance;
+        }
+    }
+    return ( sizeof( BENCH_text ) - 1 ) * BENCH_TEXT_REPEAT;
+}
+
+/**
+ * Reads all the runs of the glyphs of BENCH_text, BENCH_DECODES times.
+ *
+ * @return  The number of glyphs read
+ */
+static uint32_t BENCH_ReadGlyphs( const GFXfont *font )
+{
+    LCD_GlyphReader reader;
+    const GFXglyph *glyph;
+    const uint8_t *c;
+    uint16_t pixels;
+    uint8_t set;
+    uint8_t i;
+
+    for ( i = 0; i < BENCH_DECODES; i++ )
+    {
+        for ( c = BENCH_text; *c; c++ )
+        {
+            glyph = LCD_GetGlyph( font, *c );
+            LCD_OpenGlyph( &reader, font, glyph );
+            for ( pixels = glyph->width * glyph->height; pixels > 0; )
+            {
+                pixels -= LCD_ReadGlyphRun( &reader, &set );
+            }
+        }
+    }
+    return ( sizeof( BENCH_text ) - 1 ) * BENCH_DECODES;
+}
+
+/**
+ * Looks up the glyphs of BENCH_text, BENCH_DECODES times, and if 'kern' is
+ * set the kerning of each after the one before, as LCD_DrawText() does.
+ *
+ * @return  The number of glyphs looked up
+ */
+static uint32_t BENCH_LookUpGlyphs( const GFXfont *font, uint8_t kern )
+{
+    const GFXglyph *prev = NULL;
+    const GFXglyph *glyph;
+    const uint8_t *c;
+    uint8_t i;
+
+    for ( i = 0; i < BENCH_DECODES; i++ )
+    {
+        for ( c = BENCH_text; *c; c++ )
+        {
+            glyph = LCD_GetGlyph( font, *c );
+            if ( kern ) LCD_GetKerning( font, prev, glyph );
+            prev = glyph;
+        }
+    }
+    return ( sizeof( BENCH_text ) - 1 ) * BENCH_DECODES;
+}
+
+/**
+ * Draws one of the shapes of BENCH_Shapes(), in one of the benchmark
+ * colors.
+ *
+ * @param   shape   Index in BENCH_shapeNames
+ * @param   x, y    Center of the shape
+ */
+static void BENCH_DrawShape( uint8_t shape, int16_t x, int16_t y )
+{
+    LCD_Point star[BENCH_STAR_POINTS];
+    uint16_t color = BENCH_colors[( x + y ) & 3];
+    uint8_t i;
+
+    for ( i = 0; i < BENCH_STAR_POINTS; i++ )
+    {
+        star[i].x = x + BENCH_star[i].x;
+        star[i].y = y + BENCH_star[i].y;
+    }
+
+    switch ( shape )
+    {
+        case 0:
+            LCD_DrawCircle( x, y, 40, color );
+            break;
+        case 1:
+            LCD_FillCircle( x, y, 40, color );
+            break;
+        case 2:
+            LCD_DrawEllipse( x, y, 40, 25, color );
+            break;
+        case 3:
+            LCD_FillEllipse( x, y, 40, 25, color );
+            break;
+        case 4:
+            LCD_DrawRoundRect( x - 40, y - 30, 80, 60, 10, color );
+            break;
+        case 5:
+            LCD_FillRoundRect( x - 40, y - 30, 80, 60, 10, color );
+            break;
+        case 6:
+            LCD_DrawTriangle( x, y - 40, x + 40, y + 30, x - 40, y + 30, color );
+            break;
+        case 7:
+            LCD_FillTriangle( x, y - 40, x + 40, y + 30, x - 40, y + 30, color );
+            break;
+        case 8:
+            LCD_DrawPolygon( star, BENCH_STAR_POINTS, color );
+            break;
+        default:
+            LCD_FillPolygon( star, BENCH_STAR_POINTS, color );
+            break;
+    }
+}
+
+/**
+ * Returns a sample of a test signal for BENCH_Chart(): a triangle wave for
+ * trace 0, a sawtooth for trace 1, both from -128 to 127.
+ */
+static int16_t BENCH_Wave( int32_t sample, uint8_t trace )
+{
+    uint8_t phase = (uint8_t) ( sample * 5 );
+
+    if ( trace ) return (int16_t) phase - 128;
+    return ( ( phase < 128 ) ? phase * 2 : ( 255 - phase ) * 2 ) - 128;
+}
+
+static void BENCH_FormatLibc( void )
+{
+    snprintf( BENCH_line, sizeof( BENCH_line ), "%3d,%3d", BENCH_touch[0],
+            BENCH_touch[1] );
+}
+
+static void BENCH_FormatFmt( void )
+{
+    FMT_Format( BENCH_line, sizeof( BENCH_line ), "%3d,%3d", BENCH_touch[0],
+            BENCH_touch[1] );
+}
+
+/**
+ * Measures the stack a function takes by filling the stack below the
+ * caller with a pattern and finding the deepest word it changed. An
+ * interrupt taken meanwhile adds its frame. Only the stack the linker
+ * script reserves (_Min_Stack_Size below _estack) is filled, never the
+ * heap below it that printf() may have grown into.
+ *
+ * @return  The stack used in bytes, give or take BENCH_STACK_GAP words,
+ *          at most what could be filled
+ */
+static uint32_t BENCH_StackUse( void (*func)( void ) )
+{
+    extern uint8_t _estack;             // Symbols defined in the linker script
+    extern uint32_t _Min_Stack_Size;
+    uintptr_t limit = (uintptr_t) &_estack - (uintptr_t) &_Min_Stack_Size;
+    volatile uint32_t mark = 0;
+    volatile uint32_t *top = (volatile uint32_t *) ( (uintptr_t) &mark
+            - BENCH_STACK_GAP * sizeof( uint32_t ) );
+    uint16_t words = BENCH_STACK_WORDS;
+    uint16_t i;
+
+    if ( (uintptr_t) top < limit ) return 0;
+    if ( ( (uintptr_t) top - limit ) / sizeof( uint32_t ) < words )
+    {
+        words = ( (uintptr_t) top - limit ) / sizeof( uint32_t ) + 1;
+    }
+
+    for ( i = 0; i < words; i++ )
+    {
+        *( top - i ) = BENCH_STACK_FILL;
+    }
+    func( );
+    for ( i = words; i > 0; i-- )
+    {
+        if ( *( top - ( i - 1 ) ) != BENCH_STACK_FILL ) break;
+    }
+    return ( i + BENCH_STACK_GAP ) * sizeof( uint32_t );
+}
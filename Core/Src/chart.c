@@ -0,0 +1,428 @@
+/**
+ * @file    chart.c
+ * @brief   Strip chart scrolled by the panel's hardware vertical scrolling
+ */
+/**
+ ******************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2021 John Vedder
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************
+ */
+
+#include "main.h"
+#include "lcd.h"
+#include "chart.h"
+
+/*
+ * Public Variables
+ */
+uint8_t CHART_autoscale = 1;
+
+/*
+ * Private Variables
+ */
+static uint8_t CHART_open = 0;
+static uint8_t CHART_history[CHART_MAX_TRACES][LCD_HEIGHT]; // Row of each sample, by column
+static uint8_t CHART_gridRows[( CHART_HEIGHT + 7 ) / 8];    // Rows of the horizontal grid lines
+static uint16_t CHART_buffer[CHART_CHUNK];      // Part of a column being composited
+static uint16_t CHART_colors[CHART_MAX_TRACES]; // Trace colors
+static uint8_t CHART_traces;        // Traces added
+static uint16_t CHART_left;         // Width of the left margin, the first column
+static uint16_t CHART_width;        // Columns of the plot
+static uint16_t CHART_first;        // Column shown at the left of the plot, the oldest
+static int32_t CHART_count;         // Samples plotted
+static uint16_t CHART_gridX;        // Samples between vertical grid lines, 0 for none
+static int16_t CHART_min = 0;       // Value at the bottom of the plot
+static int16_t CHART_max = CHART_HEIGHT - 1;    // Value at the top of the plot
+static int16_t CHART_step;          // Value between horizontal grid lines, 0 for none
+static uint32_t CHART_scale;        // Rows per value, 16.16 fixed point
+static uint16_t CHART_bgcolor;
+static uint16_t CHART_gridcolor;
+
+/*
+ * Private Function Prototypes
+ */
+static uint8_t CHART_Row( int32_t value );
+static void CHART_SetScale( void );
+static void CHART_Rescale( int16_t min, int16_t max, int16_t step );
+static void CHART_DrawColumn( uint16_t column, uint8_t joined, int32_t sample );
+static void CHART_DrawLabels( void );
+static void CHART_DrawLabel( int16_t y, int16_t value, uint8_t bottom );
+
+/*
+ *  -------------------
+ *  Public Functions
+ * -------------------
+ */
+
+/**
+ * Opens an empty chart between fixed left and right margins, in rotation 1,
+ * and draws it. Labels of the range are drawn in the left margin, in the
+ * current LCD_font, if it is not 0 wide.
+ *
+ * @param   left        Width of the fixed left margin in pixels
+ * @param   right       Width of the fixed right margin in pixels
+ * @param   bgcolor     16-bit 5-6-5 Color of the background
+ * @param   gridcolor   16-bit 5-6-5 Color of the grid and the labels
+ */
+void CHART_Open( uint16_t left, uint16_t right, uint16_t bgcolor,
+        uint16_t gridcolor )
+{
+    uint8_t t;
+    uint16_t i;
+
+    if ( left + right >= LCD_HEIGHT ) return;
+
+    CHART_left = left;
+    CHART_width = LCD_HEIGHT - ( left + right );
+    CHART_first = 0;
+    CHART_count = 0;
+    CHART_traces = 0;
+    CHART_bgcolor = bgcolor;
+    CHART_gridcolor = gridcolor;
+    for ( t = 0; t < CHART_MAX_TRACES; t++ )
+    {
+        for ( i = 0; i < CHART_width; i++ )
+        {
+            CHART_history[t][i] = CHART_NONE;
+        }
+    }
+    CHART_SetScale( );
+
+    LCD_SetRotation( 1 );
+    LCD_SetScrollMargins( left, right );
+    CHART_open = 1;
+    CHART_Redraw( );
+}
+
+/**
+ * Closes the chart. The display is no longer scrolled, what it shows of
+ * the plot is then out of order.
+ */
+void CHART_Close( void )
+{
+    if ( !CHART_open ) return;
+    CHART_open = 0;
+    LCD_SetScrollMargins( 0, 0 );
+    LCD_ScrollTo( 0 );
+}
+
+/**
+ * Sets the range of values plotted. The samples plotted so far are
+ * redrawn at the new scale.
+ *
+ * @param   min     Value at the bottom of the plot
+ * @param   max     Value at the top of the plot, above min
+ * @param   step    Value between horizontal grid lines, 0 for none
+ */
+void CHART_SetRange( int16_t min, int16_t max, int16_t step )
+{
+    if ( max <= min ) return;
+    CHART_Rescale( min, max, step );
+}
+
+/**
+ * Sets the spacing of the vertical grid lines, which scroll with the
+ * samples. Takes effect on the next redraw for the columns already drawn.
+ *
+ * @param   samples Samples between vertical grid lines, 0 for none
+ */
+void CHART_SetGridX( uint16_t samples )
+{
+    CHART_gridX = samples;
+}
+
+/**
+ * Adds a trace, drawn over the traces added before it.
+ *
+ * @param   color   16-bit 5-6-5 Color of the trace
+ * @return  The trace number, the index of its value for CHART_Plot(), or
+ *          CHART_NONE if all are in use
+ */
+uint8_t CHART_AddTrace( uint16_t color )
+{
+    if ( CHART_traces >= CHART_MAX_TRACES ) return CHART_NONE;
+    CHART_colors[CHART_traces] = color;
+    return CHART_traces++;
+}
+
+/**
+ * Plots a sample of each trace at the right edge, scrolling the plot left
+ * one column.
+ *
+ * @param   values  One value per trace, in the order they were added
+ */
+void CHART_Plot( const int16_t *values )
+{
+    int32_t min = CHART_min;
+    int32_t max = CHART_max;
+    int32_t step = CHART_step;
+    uint16_t column = CHART_first;
+    uint8_t t;
+
+    if ( !CHART_open ) return;
+
+    if ( CHART_autoscale )
+    {
+        for ( t = 0; t < CHART_traces; t++ )
+        {
+            while ( values[t] > max && max < INT16_MAX )
+            {
+                max = min + 2 * ( max - min );
+                if ( max > INT16_MAX ) max = INT16_MAX;
+                step *= 2;
+            }
+            while ( values[t] < min && min > INT16_MIN )
+            {
+                min = max - 2 * ( max - min );
+                if ( min < INT16_MIN ) min = INT16_MIN;
+                step *= 2;
+            }
+        }
+        if ( step > INT16_MAX ) step = 0;
+        if ( min != CHART_min || max != CHART_max )
+        {
+            CHART_Rescale( min, max, step );
+        }
+    }
+
+    // The oldest column becomes the newest
+    for ( t = 0; t < CHART_traces; t++ )
+    {
+        CHART_history[t][column] = CHART_Row( values[t] );
+    }
+    CHART_count++;
+    if ( ++CHART_first == CHART_width ) CHART_first = 0;
+
+    LCD_StartWrite( );
+    CHART_DrawColumn( column, 1, CHART_count );
+    LCD_ScrollTo( CHART_left + CHART_first );
+    LCD_EndWrite( );
+}
+
+/**
+ * Redraws the whole chart: the labels and every column of the plot.
+ */
+void CHART_Redraw( void )
+{
+    uint16_t column = CHART_first;
+    uint16_t i;
+
+    if ( !CHART_open ) return;
+
+    LCD_StartWrite( );
+    CHART_DrawLabels( );
+    for ( i = 0; i < CHART_width; i++ )
+    {
+        // The newest column is sample CHART_count
+        CHART_DrawColumn( column, i > 0, CHART_count - ( CHART_width - 1 - i ) );
+        if ( ++column == CHART_width ) column = 0;
+    }
+    LCD_ScrollTo( CHART_left + CHART_first );
+    LCD_EndWrite( );
+}
+
+/**
+ * -------------------
+ *  Private Functions
+ * -------------------
+ */
+
+/**
+ * Returns the row of the plot a value is drawn in, clamped to the range.
+ */
+static uint8_t CHART_Row( int32_t value )
+{
+    if ( value < CHART_min ) value = CHART_min;
+    if ( value > CHART_max ) value = CHART_max;
+    return ( CHART_HEIGHT - 1 )
+            - ( ( (uint32_t) ( value - CHART_min ) * CHART_scale ) >> 16 );
+}
+
+/**
+ * Computes the scale and the rows of the horizontal grid lines of the
+ * range. The scale is rounded up so that the top of the range maps to the
+ * top row, a product of a value and the scale fits in 24 bits.
+ */
+static void CHART_SetScale( void )
+{
+    uint32_t span = (int32_t) CHART_max - CHART_min;
+    int32_t value;
+    uint8_t row;
+    uint16_t i;
+
+    CHART_scale = ( ( (uint32_t) ( CHART_HEIGHT - 1 ) << 16 ) + span - 1 ) / span;
+
+    for ( i = 0; i < sizeof( CHART_gridRows ); i++ )
+    {
+        CHART_gridRows[i] = 0;
+    }
+    if ( CHART_step <= 0 ) return;
+
+    // Grid lines at the multiples of the step
+    value = ( CHART_min / CHART_step ) * CHART_step;
+    if ( value < CHART_min ) value += CHART_step;
+    for ( ; value <= CHART_max; value += CHART_step )
+    {
+        row = CHART_Row( value );
+        CHART_gridRows[row >> 3] |= 0x80 >> ( row & 7 );
+    }
+}
+
+/**
+ * Changes the range, moves the samples plotted so far to their rows at
+ * the new scale and redraws the chart.
+ */
+static void CHART_Rescale( int16_t min, int16_t max, int16_t step )
+{
+    int32_t oldMin = CHART_min;
+    int32_t oldSpan = (int32_t) CHART_max - CHART_min;
+    int32_t bottom;
+    uint8_t *row;
+    uint8_t t;
+    uint16_t i;
+
+    CHART_min = min;
+    CHART_max = max;
+    CHART_step = step;
+    CHART_SetScale( );
+
+    for ( t = 0; t < CHART_traces; t++ )
+    {
+        row = CHART_history[t];
+        for ( i = 0; i < CHART_width; i++, row++ )
+        {
+            if ( *row == CHART_NONE ) continue;
+            // The value of the row at the old scale, rounded
+            bottom = ( CHART_HEIGHT - 1 ) - *row;
+            *row = CHART_Row( oldMin + ( bottom * oldSpan
+                    + ( CHART_HEIGHT - 1 ) / 2 ) / ( CHART_HEIGHT - 1 ) );
+        }
+    }
+    CHART_Redraw( );
+}
+
+/**
+ * Draws a column of the plot in one address window: the background, the
+ * grid, then each trace as a run from its previous sample's row to its
+ * row.
+ *
+ * @param   column  Column of the ring
+ * @param   joined  If set, the traces are joined to the column before
+ * @param   sample  Number of the sample in the column, for the vertical grid
+ */
+static void CHART_DrawColumn( uint16_t column, uint8_t joined, int32_t sample )
+{
+    uint8_t top[CHART_MAX_TRACES];
+    uint8_t bottom[CHART_MAX_TRACES];
+    uint16_t previous = ( column == 0 ) ? CHART_width - 1 : column - 1;
+    uint16_t *pixel;
+    uint8_t gridColumn = 0;
+    uint8_t row;
+    uint8_t last;
+    uint8_t y;
+    uint8_t t;
+
+    for ( t = 0; t < CHART_traces; t++ )
+    {
+        top[t] = bottom[t] = row = CHART_history[t][column];
+        last = CHART_history[t][previous];
+        if ( row == CHART_NONE || !joined || last == CHART_NONE ) continue;
+        if ( last < row ) top[t] = last;
+        else bottom[t] = last;
+    }
+    if ( CHART_gridX )
+    {
+        sample %= CHART_gridX;
+        gridColumn = ( sample == 0 );
+    }
+
+    LCD_SetAddrWindow( CHART_left + column, 0, 1, CHART_HEIGHT );
+    for ( y = 0; y < CHART_HEIGHT; y = last )
+    {
+        last = ( CHART_HEIGHT - y > CHART_CHUNK ) ? y + CHART_CHUNK : CHART_HEIGHT;
+        pixel = CHART_buffer;
+        for ( row = y; row < last; row++ )
+        {
+            *pixel = ( gridColumn || ( CHART_gridRows[row >> 3] & ( 0x80 >> ( row & 7 ) ) ) ) ?
+                    CHART_gridcolor : CHART_bgcolor;
+            for ( t = 0; t < CHART_traces; t++ )
+            {
+                if ( row >= top[t] && row <= bottom[t] ) *pixel = CHART_colors[t];
+            }
+            pixel++;
+        }
+        if ( y == 0 ) LCD_WritePixels( CHART_buffer, last - y );
+        else LCD_ContinuePixels( CHART_buffer, last - y );
+    }
+}
+
+/**
+ * Draws the top and bottom values of the range in the left margin.
+ */
+static void CHART_DrawLabels( void )
+{
+    if ( CHART_left == 0 ) return;
+    LCD_DrawFillRect( 0, 0, CHART_left, CHART_HEIGHT, CHART_bgcolor );
+    CHART_DrawLabel( 0, CHART_max, 0 );
+    CHART_DrawLabel( CHART_HEIGHT, CHART_min, 1 );
+}
+
+/**
+ * Draws a value in the left margin, in LCD_font and the grid color.
+ *
+ * @param   y       Top of the label, or its bottom if 'bottom' is set
+ * @param   value   The value
+ * @param   bottom  If set, the label ends at y
+ */
+static void CHART_DrawLabel( int16_t y, int16_t value, uint8_t bottom )
+{
+    uint8_t text[8];
+    uint8_t *p = &text[sizeof( text ) - 1];
+    uint16_t magnitude = ( value < 0 ) ? -(int32_t) value : value;
+    int16_t cursorX = LCD_cursor_x;
+    int16_t cursorY = LCD_cursor_y;
+    uint16_t color = LCD_textcolor;
+    uint16_t bgcolor = LCD_textbgcolor;
+    uint8_t wrap = LCD_wrap;
+    LCD_Rect bounds;
+
+    *p = '\0';
+    do
+    {
+        *--p = '0' + magnitude % 10;
+        magnitude /= 10;
+    } while ( magnitude );
+    if ( value < 0 ) *--p = '-';
+
+    // Place the baseline so the text's bounding box starts or ends at y
+    LCD_GetTextBounds( 0, 0, p, &bounds );
+    LCD_cursor_x = 0;
+    LCD_cursor_y = bottom ? y - ( bounds.y + bounds.h ) : y - bounds.y;
+    LCD_SetTextColor( CHART_gridcolor );
+    LCD_wrap = 0;
+    LCD_DrawText( p );
+    LCD_cursor_x = cursorX;
+    LCD_cursor_y = cursorY;
+    LCD_SetTextColors( color, bgcolor );
+    LCD_wrap = wrap;
+}
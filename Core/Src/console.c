@@ -0,0 +1,238 @@
+/**
+ * @file    console.c
+ * @brief   Scrolling text console on the panel's hardware vertical
+ *          scrolling
+ */
+/**
+ ******************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2021 John Vedder
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************
+ */
+
+#include "main.h"
+#include "lcd.h"
+#include "console.h"
+
+/*
+ * Public Variables
+ */
+uint8_t CON_open = 0;
+
+/*
+ * Private Variables
+ */
+static const GFXfont *CON_font;    // Font, LCD_font when opened
+static uint16_t CON_top;           // First memory row of the scrolling area
+static uint16_t CON_lineHeight;    // Pixel rows per line
+static uint8_t CON_ascent;         // Pixel rows from the top of a line to the baseline
+static uint8_t CON_lines;          // Lines in the scrolling area
+static uint8_t CON_first;          // Line of the ring shown at the top
+static uint8_t CON_row;            // Cursor line, from the top
+static uint8_t CON_pending;        // A new line is due before the next character
+static int16_t CON_x;              // Cursor x coordinate
+static uint16_t CON_color;         // Text color
+static uint16_t CON_bgcolor;       // Background color
+
+/*
+ * Private Function Prototypes
+ */
+static uint16_t CON_LineY( uint8_t row );
+static void CON_NewLine( void );
+static void CON_Scroll( void );
+
+/*
+ *  -------------------
+ *  Public Functions
+ * -------------------
+ */
+
+/**
+ * Opens the console between fixed header and footer areas, in the current
+ * LCD_font, and clears it. Rows left over below the last whole line are
+ * added to the footer.
+ *
+ * @param   top     Height of the fixed header area in pixels
+ * @param   bottom  Height of the fixed footer area in pixels
+ * @param   color   16-bit 5-6-5 Color of the text
+ * @param   bgcolor 16-bit 5-6-5 Color of the background
+ */
+void CON_Open( uint16_t top, uint16_t bottom, uint16_t color,
+        uint16_t bgcolor )
+{
+    uint16_t height;
+    uint16_t ascent;
+    uint16_t descent;
+
+    if ( top + bottom >= LCD_HEIGHT ) return;
+    height = LCD_HEIGHT - ( top + bottom );
+    CON_lineHeight = LCD_font->yAdvance;
+    if ( CON_lineHeight == 0 || CON_lineHeight > height ) return;
+
+    CON_font = LCD_font;
+    CON_top = top;
+    CON_color = color;
+    CON_bgcolor = bgcolor;
+    CON_lines = 0;
+    while ( height >= CON_lineHeight && CON_lines < 255 )
+    {
+        height -= CON_lineHeight;
+        CON_lines++;
+    }
+
+    // The baseline is below the tallest glyph
+    LCD_GetFontExtent( CON_font, &ascent, &descent );
+    CON_ascent = ascent;
+
+    LCD_SetRotation( 0 );
+    LCD_SetScrollMargins( top, bottom + height );
+    CON_open = 1;
+    CON_Clear( );
+}
+
+/**
+ * Closes the console. The display is no longer scrolled, what it shows in
+ * the scrolling area is then out of order.
+ */
+void CON_Close( void )
+{
+    if ( !CON_open ) return;
+    CON_open = 0;
+    LCD_SetScrollMargins( 0, 0 );
+    LCD_ScrollTo( 0 );
+}
+
+/**
+ * Clears the console and moves the cursor to its top left corner.
+ */
+void CON_Clear( void )
+{
+    if ( !CON_open ) return;
+    CON_first = 0;
+    CON_row = 0;
+    CON_pending = 0;
+    CON_x = 0;
+    LCD_ScrollTo( CON_top );
+    LCD_DrawFillRect( 0, CON_top, LCD_WIDTH, CON_lines * CON_lineHeight,
+            CON_bgcolor );
+}
+
+/**
+ * Writes one character at the cursor. '\n' starts a new line, the console
+ * scrolls up a line when the next character is written past the bottom.
+ * Lines too long for the display are wrapped. '\r' and the other control
+ * characters are ignored, so "\r\n" line ends work as '\n'.
+ *
+ * @param   c   The character
+ */
+void CON_PutChar( uint8_t c )
+{
+    const GFXfont *font;
+    const GFXglyph *glyph;
+    uint16_t color;
+    uint16_t bgcolor;
+
+    if ( !CON_open ) return;
+    if ( c == '\n' )
+    {
+        CON_NewLine( );
+        return;
+    }
+    glyph = LCD_GetGlyph( CON_font, c );
+    if ( glyph == NULL ) return;
+
+    if ( CON_x > 0 && CON_x + glyph->xAdvance > LCD_WIDTH ) CON_NewLine( );
+    if ( CON_pending ) CON_Scroll( );
+
+    if ( glyph->width > 0 && glyph->height > 0 )
+    {
+        // Transparent whatever the application set, the line is already
+        // cleared to CON_bgcolor
+        font = LCD_font;
+        color = LCD_textcolor;
+        bgcolor = LCD_textbgcolor;
+        LCD_font = CON_font;
+        LCD_SetTextColor( CON_color );
+        LCD_WriteChar( CON_x, CON_LineY( CON_row ) + CON_ascent, c, CON_color,
+                1, 1 );
+        LCD_font = font;
+        LCD_SetTextColors( color, bgcolor );
+    }
+    CON_x += glyph->xAdvance;
+}
+
+/**
+ * Writes a string with CON_PutChar().
+ *
+ * @param   text    Null terminated string
+ */
+void CON_Write( const uint8_t *text )
+{
+    while ( *text )
+    {
+        CON_PutChar( *text++ );
+    }
+}
+
+/**
+ * -------------------
+ *  Private Functions
+ * -------------------
+ */
+
+/**
+ * Returns the memory row of the top of a line, counted from the top of
+ * the console.
+ */
+static uint16_t CON_LineY( uint8_t row )
+{
+    uint16_t line = CON_first + row;
+
+    if ( line >= CON_lines ) line -= CON_lines;
+    return CON_top + line * CON_lineHeight;
+}
+
+/**
+ * Moves the cursor to the start of the next line. On the last line the
+ * scroll waits for the next character, so the bottom line is not left
+ * empty.
+ */
+static void CON_NewLine( void )
+{
+    if ( CON_pending ) CON_Scroll( );
+    CON_x = 0;
+    if ( CON_row + 1 < CON_lines ) CON_row++;
+    else CON_pending = 1;
+}
+
+/**
+ * Scrolls up a line: the top line is cleared, then shown at the bottom by
+ * moving the scroll start address to the line after it.
+ */
+static void CON_Scroll( void )
+{
+    LCD_DrawFillRect( 0, CON_LineY( 0 ), LCD_WIDTH, CON_lineHeight,
+            CON_bgcolor );
+    if ( ++CON_first == CON_lines ) CON_first = 0;
+    LCD_ScrollTo( CON_LineY( 0 ) );
+    CON_pending = 0;
+}
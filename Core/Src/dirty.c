@@ -0,0 +1,224 @@
+/**
+ * @file    dirty.c
+ * @brief   Dirty rectangle tracker. Collects the areas of the display that
+ *          need to be repainted during a frame and merges them into a short
+ *          repaint list, trading extra pixels against window setups.
+ */
+
+/**
+ ******************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2021 John Vedder
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************
+ */
+
+#include "main.h"
+#include "lcd.h"
+#include "dirty.h"
+
+/*
+ * Public Variables
+ */
+DIRTY_Stats DIRTY_stats;            // Repaint cost of the last frame
+
+/*
+ * Private Variables. One spare slot holds a new rectangle while the list is
+ * full, until a merge makes room.
+ */
+static LCD_Rect DIRTY_rects[DIRTY_MAX_RECTS + 1];   // The repaint list
+static uint8_t DIRTY_count = 0;                     // Rectangles in the list
+static uint16_t DIRTY_requests = 0;                 // Rectangles added this frame
+static uint32_t DIRTY_bytesRequested = 0;           // Their repaint cost
+
+/*
+ * Private Function Prototypes
+ */
+static uint32_t DIRTY_Cost( const LCD_Rect *r );
+static void DIRTY_Union( const LCD_Rect *a, const LCD_Rect *b, LCD_Rect *u );
+static int32_t DIRTY_MergeGain( const LCD_Rect *a, const LCD_Rect *b );
+static void DIRTY_Merge( uint8_t i, uint8_t j );
+
+/*
+ *  -------------------
+ *  Public Functions
+ * -------------------
+ */
+
+/**
+ * Adds an area to repaint. It is clipped to the display, then merged with
+ * the rectangles already in the list while merging pays. If the list is
+ * full the cheapest merge is made anyway.
+ *
+ *  @param  x  Top left corner x coordinate
+ *  @param  y  Top left corner y coordinate
+ *  @param  w  Width in pixels
+ *  @param  h  Height in pixels
+ */
+void DIRTY_Add( int16_t x, int16_t y, int16_t w, int16_t h )
+{
+    int16_t x2 = x + w;     // exclusive
+    int16_t y2 = y + h;     // exclusive
+    LCD_Rect *r;
+    int32_t gain;
+    int32_t best;
+    uint8_t bi = 0;
+    uint8_t bj = 0;
+    uint8_t i;
+    uint8_t j;
+
+    if ( w <= 0 || h <= 0 ) return;
+    if ( x < 0 ) x = 0;
+    if ( y < 0 ) y = 0;
+    if ( x2 > LCD_width ) x2 = LCD_width;
+    if ( y2 > LCD_height ) y2 = LCD_height;
+    if ( x >= x2 || y >= y2 ) return;
+
+    r = &DIRTY_rects[DIRTY_count++];
+    r->x = x;
+    r->y = y;
+    r->w = x2 - x;
+    r->h = y2 - y;
+    DIRTY_requests++;
+    DIRTY_bytesRequested += DIRTY_Cost( r );
+
+    // Merge the best pair while that is no dearer, or while the list is over full
+    for ( ;; )
+    {
+        best = INT32_MIN;
+        for ( i = 0; i < DIRTY_count; i++ )
+        {
+            for ( j = i + 1; j < DIRTY_count; j++ )
+            {
+                gain = DIRTY_MergeGain( &DIRTY_rects[i], &DIRTY_rects[j] );
+                if ( gain > best )
+                {
+                    best = gain;
+                    bi = i;
+                    bj = j;
+                }
+            }
+        }
+        if ( ( best < 0 ) && ( DIRTY_count <= DIRTY_MAX_RECTS ) ) break;
+        DIRTY_Merge( bi, bj );
+    }
+}
+
+/**
+ * Adds the whole display.
+ */
+void DIRTY_AddAll( void )
+{
+    DIRTY_Add( 0, 0, LCD_width, LCD_height );
+}
+
+/**
+ * Returns the repaint list of the frame.
+ *
+ * @param   rects   Returns a pointer to the rectangles
+ * @return  The number of rectangles
+ */
+uint8_t DIRTY_GetRects( const LCD_Rect **rects )
+{
+    *rects = DIRTY_rects;
+    return DIRTY_count;
+}
+
+/**
+ * Ends a frame once the repaint list has been repainted: records its cost
+ * in DIRTY_stats and empties the list.
+ */
+void DIRTY_EndFrame( void )
+{
+    uint32_t bytes = 0;
+    uint8_t i;
+
+    for ( i = 0; i < DIRTY_count; i++ )
+    {
+        bytes += DIRTY_Cost( &DIRTY_rects[i] );
+    }
+
+    DIRTY_stats.requests = DIRTY_requests;
+    DIRTY_stats.rects = DIRTY_count;
+    DIRTY_stats.bytesRequested = DIRTY_bytesRequested;
+    DIRTY_stats.bytesRepaint = bytes;
+    DIRTY_stats.bytesSaved = (int32_t) ( DIRTY_bytesRequested - bytes );
+
+    DIRTY_count = 0;
+    DIRTY_requests = 0;
+    DIRTY_bytesRequested = 0;
+}
+
+/**
+ * -------------------
+ *  Private Functions
+ * -------------------
+ */
+
+/**
+ * Returns the cost of repainting a rectangle in SPI bytes.
+ */
+static uint32_t DIRTY_Cost( const LCD_Rect *r )
+{
+    return DIRTY_SETUP_BYTES + 2 * (uint32_t) r->w * r->h;
+}
+
+/**
+ * Computes the bounding box of two rectangles.
+ */
+static void DIRTY_Union( const LCD_Rect *a, const LCD_Rect *b, LCD_Rect *u )
+{
+    int16_t x2 = ( a->x + a->w > b->x + b->w ) ? a->x + a->w : b->x + b->w;
+    int16_t y2 = ( a->y + a->h > b->y + b->h ) ? a->y + a->h : b->y + b->h;
+
+    u->x = ( a->x < b->x ) ? a->x : b->x;
+    u->y = ( a->y < b->y ) ? a->y : b->y;
+    u->w = x2 - u->x;
+    u->h = y2 - u->y;
+}
+
+/**
+ * Returns how many SPI bytes replacing two rectangles with their bounding
+ * box saves, negative if it costs more. Where the two overlap their pixels
+ * would be sent twice, which favors merging overlapping rectangles.
+ */
+static int32_t DIRTY_MergeGain( const LCD_Rect *a, const LCD_Rect *b )
+{
+    LCD_Rect u;
+
+    DIRTY_Union( a, b, &u );
+    return (int32_t) ( DIRTY_Cost( a ) + DIRTY_Cost( b ) )
+            - (int32_t) DIRTY_Cost( &u );
+}
+
+/**
+ * Replaces rectangle i with the bounding box of rectangles i and j, and
+ * removes j (j > i).
+ */
+static void DIRTY_Merge( uint8_t i, uint8_t j )
+{
+    DIRTY_Union( &DIRTY_rects[i], &DIRTY_rects[j], &DIRTY_rects[i] );
+    DIRTY_count--;
+    for ( ; j < DIRTY_count; j++ )
+    {
+        DIRTY_rects[j] = DIRTY_rects[j + 1];
+    }
+}
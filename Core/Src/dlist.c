@@ -0,0 +1,465 @@
+/**
+ * @file    dlist.c
+ * @brief   Display list renderer. Primitives are recorded rather than drawn,
+ *          and the dirty parts of the display are composited in a small band
+ *          buffer, one band at a time, then sent with one window write each.
+ *          Overlapping items are never seen half drawn, so updates do not
+ *          flicker.
+ */
+
+/**
+ ******************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2021 John Vedder
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************
+ */
+
+#include "main.h"
+#include "lcd.h"
+#include "dlist.h"
+#include "dirty.h"
+
+#define DLIST_BAND_PIXELS   ( DLIST_BAND_ROWS * LCD_HEIGHT )
+
+/*
+ * Item types
+ */
+#define DLIST_FILL      0   // Filled rectangle
+#define DLIST_RECT      1   // Rectangle outline
+#define DLIST_LINE      2   // Line
+#define DLIST_TEXT      3   // Text
+
+/**
+ * A recorded primitive. Rectangles are kept as their corners (x0,y0) and
+ * (x1,y1), lines as their end points and text as the cursor in (x0,y0).
+ */
+typedef struct
+{
+    uint8_t type;           // DLIST_FILL, DLIST_RECT, DLIST_LINE or DLIST_TEXT
+    uint8_t size;           // Text magnification, x in the high nibble, y in the low
+    uint16_t color;         // 16-bit 5-6-5 color
+    int16_t x0;
+    int16_t y0;
+    int16_t x1;
+    int16_t y1;
+    int16_t top;            // First row drawn, updated by DLIST_Render()
+    int16_t bottom;         // Last row drawn, updated by DLIST_Render()
+    const uint8_t *text;    // Text, owned by the caller
+    const GFXfont *font;    // Font of the text
+} DLIST_Item;
+
+/*
+ * Private Variables
+ */
+static DLIST_Item DLIST_items[DLIST_MAX_ITEMS];         // The display list, in drawing order
+static uint8_t DLIST_count = 0;                         // Number of items
+static uint16_t DLIST_background = LCD_WHITE;           // Color under all items
+static uint16_t DLIST_band[DLIST_BAND_PIXELS];          // The band buffer
+static LCD_Rect DLIST_clip;                             // Area of the band being rendered
+
+/*
+ * Private Function Prototypes
+ */
+static DLIST_Item* DLIST_Add( uint8_t type, int16_t x0, int16_t y0, int16_t x1,
+        int16_t y1, uint16_t color );
+static void DLIST_Rows( DLIST_Item *item );
+static void DLIST_RenderBand( void );
+static void DLIST_RenderItem( const DLIST_Item *item );
+static void DLIST_RenderText( const DLIST_Item *item );
+static void DLIST_Span( int16_t x, int16_t y, int16_t w, int16_t h,
+        uint16_t color );
+
+/*
+ *  -------------------
+ *  Public Functions
+ * -------------------
+ */
+
+/**
+ * Removes all of the items. Nothing is invalidated.
+ */
+void DLIST_Clear( void )
+{
+    DLIST_count = 0;
+}
+
+/**
+ * Sets the color drawn under all of the items.
+ *
+ * @param   color   16-bit 5-6-5 color
+ */
+void DLIST_SetBackground( uint16_t color )
+{
+    DLIST_background = color;
+}
+
+/**
+ * Adds a filled rectangle. Negative height or width is handled as in
+ * LCD_DrawFillRect().
+ *
+ * @return  The item number, or DLIST_NONE if the display list is full
+ */
+uint8_t DLIST_AddFillRect( int16_t x, int16_t y, int16_t w, int16_t h,
+        uint16_t color )
+{
+    if ( w == 0 || h == 0 ) return DLIST_NONE;
+    if ( w < 0 )
+    {
+        x += w + 1;
+        w = -w;
+    }
+    if ( h < 0 )
+    {
+        y += h + 1;
+        h = -h;
+    }
+    return DLIST_Add( DLIST_FILL, x, y, x + w - 1, y + h - 1, color ) ?
+            DLIST_count - 1 : DLIST_NONE;
+}
+
+/**
+ * Adds a rectangle outline, see DLIST_AddFillRect().
+ *
+ * @return  The item number, or DLIST_NONE if the display list is full
+ */
+uint8_t DLIST_AddRect( int16_t x, int16_t y, int16_t w, int16_t h,
+        uint16_t color )
+{
+    uint8_t item = DLIST_AddFillRect( x, y, w, h, color );
+
+    if ( item != DLIST_NONE )
+    {
+        DLIST_items[item].type = DLIST_RECT;
+    }
+    return item;
+}
+
+/**
+ * Adds a line, drawn with the same pixels as LCD_DrawLine().
+ *
+ * @return  The item number, or DLIST_NONE if the display list is full
+ */
+uint8_t DLIST_AddLine( int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+        uint16_t color )
+{
+    return DLIST_Add( DLIST_LINE, x0, y0, x1, y1, color ) ?
+            DLIST_count - 1 : DLIST_NONE;
+}
+
+/**
+ * Adds text drawn from the cursor (x,y) in the current LCD_font and text
+ * size, with a transparent background. Newline ('\n') and kerning are
+ * supported as in LCD_DrawText(), the text does not wrap. The text is not
+ * copied: it must stay valid, and may be changed as long as the area it
+ * covers before and after is invalidated.
+ *
+ * @return  The item number, or DLIST_NONE if the display list is full
+ */
+uint8_t DLIST_AddText( int16_t x, int16_t y, const uint8_t *text,
+        uint16_t color )
+{
+    DLIST_Item *item = DLIST_Add( DLIST_TEXT, x, y, x, y, color );
+
+    if ( item == NULL ) return DLIST_NONE;
+    item->text = text;
+    item->font = LCD_font;
+    item->size = ( LCD_textsize_x << 4 ) | ( LCD_textsize_y & 0x0F );
+    return DLIST_count - 1;
+}
+
+/**
+ * Changes the color of an item. The area it covers must be invalidated for
+ * the change to be seen.
+ */
+void DLIST_SetColor( uint8_t item, uint16_t color )
+{
+    if ( item < DLIST_count )
+    {
+        DLIST_items[item].color = color;
+    }
+}
+
+/**
+ * Marks an area of the display to be redrawn by the next DLIST_Render().
+ * The areas are collected by the dirty rectangle tracker, see DIRTY_Add().
+ */
+void DLIST_Invalidate( int16_t x, int16_t y, int16_t w, int16_t h )
+{
+    DIRTY_Add( x, y, w, h );
+}
+
+/**
+ * Marks the whole display to be redrawn.
+ */
+void DLIST_InvalidateAll( void )
+{
+    DIRTY_AddAll( );
+}
+
+/**
+ * Redraws the repaint list of the dirty rectangle tracker and ends its
+ * frame. Each rectangle is split into bands that fit the band buffer, as
+ * many rows as fit for its width. Each band is composited in the band
+ * buffer, the background then the items in the order they were added, and
+ * sent with one window write.
+ */
+void DLIST_Render( void )
+{
+    const LCD_Rect *rects;
+    uint8_t count = DIRTY_GetRects( &rects );
+    int16_t rows;
+    int16_t end;
+    uint8_t n;
+
+    for ( n = 0; n < DLIST_count; n++ )
+    {
+        DLIST_Rows( &DLIST_items[n] );
+    }
+
+    LCD_StartWrite( );
+    for ( ; count > 0; count--, rects++ )
+    {
+        rows = DLIST_BAND_PIXELS / rects->w;
+        end = rects->y + rects->h;
+
+        DLIST_clip.x = rects->x;
+        DLIST_clip.w = rects->w;
+        for ( DLIST_clip.y = rects->y; DLIST_clip.y < end; DLIST_clip.y += rows )
+        {
+            DLIST_clip.h = ( end - DLIST_clip.y < rows ) ? end - DLIST_clip.y : rows;
+            DLIST_RenderBand( );
+        }
+    }
+    LCD_EndWrite( );
+
+    DIRTY_EndFrame( );
+}
+
+/**
+ * -------------------
+ *  Private Functions
+ * -------------------
+ */
+
+static DLIST_Item* DLIST_Add( uint8_t type, int16_t x0, int16_t y0, int16_t x1,
+        int16_t y1, uint16_t color )
+{
+    DLIST_Item *item;
+
+    if ( DLIST_count >= DLIST_MAX_ITEMS ) return NULL;
+    item = &DLIST_items[DLIST_count++];
+    item->type = type;
+    item->color = color;
+    item->x0 = x0;
+    item->y0 = y0;
+    item->x1 = x1;
+    item->y1 = y1;
+    item->text = NULL;
+    item->font = NULL;
+    return item;
+}
+
+/**
+ * Works out the first and last rows an item draws, so bands it misses can
+ * skip it.
+ */
+static void DLIST_Rows( DLIST_Item *item )
+{
+    if ( item->type != DLIST_TEXT )
+    {
+        item->top = ( item->y0 < item->y1 ) ? item->y0 : item->y1;
+        item->bottom = ( item->y0 < item->y1 ) ? item->y1 : item->y0;
+        return;
+    }
+
+    const uint8_t *text = item->text;
+    const GFXglyph *glyph;
+    uint8_t size_y = item->size & 0x0F;
+    int16_t y = item->y0;
+    uint8_t c;
+
+    item->top = INT16_MAX;
+    item->bottom = INT16_MIN;
+    while ( ( c = *text++ ) != '\0' )
+    {
+        if ( c == '\n' )
+        {
+            y += size_y * item->font->yAdvance;
+        }
+        else if ( ( glyph = LCD_GetGlyph( item->font, c ) ) != NULL )
+        {
+            int16_t y1 = y + glyph->yOffset * size_y;
+            int16_t y2 = y1 + glyph->height * size_y - 1;
+            if ( y1 < item->top ) item->top = y1;
+            if ( y2 > item->bottom ) item->bottom = y2;
+        }
+    }
+}
+
+/**
+ * Composites the band DLIST_clip and sends it.
+ */
+static void DLIST_RenderBand( void )
+{
+    uint32_t pixels = (uint32_t) DLIST_clip.w * DLIST_clip.h;
+    uint32_t i;
+    uint8_t n;
+
+    for ( i = 0; i < pixels; i++ )
+    {
+        DLIST_band[i] = DLIST_background;
+    }
+    for ( n = 0; n < DLIST_count; n++ )
+    {
+        if ( ( DLIST_items[n].bottom >= DLIST_clip.y )
+                && ( DLIST_items[n].top < DLIST_clip.y + DLIST_clip.h ) )
+        {
+            DLIST_RenderItem( &DLIST_items[n] );
+        }
+    }
+
+    LCD_SetAddrWindow( DLIST_clip.x, DLIST_clip.y, DLIST_clip.w, DLIST_clip.h );
+    LCD_WritePixels( DLIST_band, pixels );
+}
+
+/**
+ * Draws an item into the band buffer, clipped to the band.
+ */
+static void DLIST_RenderItem( const DLIST_Item *item )
+{
+    int16_t w = item->x1 - item->x0 + 1;
+    int16_t h = item->y1 - item->y0 + 1;
+
+    switch ( item->type )
+    {
+        case DLIST_FILL:
+            DLIST_Span( item->x0, item->y0, w, h, item->color );
+            break;
+        case DLIST_RECT:
+            DLIST_Span( item->x0, item->y0, w, 1, item->color );
+            DLIST_Span( item->x0, item->y1, w, 1, item->color );
+            DLIST_Span( item->x0, item->y0, 1, h, item->color );
+            DLIST_Span( item->x1, item->y0, 1, h, item->color );
+            break;
+        case DLIST_LINE:
+            LCD_RasterLine( item->x0, item->y0, item->x1, item->y1, item->color,
+                    &DLIST_clip, DLIST_Span );
+            break;
+        case DLIST_TEXT:
+            DLIST_RenderText( item );
+            break;
+    }
+}
+
+/**
+ * Draws the glyphs of a text item into the band buffer, only the rows of
+ * each glyph that fall in the band are decoded.
+ */
+static void DLIST_RenderText( const DLIST_Item *item )
+{
+    const GFXfont *font = item->font;
+    const uint8_t *text = item->text;
+    uint8_t size_x = item->size >> 4;
+    uint8_t size_y = item->size & 0x0F;
+    int16_t bandTop = DLIST_clip.y;
+    int16_t bandBottom = DLIST_clip.y + DLIST_clip.h - 1;
+    const GFXglyph *prev = NULL;
+    int16_t x = item->x0;
+    int16_t y = item->y0;
+    uint8_t c;
+
+    while ( ( c = *text++ ) != '\0' )
+    {
+        if ( c == '\n' )
+        {
+            x = 0;  // As LCD_DrawChar()
+            y += size_y * font->yAdvance;
+            prev = NULL;
+            continue;
+        }
+        const GFXglyph *glyph = LCD_GetGlyph( font, c );
+        x += size_x * LCD_GetKerning( font, prev, glyph );
+        prev = glyph;
+        if ( glyph == NULL ) continue;
+
+        int16_t gx = x + glyph->xOffset * size_x;
+        int16_t gy = y + glyph->yOffset * size_y;
+        uint8_t w = glyph->width;
+        uint8_t h = glyph->height;
+        LCD_GlyphReader reader;
+        uint8_t row;
+        uint8_t col;
+        uint8_t run;
+        uint8_t set;
+
+        x += size_x * glyph->xAdvance;
+
+        // Glyph rows that fall in the band
+        if ( ( gy > bandBottom ) || ( gy + h * size_y <= bandTop ) ) continue;
+        if ( ( gx > DLIST_clip.x + DLIST_clip.w - 1 )
+                || ( gx + w * size_x <= DLIST_clip.x ) ) continue;
+        row = ( gy < bandTop ) ? ( bandTop - gy ) / size_y : 0;
+
+        LCD_OpenGlyph( &reader, font, glyph );
+        LCD_SkipGlyphRows( &reader, row );
+        for ( ; ( row < h ) && ( gy + row * size_y <= bandBottom ); row++ )
+        {
+            for ( col = 0; col < w; col += run )
+            {
+                run = LCD_ReadGlyphRun( &reader, &set );
+                if ( set )
+                {
+                    DLIST_Span( gx + col * size_x, gy + row * size_y,
+                            run * size_x, size_y, item->color );
+                }
+            }
+        }
+    }
+}
+
+/**
+ * Fills a rectangle of the band buffer, clipped to the band. Also used as
+ * the LCD_SpanFunc for lines.
+ */
+static void DLIST_Span( int16_t x, int16_t y, int16_t w, int16_t h,
+        uint16_t color )
+{
+    int16_t x2 = x + w;     // exclusive
+    int16_t y2 = y + h;     // exclusive
+    uint16_t *p;
+    int16_t i;
+
+    if ( x < DLIST_clip.x ) x = DLIST_clip.x;
+    if ( y < DLIST_clip.y ) y = DLIST_clip.y;
+    if ( x2 > DLIST_clip.x + DLIST_clip.w ) x2 = DLIST_clip.x + DLIST_clip.w;
+    if ( y2 > DLIST_clip.y + DLIST_clip.h ) y2 = DLIST_clip.y + DLIST_clip.h;
+    if ( x >= x2 || y >= y2 ) return;
+
+    for ( ; y < y2; y++ )
+    {
+        p = &DLIST_band[( y - DLIST_clip.y ) * DLIST_clip.w + ( x - DLIST_clip.x )];
+        for ( i = x; i < x2; i++ )
+        {
+            *p++ = color;
+        }
+    }
+}
@@ -0,0 +1,591 @@
+/**
+ * @file    fmt.c
+ * @brief   Lightweight printf for integers and fixed point, shared by the
+ *          UART and the LCD
+ */
+
+/**
+ ******************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2021 John Vedder
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************
+ */
+
+#include "main.h"
+#include "fmt.h"
+#include <stddef.h>
+
+#define FMT_DIGITS      20      // Most digits of a 64-bit value
+#define FMT_POWERS      9       // Powers of ten below 2^32, from 10
+#define FMT_POWERS64    11      // Powers of ten from 10^9 up to 2^64
+
+/*
+ * Conversion flags
+ */
+#define FMT_LEFT        0x01    // '-', pad on the right
+#define FMT_ZERO        0x02    // '0', pad with zeros after the sign
+#define FMT_PLUS        0x04    // '+', a sign on positive numbers
+#define FMT_SPACE       0x08    // ' ', a space on positive numbers
+#define FMT_FIXED       0x10    // '\'', the precision is decimal places
+#define FMT_ALT         0x20    // '#', 0x or 0X before a hexadecimal value
+
+/*
+ * Argument sizes, from the length modifier
+ */
+#define FMT_CHAR        0       // hh
+#define FMT_SHORT       1       // h
+#define FMT_INT         2       // none
+#define FMT_LONG        3       // l
+#define FMT_LLONG       4       // ll
+#define FMT_INTMAX      5       // j
+#define FMT_SIZE        6       // z
+#define FMT_PTRDIFF     7       // t
+#define FMT_LDOUBLE     8       // L
+
+/*
+ * Private Variables
+ */
+static const uint32_t FMT_powers[FMT_POWERS] = { 1000000000, 100000000,
+        10000000, 1000000, 100000, 10000, 1000, 100, 10 };
+static const uint64_t FMT_powers64[FMT_POWERS64] = { 10000000000000000000ull,
+        1000000000000000000ull, 100000000000000000ull, 10000000000000000ull,
+        1000000000000000ull, 100000000000000ull, 10000000000000ull,
+        1000000000000ull, 100000000000ull, 10000000000ull, 1000000000ull };
+static char *FMT_buffer;        // String FMT_Format() writes
+static uint16_t FMT_size;       // Size of FMT_buffer
+static uint16_t FMT_length;     // Characters in FMT_buffer
+
+/*
+ * Private Function Prototypes
+ */
+static int64_t FMT_Signed( va_list *args, uint8_t size );
+static uint64_t FMT_Unsigned( va_list *args, uint8_t size );
+static uint8_t FMT_Decimal( uint64_t value, char *digits );
+static uint8_t FMT_Digits( uint64_t value, char *digits, uint8_t flags,
+        int16_t precision, uint16_t *zeros, uint16_t *places );
+static uint8_t FMT_Hex( uint64_t value, char *digits, uint8_t upper );
+static uint8_t FMT_HexWord( uint32_t value, char *digits, uint8_t upper,
+        uint8_t all );
+static uint16_t FMT_Repeat( FMT_PutFunc put, char c, int16_t n );
+static void FMT_UartChar( uint8_t c );
+static void FMT_BufferChar( uint8_t c );
+
+extern int __io_putchar( int ch );
+
+/*
+ *  -------------------
+ *  Public Functions
+ * -------------------
+ */
+
+/**
+ * Formats its arguments, see fmt.h, passing each character to a function.
+ *
+ * @param   put     Takes the characters
+ * @param   format  The format string
+ * @param   args    The arguments
+ * @return  The number of characters passed
+ */
+uint16_t FMT_VPrint( FMT_PutFunc put, const char *format, va_list args )
+{
+    char digits[FMT_DIGITS];
+    char prefix[2];
+    const char *spec;
+    const char *text;
+    va_list ap;
+    uint16_t count = 0;
+    uint16_t length;
+    uint16_t places;
+    uint16_t zeros;
+    uint16_t i;
+    uint64_t value;
+    int64_t number;
+    int16_t width;
+    int16_t precision;
+    uint8_t flags;
+    uint8_t size;
+    uint8_t prefixLength;
+    char c;
+
+    // A copy that can be passed on by address, whatever type va_list is
+    va_copy( ap, args );
+    while ( ( c = *format++ ) != '\0' )
+    {
+        if ( c != '%' )
+        {
+            put( c );
+            count++;
+            continue;
+        }
+
+        spec = format;
+        flags = 0;
+        for ( ;; format++ )
+        {
+            if ( *format == '-' ) flags |= FMT_LEFT;
+            else if ( *format == '0' ) flags |= FMT_ZERO;
+            else if ( *format == '+' ) flags |= FMT_PLUS;
+            else if ( *format == ' ' ) flags |= FMT_SPACE;
+            else if ( *format == '\'' ) flags |= FMT_FIXED;
+            else if ( *format == '#' ) flags |= FMT_ALT;
+            else break;
+        }
+        width = 0;
+        if ( *format == '*' )
+        {
+            width = va_arg( ap, int );
+            if ( width < 0 )
+            {
+                flags |= FMT_LEFT;
+                width = -width;
+            }
+            format++;
+        }
+        while ( *format >= '0' && *format <= '9' )
+        {
+            width = width * 10 + ( *format++ - '0' );
+        }
+        precision = -1;
+        if ( *format == '.' )
+        {
+            format++;
+            precision = 0;
+            if ( *format == '*' )
+            {
+                precision = va_arg( ap, int );
+                if ( precision < 0 ) precision = -1;   // as if omitted
+                format++;
+            }
+            while ( *format >= '0' && *format <= '9' )
+            {
+                precision = precision * 10 + ( *format++ - '0' );
+            }
+        }
+        size = FMT_INT;
+        switch ( *format++ )
+        {
+            case 'h':
+                size = FMT_SHORT;
+                if ( *format == 'h' )
+                {
+                    size = FMT_CHAR;
+                    format++;
+                }
+                break;
+            case 'l':
+                size = FMT_LONG;
+                if ( *format == 'l' )
+                {
+                    size = FMT_LLONG;
+                    format++;
+                }
+                break;
+            case 'j':
+                size = FMT_INTMAX;
+                break;
+            case 'z':
+                size = FMT_SIZE;
+                break;
+            case 't':
+                size = FMT_PTRDIFF;
+                break;
+            case 'L':
+                size = FMT_LDOUBLE;
+                break;
+            default:
+                format--;
+                break;
+        }
+
+        // The characters of the conversion, the sign or 0x before them, the
+        // zeros after that and the decimal places of a number
+        text = digits;
+        prefixLength = 0;
+        zeros = 0;
+        places = 0;
+        switch ( c = *format++ )
+        {
+            case 'd':
+            case 'i':
+                number = FMT_Signed( &ap, size );
+                if ( number < 0 ) prefix[prefixLength++] = '-';
+                else if ( flags & FMT_PLUS ) prefix[prefixLength++] = '+';
+                else if ( flags & FMT_SPACE ) prefix[prefixLength++] = ' ';
+                value = ( number < 0 ) ? -(uint64_t) number : (uint64_t) number;
+                length = FMT_Digits( value, digits, flags, precision, &zeros,
+                        &places );
+                break;
+            case 'u':
+                value = FMT_Unsigned( &ap, size );
+                length = FMT_Digits( value, digits, flags, precision, &zeros,
+                        &places );
+                break;
+            case 'x':
+            case 'X':
+                value = FMT_Unsigned( &ap, size );
+                length = FMT_Hex( value, digits, c == 'X' );
+                if ( ( flags & FMT_ALT ) && value != 0 )
+                {
+                    prefix[prefixLength++] = '0';
+                    prefix[prefixLength++] = c;
+                }
+                if ( precision >= 0 )
+                {
+                    if ( precision == 0 && value == 0 ) length = 0;
+                    if ( precision > length ) zeros = precision - length;
+                }
+                break;
+            case 'c':
+                digits[0] = (char) va_arg( ap, int );
+                length = 1;
+                flags &= ~FMT_ZERO;
+                break;
+            case 's':
+                text = va_arg( ap, const char * );
+                for ( length = 0; text[length] != '\0'; length++ )
+                {
+                    if ( precision >= 0 && length == (uint16_t) precision ) break;
+                }
+                flags &= ~FMT_ZERO;
+                break;
+            case '%':
+                put( '%' );
+                count++;
+                continue;
+            default:
+                // Not supported, shown as it is with its argument skipped,
+                // so that the arguments after it stay in step
+                switch ( c )
+                {
+                    case 'o':
+                        (void) FMT_Unsigned( &ap, size );
+                        break;
+                    case 'p':
+                    case 'n':
+                        (void) va_arg( ap, void * );
+                        break;
+                    case 'a':
+                    case 'A':
+                    case 'e':
+                    case 'E':
+                    case 'f':
+                    case 'F':
+                    case 'g':
+                    case 'G':
+                        if ( size == FMT_LDOUBLE ) (void) va_arg( ap, long double );
+                        else (void) va_arg( ap, double );
+                        break;
+                }
+                // The conversion itself is passed on as an ordinary character
+                put( '%' );
+                count++;
+                for ( format--; spec < format; spec++ )
+                {
+                    put( *spec );
+                    count++;
+                }
+                continue;
+        }
+
+        // A precision pads with zeros instead of the width
+        if ( precision >= 0 && !( flags & FMT_FIXED ) ) flags &= ~FMT_ZERO;
+        width -= prefixLength + zeros + length + ( places > 0 );
+        if ( !( flags & ( FMT_LEFT | FMT_ZERO ) ) )
+            count += FMT_Repeat( put, ' ', width );
+        for ( i = 0; i < prefixLength; i++ )
+        {
+            put( prefix[i] );
+        }
+        count += prefixLength;
+        if ( ( flags & ( FMT_LEFT | FMT_ZERO ) ) == FMT_ZERO )
+            count += FMT_Repeat( put, '0', width );
+        for ( i = 0; i < zeros + length; i++ )
+        {
+            if ( places > 0 && i == zeros + length - places )
+            {
+                put( '.' );
+                count++;
+            }
+            put( ( i < zeros ) ? '0' : text[i - zeros] );
+        }
+        count += zeros + length;
+        if ( flags & FMT_LEFT ) count += FMT_Repeat( put, ' ', width );
+    }
+    va_end( ap );
+    return count;
+}
+
+/**
+ * Formats its arguments, see fmt.h, passing each character to a function.
+ *
+ * @param   put     Takes the characters
+ * @param   format  The format string
+ * @return  The number of characters passed
+ */
+uint16_t FMT_Print( FMT_PutFunc put, const char *format, ... )
+{
+    va_list args;
+    uint16_t count;
+
+    va_start( args, format );
+    count = FMT_VPrint( put, format, args );
+    va_end( args );
+    return count;
+}
+
+/**
+ * Formats its arguments to the UART, through __io_putchar() as printf()
+ * does, so the console mirrors it when it is enabled in main.c.
+ *
+ * @param   format  The format string, see fmt.h
+ * @return  The number of characters sent
+ */
+uint16_t FMT_Printf( const char *format, ... )
+{
+    va_list args;
+    uint16_t count;
+
+    va_start( args, format );
+    count = FMT_VPrint( FMT_UartChar, format, args );
+    va_end( args );
+    return count;
+}
+
+/**
+ * Formats its arguments to a string, as snprintf() does. What does not fit
+ * is dropped and the string is always terminated. Not reentrant.
+ *
+ * @param   buffer  The string
+ * @param   size    Size of the buffer, with the terminating null
+ * @param   format  The format string, see fmt.h
+ * @return  The length of the string
+ */
+uint16_t FMT_Format( char *buffer, uint16_t size, const char *format, ... )
+{
+    va_list args;
+
+    FMT_buffer = buffer;
+    FMT_size = size;
+    FMT_length = 0;
+    va_start( args, format );
+    FMT_VPrint( FMT_BufferChar, format, args );
+    va_end( args );
+    if ( size > 0 ) buffer[FMT_length] = '\0';
+    return FMT_length;
+}
+
+/**
+ * -------------------
+ *  Private Functions
+ * -------------------
+ */
+
+/**
+ * Takes a %d or %i argument of the size given by its length modifier,
+ * narrowed to a char or short for hh or h.
+ */
+static int64_t FMT_Signed( va_list *args, uint8_t size )
+{
+    switch ( size )
+    {
+        case FMT_CHAR:
+            return (signed char) va_arg( *args, int );
+        case FMT_SHORT:
+            return (short) va_arg( *args, int );
+        case FMT_LONG:
+            return va_arg( *args, long );
+        case FMT_LLONG:
+            return va_arg( *args, long long );
+        case FMT_INTMAX:
+            return va_arg( *args, intmax_t );
+        case FMT_SIZE:
+        case FMT_PTRDIFF:
+            return va_arg( *args, ptrdiff_t );
+        default:
+            return va_arg( *args, int );
+    }
+}
+
+/**
+ * Takes a %u, %x, %X or %o argument of the size given by its length
+ * modifier, narrowed to a char or short for hh or h.
+ */
+static uint64_t FMT_Unsigned( va_list *args, uint8_t size )
+{
+    switch ( size )
+    {
+        case FMT_CHAR:
+            return (unsigned char) va_arg( *args, unsigned int );
+        case FMT_SHORT:
+            return (unsigned short) va_arg( *args, unsigned int );
+        case FMT_LONG:
+            return va_arg( *args, unsigned long );
+        case FMT_LLONG:
+            return va_arg( *args, unsigned long long );
+        case FMT_INTMAX:
+            return va_arg( *args, uintmax_t );
+        case FMT_SIZE:
+        case FMT_PTRDIFF:
+            return va_arg( *args, size_t );
+        default:
+            return va_arg( *args, unsigned int );
+    }
+}
+
+/**
+ * Writes the decimal digits of a value, without leading zeros, by
+ * subtracting each power of ten as many times as it goes. Values that
+ * fit 32 bits, the usual case, never touch the 64-bit powers.
+ *
+ * @return  The number of digits
+ */
+static uint8_t FMT_Decimal( uint64_t value, char *digits )
+{
+    uint32_t low;
+    uint8_t n = 0;
+    uint8_t i = 0;
+    char digit;
+
+    if ( value > UINT32_MAX )
+    {
+        for ( i = 0; i < FMT_POWERS64; i++ )
+        {
+            digit = '0';
+            while ( value >= FMT_powers64[i] )
+            {
+                value -= FMT_powers64[i];
+                digit++;
+            }
+            if ( digit != '0' || n > 0 ) digits[n++] = digit;
+        }
+        i = 1;      // Below 10^9 now, the last of the 64-bit powers
+    }
+    low = (uint32_t) value;
+    for ( ; i < FMT_POWERS; i++ )
+    {
+        digit = '0';
+        while ( low >= FMT_powers[i] )
+        {
+            low -= FMT_powers[i];
+            digit++;
+        }
+        if ( digit != '0' || n > 0 ) digits[n++] = digit;
+    }
+    digits[n++] = '0' + low;
+    return n;
+}
+
+/**
+ * Writes the decimal digits of a %d, %i or %u value and works out the
+ * zeros before them and the decimal places from the precision: the least
+ * digits as in printf, or with FMT_FIXED the decimal places of a fixed
+ * point value, which has a digit before the point.
+ *
+ * @param   zeros   Set to the number of zeros before the digits
+ * @param   places  Set to the number of decimal places, 0 for none
+ * @return  The number of digits
+ */
+static uint8_t FMT_Digits( uint64_t value, char *digits, uint8_t flags,
+        int16_t precision, uint16_t *zeros, uint16_t *places )
+{
+    uint8_t length = FMT_Decimal( value, digits );
+
+    if ( flags & FMT_FIXED )
+    {
+        if ( precision > 0 )
+        {
+            *places = precision;
+            if ( precision >= length ) *zeros = precision + 1 - length;
+        }
+    }
+    else if ( precision >= 0 )
+    {
+        if ( precision == 0 && value == 0 ) length = 0;
+        if ( precision > length ) *zeros = precision - length;
+    }
+    return length;
+}
+
+/**
+ * Writes the hexadecimal digits of a value, without leading zeros.
+ *
+ * @return  The number of digits
+ */
+static uint8_t FMT_Hex( uint64_t value, char *digits, uint8_t upper )
+{
+    uint32_t high = (uint32_t) ( value >> 32 );
+    uint8_t n = 0;
+
+    if ( high != 0 ) n = FMT_HexWord( high, digits, upper, 0 );
+    return n + FMT_HexWord( (uint32_t) value, digits + n, upper, high != 0 );
+}
+
+/**
+ * Writes the hexadecimal digits of 32 bits, without leading zeros unless
+ * all eight are wanted, as they are for the low word of a 64-bit value.
+ *
+ * @return  The number of digits
+ */
+static uint8_t FMT_HexWord( uint32_t value, char *digits, uint8_t upper,
+        uint8_t all )
+{
+    const char *hex = upper ? "0123456789ABCDEF" : "0123456789abcdef";
+    uint8_t shift = 28;
+    uint8_t n = 0;
+
+    while ( !all && shift > 0 && ( value >> shift ) == 0 )
+    {
+        shift -= 4;
+    }
+    for ( ;; shift -= 4 )
+    {
+        digits[n++] = hex[( value >> shift ) & 0x0F];
+        if ( shift == 0 ) break;
+    }
+    return n;
+}
+
+/**
+ * Passes a character n times, none if n is not positive.
+ *
+ * @return  The number of characters passed
+ */
+static uint16_t FMT_Repeat( FMT_PutFunc put, char c, int16_t n )
+{
+    int16_t i;
+
+    for ( i = 0; i < n; i++ )
+    {
+        put( c );
+    }
+    return ( n > 0 ) ? n : 0;
+}
+
+static void FMT_UartChar( uint8_t c )
+{
+    __io_putchar( c );
+}
+
+static void FMT_BufferChar( uint8_t c )
+{
+    if ( FMT_length + 1 < FMT_size ) FMT_buffer[FMT_length++] = c;
+}
@@ -33,12 +33,25 @@
 #include "main.h"
 #include "spi.h"
 #include "lcd.h"
+#include "lcd_spi.h"
+#include "fmt.h"
 #include <stdlib.h>
+#include <string.h>
 
 #define PROGMEM
-#include "fonts/FreeMono12pt7b.h"
-#include "fonts/FreeSans12pt7b.h"
-#include "fonts/FreeSerif12pt7b.h"
+/*
+ * The Adafruit GFX font headers are included as they come. Their GFXfont
+ * initializers end at yAdvance, so flags, ranges, rangeCount and kerning
+ * are zero: an unpacked font of one range, not kerned. The fonts written
+ * by Tools/fontconv and Tools/fontpack initialize every field.
+ */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmissing-field-initializers"
+#include "Fonts/FreeMono12pt7b.h"
+#include "Fonts/FreeSans12pt7b.h"
+#include "Fonts/FreeSerif12pt7b.h"
+#pragma GCC diagnostic pop
+#include "Fonts/LatoLatin12pt.h"
 
 /* Values for Read Display MADCTL command */
 #define MADCTL_MY   0x80    // Bottom to top
@@ -49,16 +62,14 @@
 #define MADCTL_BGR  0x08    // Blue-Green-Red pixel order
 #define MADCTL_MH   0x04    // LCD refresh right to left
 
-#define CS_ACTIVE()  	HAL_GPIO_WritePin(LCD_CS_GPIO_Port, LCD_CS_Pin, GPIO_PIN_RESET)
-#define CS_IDLE()	    HAL_GPIO_WritePin(LCD_CS_GPIO_Port, LCD_CS_Pin, GPIO_PIN_SET)
-
-#define DC_COMMAND()	HAL_GPIO_WritePin(DATA_CMD_GPIO_Port, DATA_CMD_Pin, GPIO_PIN_RESET)
-#define DC_DATA()	    HAL_GPIO_WritePin(DATA_CMD_GPIO_Port, DATA_CMD_Pin, GPIO_PIN_SET)
-
-#define LCD_TIMEOUT		1000	// 1 second
-
 #define SWAP_INT16(a, b) {int16_t t = a; a=b; b=t;}                                                             \
 
+// Cohen-Sutherland outcodes, see LCD_ClipLine()
+#define LCD_OUT_LEFT    0x01
+#define LCD_OUT_RIGHT   0x02
+#define LCD_OUT_TOP     0x04
+#define LCD_OUT_BOTTOM  0x08
+
 
 uint8_t LCD_rotation;    // Display rotation (0 thru 3)
 uint16_t LCD_width;       // Display width as modified by current rotation
@@ -67,11 +78,54 @@ uint16_t LCD_height;      // Display height as modified by current rotation
 const GFXfont *LCD_font = &FreeSerif12pt7b;
 int16_t LCD_cursor_x = 0;       // x location to start print()ing text
 int16_t LCD_cursor_y = 0;       // y location to start print()ing text
-uint16_t LCD_textcolor = 0;     // 16-bit background color for print()
-uint16_t LCD_textbgcolor = 0;   // 16-bit text color for print()
+uint16_t LCD_textcolor = 0;     // 16-bit text color for print()
+uint16_t LCD_textbgcolor = 0;   // 16-bit background color for print(), transparent if LCD_textcolor
 uint8_t LCD_textsize_x = 1;  // Desired magnification in X-axis of text to print()
 uint8_t LCD_textsize_y = 1;  // Desired magnification in Y-axis of text to print()
 uint8_t LCD_wrap = 1;           // If set, 'wrap' text at right edge of display
+uint8_t LCD_useDMA = 1;         // If set, long pixel runs are sent by DMA
+uint8_t LCD_glyphSpans = 1;     // If set, glyphs are drawn in spans rather than pixel by pixel
+LCD_Stats LCD_stats;            // Display traffic counters
+
+/*
+ * Private Variables. The controller's column and page address registers are
+ * cached so LCD_SetAddrWindow() only sends the ones that change. Its memory
+ * write pointer is tracked too, so pixels that land where the controller
+ * would write next anyway continue the memory write in progress.
+ */
+static uint8_t LCD_addrValid = 0;   // non-zero when the cached addresses are known
+static uint16_t LCD_addrX1;         // Cached CASET start column
+static uint16_t LCD_addrX2;         // Cached CASET end column
+static uint16_t LCD_addrY1;         // Cached PASET start page
+static uint16_t LCD_addrY2;         // Cached PASET end page
+static uint8_t LCD_ramwrOpen = 0;   // non-zero while the last command sent was RAMWR or RAMWRC
+static uint32_t LCD_ramwrTransaction;   // LCD_stats.transactions when it was sent
+static uint16_t LCD_ptrX;           // Column the controller writes next
+static uint16_t LCD_ptrY;           // Page the controller writes next
+static const GFXglyph *LCD_printPrev;   // Glyph LCD_Printf() drew last, for kerning
+
+/*
+ * Private Function Prototypes
+ */
+static void LCD_StartRamWrite( void );
+static void LCD_ContinueRamWrite( void );
+static void LCD_OpenWindow( uint16_t x, uint16_t y, uint16_t w, uint16_t h );
+static void LCD_AdvancePointer( uint32_t len );
+static void LCD_StreamColor( uint16_t color, uint32_t len );
+static uint8_t LCD_GlyphRun( const uint8_t *bitmap, uint16_t bit, uint8_t len,
+        uint8_t *set );
+static uint8_t LCD_GlyphCode( const uint8_t *data, uint16_t pos );
+static void LCD_StartGlyphRow( LCD_GlyphReader *reader );
+static uint8_t LCD_OutCode( int32_t x, int32_t y );
+static uint8_t LCD_ClipLine( int16_t *x0, int16_t *y0, int16_t *x1,
+        int16_t *y1 );
+static int32_t LCD_MulDiv( int32_t a, int32_t b, int32_t c );
+static void LCD_PutChar( uint16_t c, const GFXglyph **prev );
+static void LCD_PrintChar( uint8_t c );
+static void LCD_CharBounds( uint16_t c, const GFXglyph **prev, int16_t *x,
+        int16_t *y, int16_t *minx, int16_t *miny, int16_t *maxx, int16_t *maxy );
+static void LCD_TextBounds( int16_t x, int16_t y, const uint8_t *text,
+        uint8_t utf8, LCD_Rect *bounds );
 
 ///**
 // *  Sends a single Command byte without any data
@@ -97,15 +151,14 @@ uint8_t LCD_wrap = 1;           // If set, 'wrap' text at right edge of display
 static void LCD_sendCommand( uint8_t commandByte, uint8_t *dataBytes,
         uint8_t numDataBytes )
 {
-    CS_ACTIVE( );	// Start Transaction
-    DC_COMMAND( );	// Command mode
-    HAL_SPI_Transmit( &hspi1, &commandByte, 1, LCD_TIMEOUT );
-    DC_DATA( );  // Data Mode
+    LCD_SPI_Begin( );  // Start Transaction
+    LCD_SPI_Command( commandByte );
+    LCD_ramwrOpen = 0;  // Any other command ends a memory write
     if ( numDataBytes > 0 )
     {
-        HAL_SPI_Transmit( &hspi1, dataBytes, numDataBytes, LCD_TIMEOUT );
+        LCD_SPI_Data( dataBytes, numDataBytes );
     }
-    CS_IDLE( );  // End Transaction
+    LCD_SPI_End( );  // End Transaction
 }
 
 // clang-format off
@@ -142,6 +195,7 @@ static const uint8_t LCD_init_cmds[] =
 void LCD_Init( void )
 {
     LCD_sendCommand( ILI9341_SWRESET, NULL, 0 );  // Engage software reset
+    LCD_addrValid = 0;
     HAL_Delay( 150 );
 
     uint8_t cmd;
@@ -210,7 +264,9 @@ void LCD_InvertDisplay( uint8_t invert )
 /**
  *  Scroll display memory.
  *
- *   @param   y How many pixels to scroll display by
+ *   @param   y Memory row shown at the top of the scrolling area, from the
+ *              top margin to the top margin plus the scrolling area height
+ *              less one
  */
 void LCD_ScrollTo( uint16_t y )
 {
@@ -231,7 +287,7 @@ void LCD_SetScrollMargins( uint16_t top, uint16_t bottom )
     // TFA+VSA+BFA must equal 320
     if ( top + bottom <= LCD_HEIGHT )
     {
-        uint16_t middle = LCD_HEIGHT - top + bottom;
+        uint16_t middle = LCD_HEIGHT - ( top + bottom );
         uint8_t data[6];
         data[0] = top >> 8;
         data[1] = top & 0xff;
@@ -243,6 +299,16 @@ void LCD_SetScrollMargins( uint16_t top, uint16_t bottom )
     }
 }
 
+/**
+ * Clears the display traffic counters in LCD_stats.
+ */
+void LCD_ResetStats( void )
+{
+    LCD_WaitDMA( );
+    memset( &LCD_stats, 0, sizeof( LCD_stats ) );
+    LCD_ramwrOpen = 0;  // LCD_ramwrTransaction is no longer comparable
+}
+
 /**
  * Converts a 24-bit RGB (8 bits each) to a 16-bit RGB "565" color.
  */
@@ -259,6 +325,24 @@ uint16_t LCD_Color565( uint8_t r, uint8_t g, uint8_t b )
  * -------------------------------------------------------------------------
  */
 
+/**
+ * Starts a batch of writes that share one SPI transaction, CS stays active
+ * until the matching LCD_EndWrite(). Batches nest, so drawing functions can
+ * be called inside a batch.
+ */
+void LCD_StartWrite( void )
+{
+    LCD_SPI_Begin( );
+}
+
+/**
+ * Ends a batch of writes started with LCD_StartWrite().
+ */
+void LCD_EndWrite( void )
+{
+    LCD_SPI_End( );
+}
+
 /**
  *   Set the "address window" - the rectangle we will write to RAM with
  *   the next chunk of SPI data writes. The ILI9341 will automatically wrap
@@ -277,23 +361,47 @@ void LCD_SetAddrWindow( uint16_t x1, uint16_t y1, uint16_t w, uint16_t h )
      *  the correct order
      */
     uint8_t buffer[4];
-    uint16_t end;
+    uint16_t x2 = x1 + w - 1;
+    uint16_t y2 = y1 + h - 1;
 
-    end = x1 + w - 1;
-    buffer[0] = x1 >> 8;
-    buffer[1] = x1;
-    buffer[2] = end >> 8;
-    buffer[3] = end;
-    LCD_sendCommand( ILI9341_CASET, buffer, 4 );  // Column address set
+    LCD_StartWrite( );
 
-    end = y1 + h - 1;
-    buffer[0] = y1 >> 8;
-    buffer[1] = y1;
-    buffer[2] = end >> 8;
-    buffer[3] = end;
-    LCD_sendCommand( ILI9341_PASET, buffer, 4 );  // Row address set
+    if ( !LCD_addrValid || ( x1 != LCD_addrX1 ) || ( x2 != LCD_addrX2 ) )
+    {
+        buffer[0] = x1 >> 8;
+        buffer[1] = x1;
+        buffer[2] = x2 >> 8;
+        buffer[3] = x2;
+        LCD_SPI_Command( ILI9341_CASET );  // Column address set
+        LCD_SPI_Data( buffer, 4 );
+        LCD_addrX1 = x1;
+        LCD_addrX2 = x2;
+        LCD_ramwrOpen = 0;
+    }
+    else
+    {
+        LCD_stats.cmdBytesSaved += 5;
+    }
+
+    if ( !LCD_addrValid || ( y1 != LCD_addrY1 ) || ( y2 != LCD_addrY2 ) )
+    {
+        buffer[0] = y1 >> 8;
+        buffer[1] = y1;
+        buffer[2] = y2 >> 8;
+        buffer[3] = y2;
+        LCD_SPI_Command( ILI9341_PASET );  // Row address set
+        LCD_SPI_Data( buffer, 4 );
+        LCD_addrY1 = y1;
+        LCD_addrY2 = y2;
+        LCD_ramwrOpen = 0;
+    }
+    else
+    {
+        LCD_stats.cmdBytesSaved += 5;
+    }
 
-    //sendCommand( ILI9341_RAMWR, NULL,0 );  // Write to RAM
+    LCD_addrValid = 1;
+    LCD_EndWrite( );
 }
 
 /**
@@ -303,21 +411,125 @@ void LCD_SetAddrWindow( uint16_t x1, uint16_t y1, uint16_t w, uint16_t h )
  */
 void LCD_WriteColor( uint16_t color, uint32_t len )
 {
-    uint8_t buffer[2];
-    uint8_t cmd = ILI9341_RAMWR;
+    LCD_SPI_Begin( );  // Start Transaction
+    LCD_StartRamWrite( );
+    LCD_StreamColor( color, len );
+    LCD_SPI_End( );  // End Transaction
+}
+
+/**
+ * Block fill operation on from where the last pixels written to the address
+ * window ended, see LCD_ContinuePixels(). 'len' MUST be >= 1.
+ */
+void LCD_ContinueColor( uint16_t color, uint32_t len )
+{
+    LCD_SPI_Begin( );  // Start Transaction
+    LCD_ContinueRamWrite( );
+    LCD_StreamColor( color, len );
+    LCD_SPI_End( );  // End Transaction
+}
+
+/**
+ * Block fill operation using the DMA. Returns as soon as the transfer has
+ * started, the optional callback is invoked (from interrupt context) once
+ * the last pixel has been sent. Requires LCD_SetAddrWindow() has previously
+ * been called to set the fill bounds. 'len' MUST be >= 1.
+ *
+ * @param   color     16-bit fill color in '565' RGB format.
+ * @param   len       Number of pixels to fill.
+ * @param   callback  Function to call on completion, or NULL.
+ */
+void LCD_WriteColorDMA( uint16_t color, uint32_t len, LCD_DMACallback callback )
+{
+    LCD_SPI_Begin( );  // Start Transaction, ended when the DMA completes
+    LCD_StartRamWrite( );
+    LCD_SPI_ColorDMA( color, len, callback );
+    LCD_AdvancePointer( len );
+}
+
+/**
+ * Streams a buffer of pixels using the DMA. Returns as soon as the transfer
+ * has started, the optional callback is invoked (from interrupt context) once
+ * the last pixel has been sent. The buffer must remain valid until then.
+ * Requires LCD_SetAddrWindow() has previously been called.
+ *
+ * @param   pixels    Pixels in '565' RGB format.
+ * @param   len       Number of pixels to send, MUST be >= 1.
+ * @param   callback  Function to call on completion, or NULL.
+ */
+void LCD_WritePixelsDMA( const uint16_t *pixels, uint32_t len,
+        LCD_DMACallback callback )
+{
+    LCD_SPI_Begin( );  // Start Transaction, ended when the DMA completes
+    LCD_StartRamWrite( );
+    LCD_SPI_PixelsDMA( pixels, len, callback );
+    LCD_AdvancePointer( len );
+}
+
+/**
+ * Streams a buffer of pixels and waits for it to complete. Uses the DMA when
+ * LCD_useDMA is set and the buffer is long enough to be worth it.
+ * Requires LCD_SetAddrWindow() has previously been called.
+ *
+ * @param   pixels    Pixels in '565' RGB format.
+ * @param   len       Number of pixels to send, MUST be >= 1.
+ */
+void LCD_WritePixels( const uint16_t *pixels, uint32_t len )
+{
+    if ( LCD_useDMA && ( len >= LCD_DMA_MIN_PIXELS ) )
+    {
+        LCD_WritePixelsDMA( pixels, len, NULL );
+        LCD_WaitDMA( );
+        return;
+    }
 
-    buffer[0] = color >> 8;
-    buffer[1] = color;
+    LCD_SPI_Begin( );  // Start Transaction
+    LCD_StartRamWrite( );
+    LCD_SPI_Pixels( pixels, len );
+    LCD_AdvancePointer( len );
+    LCD_SPI_End( );  // End Transaction
+}
 
-    CS_ACTIVE( );    // Start Transaction
-    DC_COMMAND( );  // Command mode
-    HAL_SPI_Transmit( &hspi1, &cmd, 1, LCD_TIMEOUT );
-    DC_DATA( );  // Data Mode
-    while ( len-- )
+/**
+ * Streams a buffer of pixels on from where the last pixels written to the
+ * address window ended, so an image can be sent through one window in
+ * pieces, see LCD_ContinueRamWrite(). Waits for it to complete.
+ *
+ * @param   pixels    Pixels in '565' RGB format.
+ * @param   len       Number of pixels to send, MUST be >= 1.
+ */
+void LCD_ContinuePixels( const uint16_t *pixels, uint32_t len )
+{
+    if ( LCD_useDMA && ( len >= LCD_DMA_MIN_PIXELS ) )
     {
-        HAL_SPI_Transmit( &hspi1, buffer, 2, LCD_TIMEOUT );
+        LCD_ContinuePixelsDMA( pixels, len, NULL );
+        LCD_WaitDMA( );
+        return;
     }
-    CS_IDLE( );  // End Transaction
+
+    LCD_SPI_Begin( );  // Start Transaction
+    LCD_ContinueRamWrite( );
+    LCD_SPI_Pixels( pixels, len );
+    LCD_AdvancePointer( len );
+    LCD_SPI_End( );  // End Transaction
+}
+
+/**
+ * Streams a buffer of pixels using the DMA, on from where the last pixels
+ * written to the address window ended. Returns as soon as the transfer has
+ * started, see LCD_WritePixelsDMA().
+ *
+ * @param   pixels    Pixels in '565' RGB format.
+ * @param   len       Number of pixels to send, MUST be >= 1.
+ * @param   callback  Function to call on completion, or NULL.
+ */
+void LCD_ContinuePixelsDMA( const uint16_t *pixels, uint32_t len,
+        LCD_DMACallback callback )
+{
+    LCD_SPI_Begin( );  // Start Transaction, ended when the DMA completes
+    LCD_ContinueRamWrite( );
+    LCD_SPI_PixelsDMA( pixels, len, callback );
+    LCD_AdvancePointer( len );
 }
 
 /**
@@ -336,14 +548,18 @@ void LCD_WriteColor( uint16_t color, uint32_t len )
 void LCD_WriteFillRectPreclipped( int16_t x, int16_t y, int16_t w, int16_t h,
         uint16_t color )
 {
-    LCD_SetAddrWindow( x, y, w, h );
-    LCD_WriteColor( color, (uint32_t) w * h );
+    LCD_StartWrite( );
+    LCD_OpenWindow( x, y, w, h );
+    LCD_StreamColor( color, (uint32_t) w * h );
+    LCD_EndWrite( );
 }
 
 /**
- *   Write a line using Bresenham's algorithm.
+ *   Write a line using Bresenham's algorithm, sliced into runs, see
+ *   LCD_RasterLine().
  *
- *   Clip bounds are NOT checked.
+ *   Clip bounds are NOT checked against the end points, but the runs are
+ *   clipped to the display.
  *
  *   @param    x0  Start point x coordinate
  *   @param    y0  Start point y coordinate
@@ -353,6 +569,36 @@ void LCD_WriteFillRectPreclipped( int16_t x, int16_t y, int16_t w, int16_t h,
  */
 void LCD_WriteLine( int16_t x0, int16_t y0, int16_t x1, int16_t y1,
         uint16_t color )
+{
+    LCD_Rect clip = { 0, 0, LCD_width, LCD_height };
+
+    LCD_StartWrite( );
+    LCD_RasterLine( x0, y0, x1, y1, color, &clip, LCD_WriteFillRectPreclipped );
+    LCD_EndWrite( );
+}
+
+/**
+ *   Rasterize a line using Bresenham's algorithm, sliced into runs. A shallow
+ *   line is a series of horizontal runs and a steep one a series of vertical
+ *   runs. The length of each run follows from Bresenham's error term, so
+ *   each run is output as one span rather than pixel by pixel, and the
+ *   pixels are the same.
+ *
+ *   The runs are clipped: rasterizing starts at the first column (or row, if
+ *   steep) that can reach the clip rectangle, with the error term it would
+ *   have there, and runs or parts of runs outside are skipped. So a clipped
+ *   line has exactly the pixels of the whole line.
+ *
+ *   @param    x0  Start point x coordinate
+ *   @param    y0  Start point y coordinate
+ *   @param    x1  End point x coordinate
+ *   @param    y1  End point y coordinate
+ *   @param    color 16-bit 5-6-5 Color to draw with
+ *   @param    clip  The clip rectangle
+ *   @param    span  Called with each (clipped) run
+ */
+void LCD_RasterLine( int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+        uint16_t color, const LCD_Rect *clip, LCD_SpanFunc span )
 {
     int16_t steep = abs( y1 - y0 ) > abs( x1 - x0 );
     if ( steep )
@@ -367,12 +613,12 @@ void LCD_WriteLine( int16_t x0, int16_t y0, int16_t x1, int16_t y1,
         SWAP_INT16( y0, y1 );
     }
 
-    int16_t dx, dy;
-    dx = x1 - x0;
+    int32_t dx, dy;
+    dx = (int32_t) x1 - x0;
     dy = abs( y1 - y0 );
 
-    int16_t err = dx / 2;
-    int16_t ystep;
+    int32_t err = dx / 2;
+    int32_t ystep;
 
     if ( y0 < y1 )
     {
@@ -383,22 +629,60 @@ void LCD_WriteLine( int16_t x0, int16_t y0, int16_t x1, int16_t y1,
         ystep = -1;
     }
 
-    for ( ; x0 <= x1; x0++ )
+    // Clip bounds along the major (x) and minor (y) axes
+    int32_t xmin = steep ? clip->y : clip->x;
+    int32_t xmax = xmin + ( steep ? clip->h : clip->w ) - 1;
+    int32_t ymin = steep ? clip->x : clip->y;
+    int32_t ymax = ymin + ( steep ? clip->w : clip->h ) - 1;
+    int32_t x = ( x0 < xmin ) ? xmin : x0;
+    int32_t last = ( x1 > xmax ) ? xmax : x1;
+    int32_t y;
+    int32_t run;
+
+    // Narrow x to where y can be within the clip bounds, give or take a run
+    if ( dy > 0 )
     {
-        if ( steep )
-        {
-            LCD_DrawPixel( y0, x0, color );
-        }
-        else
+        int32_t lo = ( ystep > 0 ) ? ymin - y0 : y0 - ymax;
+        int32_t hi = ( ystep > 0 ) ? ymax - y0 : y0 - ymin;
+        int32_t slack = dx / dy + 1;
+
+        lo = x0 + LCD_MulDiv( dx, lo, dy ) - slack;
+        hi = x0 + LCD_MulDiv( dx, hi, dy ) + slack;
+        if ( x < lo ) x = lo;
+        if ( last > hi ) last = hi;
+    }
+
+    if ( x > last ) return;
+
+    // Bresenham's state at x, the error term is always in [0, dx)
+    int64_t e = err - (int64_t) ( x - x0 ) * dy;
+    int32_t steps = ( e < 0 ) ? (int32_t) ( ( dx - 1 - e ) / dx ) : 0;
+    err = (int32_t) ( e + (int64_t) steps * dx );
+    y = y0 + ystep * steps;
+
+    while ( x <= last )
+    {
+        // Bresenham steps y once the error term goes negative
+        run = last - x + 1;
+        if ( ( dy > 0 ) && ( err / dy < run ) )
         {
-            LCD_DrawPixel( x0, y0, color );
+            run = err / dy + 1;
         }
-        err -= dy;
-        if ( err < 0 )
+
+        if ( ( y >= ymin ) && ( y <= ymax ) )
         {
-            y0 += ystep;
-            err += dx;
+            if ( steep )
+            {
+                span( y, x, 1, run, color );
+            }
+            else
+            {
+                span( x, y, run, 1, color );
+            }
         }
+        x += run;
+        err += dx - run * dy;
+        y += ystep;
     }
 }
 
@@ -421,8 +705,10 @@ void LCD_DrawPixel( int16_t x, int16_t y, uint16_t color )
 {
     if ( ( x >= 0 ) && ( x < LCD_width ) && ( y >= 0 ) && ( y < LCD_height ) )
     {
-        LCD_SetAddrWindow( x, y, 1, 1 );
-        LCD_WriteColor( color, 1 );
+        LCD_StartWrite( );
+        LCD_OpenWindow( x, y, 1, 1 );
+        LCD_StreamColor( color, 1 );
+        LCD_EndWrite( );
     }
 }
 
@@ -464,7 +750,7 @@ void LCD_DrawFillRect( int16_t x, int16_t y, int16_t w, int16_t h,
     int16_t y2 = y + h - 1;
 
     // Completely Off screen does not display
-    if ( x > LCD_width || x2 < 0 || y > LCD_height || y2 < 0 ) return;
+    if ( x >= LCD_width || x2 < 0 || y >= LCD_height || y2 < 0 ) return;
 
     // Clip left
     if ( x < 0 )
@@ -524,7 +810,8 @@ void LCD_DrawVLine( int16_t x, int16_t y, int16_t h, uint16_t color )
 
 /**
  *  Draw a line. Edge clipping and rejection
- * is performed.
+ * is performed. A sloped line is clipped to the display (Cohen-Sutherland)
+ * before it is rasterized.
  *
  *   @param    x0  Start point x coordinate
  *   @param    y0  Start point y coordinate
@@ -537,15 +824,26 @@ void LCD_DrawLine( int16_t x0, int16_t y0, int16_t x1, int16_t y1,
 {
     if ( x0 == x1 )
     {
+        if ( y0 > y1 ) SWAP_INT16( y0, y1 );
         LCD_DrawVLine( x0, y0, y1 - y0 + 1, color );
     }
     else if ( y0 == y1 )
     {
+        if ( x0 > x1 ) SWAP_INT16( x0, x1 );
         LCD_DrawHLine( x0, y0, x1 - x0 + 1, color );
     }
     else
     {
-        LCD_WriteLine( x0, y0, x1, y1, color );
+        int16_t cx0 = x0;
+        int16_t cy0 = y0;
+        int16_t cx1 = x1;
+        int16_t cy1 = y1;
+
+        // LCD_WriteLine() clips the runs, this rejects lines that miss the display
+        if ( LCD_ClipLine( &cx0, &cy0, &cx1, &cy1 ) )
+        {
+            LCD_WriteLine( x0, y0, x1, y1, color );
+        }
     }
 }
 
@@ -561,10 +859,12 @@ void LCD_DrawLine( int16_t x0, int16_t y0, int16_t x1, int16_t y1,
  */
 void LCD_DrawRect( int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color )
 {
+    LCD_StartWrite( );
     LCD_DrawHLine( x, y, w, color );
     LCD_DrawHLine( x, y + h - 1, w, color );
     LCD_DrawVLine( x, y, h, color );
     LCD_DrawVLine( x + w - 1, y, h, color );
+    LCD_EndWrite( );
 }
 
 /**
@@ -602,42 +902,62 @@ void LCD_SetCursor( uint8_t curs_x, uint8_t curs_y )
 }
 
 /**
- * Set the text cursor position in x and y.
+ * Set the text color, with a transparent background.
  *
  *  @param    color 16-bit 5-6-5 Color to draw character with.
  */
 void LCD_SetTextColor( uint16_t color )
 {
     LCD_textcolor = color;
+    LCD_textbgcolor = color;
+}
+
+/**
+ * Set the text color and the background color, which makes text opaque
+ * unless they are the same. Anti-aliased text is blended onto bgcolor.
+ *
+ *  @param    color   16-bit 5-6-5 Color to draw character with.
+ *  @param    bgcolor 16-bit 5-6-5 Color to draw the background with.
+ */
+void LCD_SetTextColors( uint16_t color, uint16_t bgcolor )
+{
+    LCD_textcolor = color;
+    LCD_textbgcolor = bgcolor;
 }
 
 /**
  *  Draw a single character. Assumes non-printable and control characters are filtered out.
+ *  The glyph is drawn in horizontal runs of pixels. When LCD_textbgcolor
+ *  differs from LCD_textcolor, as set by LCD_SetTextColors(), the
+ *  background of the glyph's bounding box is drawn too (opaque), otherwise
+ *  it is left as it is (transparent). An
+ *  opaque glyph that is entirely on screen is streamed into one address
+ *  window, row by row.
  *
  *  @param    x   Bottom left corner x coordinate
  *  @param    y   Bottom left corner y coordinate
- *  @param    c   The 8-bit font-indexed (character)
+ *  @param    c   The character, nothing is drawn if the font has no glyph for it
  *  @param    color 16-bit 5-6-5 Color to draw character with
  *  @param    size_x  Font magnification level in X-axis, 1 is 'original' size
  *  @param    size_y  Font magnification level in Y-axis, 1 is 'original' size
  */
-void LCD_WriteChar( int16_t x, int16_t y, unsigned char c, uint16_t color,
+void LCD_WriteChar( int16_t x, int16_t y, uint16_t c, uint16_t color,
         uint8_t size_x, uint8_t size_y )
 {
 
-    c -= ( LCD_font->first );
-    GFXglyph *glyph = LCD_font->glyph + c;
-    const uint8_t *bitmap = LCD_font->bitmap;
+    const GFXglyph *glyph = LCD_GetGlyph( LCD_font, c );
+    LCD_GlyphReader reader;
+
+    if ( glyph == NULL ) return;
 
-    uint16_t bo = glyph->bitmapOffset;
     uint8_t w = glyph->width;
     uint8_t h = glyph->height;
     int8_t xo = glyph->xOffset;
     int8_t yo = glyph->yOffset;
     uint8_t xx;
     uint8_t yy;
-    uint8_t bits = 0;
-    uint8_t bit = 0;
+    uint8_t run = 0;
+    uint8_t set = 0;
     int16_t xo16 = 0;
     int16_t yo16 = 0;
 
@@ -647,15 +967,24 @@ void LCD_WriteChar( int16_t x, int16_t y, unsigned char c, uint16_t color,
         yo16 = yo;
     }
 
+    if ( LCD_glyphSpans )
+    {
+        LCD_WriteGlyphSpans( x + xo * size_x, y + yo * size_y, LCD_font,
+                glyph, color, size_x, size_y );
+        return;
+    }
+
+    LCD_OpenGlyph( &reader, LCD_font, glyph );
+    LCD_StartWrite( );
     for ( yy = 0; yy < h; yy++ )
     {
-        for ( xx = 0; xx < w; xx++ )
+        for ( xx = 0; xx < w; xx++, run-- )
         {
-            if ( !( bit++ & 7 ) )
+            if ( run == 0 )
             {
-                bits = (uint8_t) ( bitmap[bo++ ] );
+                run = LCD_ReadGlyphRun( &reader, &set );
             }
-            if ( bits & 0x80 )
+            if ( set )
             {
                 if ( size_x == 1 && size_y == 1 )
                 {
@@ -667,31 +996,807 @@ void LCD_WriteChar( int16_t x, int16_t y, unsigned char c, uint16_t color,
                             y + ( yo16 + yy ) * size_y, size_x, size_y, color );
                 }
             }
-            bits <<= 1;
         }
     }
+    LCD_EndWrite( );
+}
+
+/**
+ *  Draw a glyph bitmap in horizontal runs of pixels, see LCD_WriteChar().
+ *  Edge clipping is performed here.
+ *
+ *  @param    x       Top left corner x coordinate
+ *  @param    y       Top left corner y coordinate
+ *  @param    font    The font of the glyph, plain or packed
+ *  @param    glyph   The glyph
+ *  @param    color   16-bit 5-6-5 Color to draw character with
+ *  @param    size_x  Font magnification level in X-axis, 1 is 'original' size
+ *  @param    size_y  Font magnification level in Y-axis, 1 is 'original' size
+ */
+void LCD_WriteGlyphSpans( int16_t x, int16_t y, const GFXfont *font,
+        const GFXglyph *glyph, uint16_t color, uint8_t size_x, uint8_t size_y )
+{
+    uint8_t opaque = ( LCD_textbgcolor != LCD_textcolor );
+    uint8_t w = glyph->width;
+    uint8_t h = glyph->height;
+    LCD_GlyphReader reader;
+    LCD_GlyphReader row;
+    uint8_t xx;
+    uint8_t yy;
+    uint8_t sy;
+    uint8_t run;
+    uint8_t set;
+
+    if ( ( w == 0 ) || ( h == 0 ) ) return;
+
+    LCD_OpenGlyph( &reader, font, glyph );
+    LCD_StartWrite( );
+    if ( opaque && ( x >= 0 ) && ( y >= 0 )
+            && ( x + w * size_x <= LCD_width )
+            && ( y + h * size_y <= LCD_height ) )
+    {
+        // One window for the whole glyph, each row is sent size_y times
+        LCD_OpenWindow( x, y, w * size_x, h * size_y );
+        for ( yy = 0; yy < h; yy++ )
+        {
+            row = reader;
+            for ( sy = 0; sy < size_y; sy++ )
+            {
+                for ( xx = 0, reader = row; xx < w; xx += run )
+                {
+                    run = LCD_ReadGlyphRun( &reader, &set );
+                    LCD_StreamColor( set ? color : LCD_textbgcolor,
+                            (uint32_t) run * size_x );
+                }
+            }
+        }
+    }
+    else
+    {
+        // A filled rectangle per run, the background ones only when opaque
+        for ( yy = 0; yy < h; yy++ )
+        {
+            for ( xx = 0; xx < w; xx += run )
+            {
+                run = LCD_ReadGlyphRun( &reader, &set );
+                if ( set || opaque )
+                {
+                    LCD_DrawFillRect( x + xx * size_x, y + yy * size_y,
+                            run * size_x, size_y,
+                            set ? color : LCD_textbgcolor );
+                }
+            }
+        }
+    }
+    LCD_EndWrite( );
+}
+
+/**
+ *  Starts reading the pixels of a glyph, see LCD_ReadGlyphRun().
+ *
+ *  @param    reader  The reader to set up
+ *  @param    font    The font of the glyph, plain or packed
+ *  @param    glyph   The glyph
+ */
+void LCD_OpenGlyph( LCD_GlyphReader *reader, const GFXfont *font,
+        const GFXglyph *glyph )
+{
+    uint16_t offset = glyph->bitmapOffset;
+
+    reader->packed = 0;
+    if ( font->flags & LCD_FONT_PACKED )
+    {
+        reader->packed = !( offset & LCD_GLYPH_PLAIN );
+        offset &= ~LCD_GLYPH_PLAIN;
+    }
+    reader->data = font->bitmap + offset;
+    reader->pos = 0;
+    reader->rowPos = 0;
+    reader->resume = 0;
+    reader->width = glyph->width;
+    reader->col = 0;
+    reader->repeat = 0;
+    reader->set = 0;
+}
+
+/**
+ *  Reads the next run of equal pixels of a glyph, from left to right and
+ *  top to bottom. A run does not go past the end of a row. Packed glyphs
+ *  are decoded as they are read.
+ *
+ *  @param    reader  The reader, see LCD_OpenGlyph()
+ *  @param    set     Returns non-zero if the run is of set pixels
+ *  @return   The run length, at least 1
+ */
+uint8_t LCD_ReadGlyphRun( LCD_GlyphReader *reader, uint8_t *set )
+{
+    uint8_t run;
+    uint8_t code;
+
+    if ( !reader->packed )
+    {
+        run = LCD_GlyphRun( reader->data, reader->pos,
+                reader->width - reader->col, set );
+        reader->pos += run;
+    }
+    else
+    {
+        if ( reader->col == 0 )
+        {
+            LCD_StartGlyphRow( reader );
+        }
+        do
+        {
+            // Runs of 0 only start a row with a set pixel or join long runs
+            run = 0;
+            for ( ;; )
+            {
+                code = LCD_GlyphCode( reader->data, reader->pos++ );
+                run += code;
+                if ( ( code != LCD_GLYPH_LONG_RUN )
+                        || ( reader->col + run >= reader->width )
+                        || ( LCD_GlyphCode( reader->data, reader->pos ) != 0 ) )
+                {
+                    break;
+                }
+                reader->pos++;  // A run of 0 of the other color, the run goes on
+            }
+            *set = reader->set;
+            reader->set ^= 0x80;
+        } while ( run == 0 );
+    }
+
+    reader->col += run;
+    if ( reader->col >= reader->width )
+    {
+        reader->col = 0;
+    }
+    return run;
+}
+
+/**
+ *  Skips rows of a glyph, see LCD_ReadGlyphRun().
+ *
+ *  @param    reader  The reader, at the start of a row
+ *  @param    rows    The number of rows to skip
+ */
+void LCD_SkipGlyphRows( LCD_GlyphReader *reader, uint8_t rows )
+{
+    uint8_t set;
+
+    if ( !reader->packed )
+    {
+        reader->pos += (uint16_t) rows * reader->width;
+        return;
+    }
+    while ( rows-- > 0 )
+    {
+        do
+        {
+            LCD_ReadGlyphRun( reader, &set );
+        } while ( reader->col != 0 );
+    }
+}
+
+/**
+ *  Finds the glyph of a character. Fonts with sparse ranges are searched
+ *  by halving, so the cost grows with the log of the number of ranges.
+ *
+ *  @param    font    The font
+ *  @param    c       The character, a Unicode code point for fonts with ranges
+ *  @return   The glyph, NULL if the font has none for 'c'
+ */
+const GFXglyph *LCD_GetGlyph( const GFXfont *font, uint16_t c )
+{
+    const LCD_GlyphRange *range;
+    uint8_t lo = 0;
+    uint8_t hi = font->rangeCount;
+    uint8_t mid;
+
+    if ( ( c < font->first ) || ( c > font->last ) ) return NULL;
+    if ( font->ranges == NULL ) return font->glyph + ( c - font->first );
+
+    // The first range that ends at or after 'c', there is one as c <= last
+    while ( lo < hi )
+    {
+        mid = ( lo + hi ) >> 1;
+        if ( font->ranges[mid].last < c )
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    range = &font->ranges[lo];
+    if ( c < range->first ) return NULL;
+    return font->glyph + range->glyph + ( c - range->first );
+}
+
+/**
+ *  Returns the number of glyphs in a font's glyph array.
+ */
+uint16_t LCD_GetGlyphCount( const GFXfont *font )
+{
+    const LCD_GlyphRange *range;
+
+    if ( font->ranges == NULL ) return font->last - font->first + 1;
+    range = &font->ranges[font->rangeCount - 1];
+    return range->glyph + ( range->last - range->first ) + 1;
+}
+
+/**
+ *  Returns how far a font's glyphs reach above and below the baseline, at
+ *  text size 1: the tallest glyph sets the ascent, the deepest the descent.
+ *
+ *  @param    font    The font
+ *  @param    ascent  Set to the pixel rows above the baseline
+ *  @param    descent Set to the pixel rows from the baseline down
+ */
+void LCD_GetFontExtent( const GFXfont *font, uint16_t *ascent,
+        uint16_t *descent )
+{
+    const GFXglyph *glyph;
+    uint16_t count = LCD_GetGlyphCount( font );
+    uint16_t i;
+
+    *ascent = 0;
+    *descent = 0;
+    for ( i = 0; i < count; i++ )
+    {
+        glyph = &font->glyph[i];
+        if ( -glyph->yOffset > (int16_t) *ascent ) *ascent = -glyph->yOffset;
+        if ( glyph->yOffset + glyph->height > (int16_t) *descent )
+            *descent = glyph->yOffset + glyph->height;
+    }
+}
+
+/**
+ *  Returns the kerning of a pair of glyphs: the pixels, at text size 1, to
+ *  add to the advance of the first before drawing the second. The cost is
+ *  the same for any number of pairs, a class of each glyph and the
+ *  adjustment of the pair of classes are read from tables.
+ *
+ *  @param    font    The font
+ *  @param    left    The glyph drawn first, NULL at the start of a line
+ *  @param    right   The glyph drawn after it, NULL for none
+ *  @return   The adjustment in pixels, 0 if the font has no kerning
+ */
+int8_t LCD_GetKerning( const GFXfont *font, const GFXglyph *left,
+        const GFXglyph *right )
+{
+    const LCD_Kerning *kerning = font->kerning;
+    uint8_t l;
+    uint8_t r;
+
+    if ( ( kerning == NULL ) || ( left == NULL ) || ( right == NULL ) ) return 0;
+    l = kerning->left[left - font->glyph];
+    r = kerning->right[right - font->glyph];
+    if ( ( l == 0 ) || ( r == 0 ) ) return 0;
+    return kerning->adjust[( l - 1 ) * kerning->rightClasses + ( r - 1 )];
 }
 
 /**
  *   Draws one character of data. Moves text cursor and supports newline ('\n').
+ *   A character drawn on its own is not kerned, see LCD_DrawText().
  *
- *   @param  c  The 7-bit ASCII character to draw
+ *   @param  c  The character to draw, ASCII or Latin-1, or a Unicode code
+ *              point for fonts with ranges
  */
-void LCD_DrawChar( uint8_t c )
+void LCD_DrawChar( uint16_t c )
+{
+    const GFXglyph *prev = NULL;
+
+    LCD_PutChar( c, &prev );
+}
+
+/**
+ *   Computes the bounding box of the pixels LCD_DrawText() would draw for a
+ *   string starting at (x,y), with the current font, text size and wrap
+ *   setting. Nothing is drawn and the cursor is not moved.
+ *
+ *   @param  x       Cursor x coordinate to start from
+ *   @param  y       Cursor y coordinate (baseline) to start from
+ *   @param  text    The null-terminated text string.
+ *   @param  bounds  Returns the bounding box, w and h are 0 if no pixels
+ *                   would be drawn.
+ */
+void LCD_GetTextBounds( int16_t x, int16_t y, const uint8_t *text,
+        LCD_Rect *bounds )
+{
+    LCD_TextBounds( x, y, text, 0, bounds );
+}
+
+/**
+ *   Computes the bounding box of the pixels LCD_DrawTextUTF8() would draw,
+ *   as LCD_GetTextBounds() does for LCD_DrawText().
+ *
+ *   @param  x       Cursor x coordinate to start from
+ *   @param  y       Cursor y coordinate (baseline) to start from
+ *   @param  text    The null-terminated UTF-8 text string.
+ *   @param  bounds  Returns the bounding box, w and h are 0 if no pixels
+ *                   would be drawn.
+ */
+void LCD_GetTextBoundsUTF8( int16_t x, int16_t y, const uint8_t *text,
+        LCD_Rect *bounds )
+{
+    LCD_TextBounds( x, y, text, 1, bounds );
+}
+
+/**
+ *   Draws a string of text at the current cursor position. Text must be null-terminated.
+ *   Supports newline ('\n'). See lcd_text.h to wrap it at word boundaries.
+ *   The pairs of characters are kerned if the font has kerning.
+ *
+ *   @param  text  The null-terminated text string.
+ */
+void LCD_DrawText( const uint8_t *text )
+{
+    const GFXglyph *prev = NULL;
+
+    LCD_StartWrite( );
+    while ( *text )
+    {
+        /* buffer to remove const attribute */
+        uint8_t c = (uint8_t) *text;
+        LCD_PutChar( c, &prev );
+        text++;
+    }
+    LCD_EndWrite( );
+}
+
+/**
+ *   Decodes the next character of a UTF-8 string. A malformed sequence, or
+ *   one beyond U+FFFF, decodes as LCD_UTF8_INVALID and is skipped up to the
+ *   next byte that can start a character.
+ *
+ *   @param  text  The string, moved past the character
+ *   @return The character, 0 at the end of the string
+ */
+uint16_t LCD_DecodeUTF8( const uint8_t **text )
+{
+    const uint8_t *p = *text;
+    uint32_t c = *p;
+    uint32_t min;
+    uint8_t more;
+
+    if ( c == 0 ) return 0;
+    p++;
+    if ( c < 0x80 )
+    {
+        *text = p;
+        return c;
+    }
+    if ( ( c & 0xE0 ) == 0xC0 )
+    {
+        c &= 0x1F;
+        more = 1;
+        min = 0x80;
+    }
+    else if ( ( c & 0xF0 ) == 0xE0 )
+    {
+        c &= 0x0F;
+        more = 2;
+        min = 0x800;
+    }
+    else if ( ( c & 0xF8 ) == 0xF0 )
+    {
+        c &= 0x07;
+        more = 3;
+        min = 0x10000;
+    }
+    else
+    {
+        *text = p;  // A continuation byte out of place
+        return LCD_UTF8_INVALID;
+    }
+
+    for ( ; more > 0; more--, p++ )
+    {
+        if ( ( *p & 0xC0 ) != 0x80 )
+        {
+            *text = p;  // Cut short, the byte starts the next character
+            return LCD_UTF8_INVALID;
+        }
+        c = ( c << 6 ) | ( *p & 0x3F );
+    }
+    *text = p;
+
+    // Overlong forms, surrogates and what a 16-bit font cannot hold
+    if ( ( c < min ) || ( c > 0xFFFF ) || ( ( c >= 0xD800 ) && ( c <= 0xDFFF ) ) )
+        return LCD_UTF8_INVALID;
+    return c;
+}
+
+/**
+ *   Reads the next character of a string: one byte, ASCII or Latin-1, or
+ *   a UTF-8 sequence decoded by LCD_DecodeUTF8(). The measuring and layout
+ *   functions use it so that they agree with what is drawn.
+ *
+ *   @param  text  The string, moved past the character
+ *   @param  utf8  If set the string is UTF-8
+ *   @return The character, 0 at the end of the string
+ */
+uint16_t LCD_NextChar( const uint8_t **text, uint8_t utf8 )
+{
+    uint8_t c;
+
+    if ( utf8 ) return LCD_DecodeUTF8( text );
+    c = **text;
+    if ( c != 0 ) ( *text )++;
+    return c;
+}
+
+/**
+ *   Draws a UTF-8 string of text at the current cursor position, as
+ *   LCD_DrawText() does. Characters the font has no glyph for are skipped.
+ *
+ *   @param  text  The null-terminated UTF-8 text string.
+ */
+void LCD_DrawTextUTF8( const uint8_t *text )
+{
+    const GFXglyph *prev = NULL;
+    uint16_t c;
+
+    LCD_StartWrite( );
+    while ( ( c = LCD_DecodeUTF8( &text ) ) != 0 )
+    {
+        LCD_PutChar( c, &prev );
+    }
+    LCD_EndWrite( );
+}
+
+/**
+ *   Draws formatted text at the current cursor position, as LCD_DrawText()
+ *   would draw the string, but each character goes to the glyph renderer
+ *   as it is formatted, without a buffer. See fmt.h for the conversions.
+ *
+ *   @param  format  The format string
+ *   @return The number of characters formatted
+ */
+uint16_t LCD_Printf( const char *format, ... )
+{
+    va_list args;
+    uint16_t count;
+
+    va_start( args, format );
+    LCD_printPrev = NULL;
+    LCD_StartWrite( );
+    count = FMT_VPrint( LCD_PrintChar, format, args );
+    LCD_EndWrite( );
+    va_end( args );
+    return count;
+}
+
+/**
+ * -------------------
+ *  Private Functions
+ * -------------------
+ */
+
+/**
+ * Sends RAMWR, which moves the controller's write pointer to the top left of
+ * the address window. The transaction must have been started.
+ */
+static void LCD_StartRamWrite( void )
+{
+    LCD_SPI_Command( ILI9341_RAMWR );
+    LCD_ramwrOpen = 1;
+    LCD_ramwrTransaction = LCD_stats.transactions;
+    LCD_ptrX = LCD_addrX1;
+    LCD_ptrY = LCD_addrY1;
+}
+
+/**
+ * Continues the memory write in progress: with no command at all inside the
+ * same transaction, with RAMWRC after CS was released. If another command
+ * was sent since, RAMWR starts over at the top left of the address window.
+ * The transaction must have been started.
+ */
+static void LCD_ContinueRamWrite( void )
+{
+    if ( !LCD_ramwrOpen )
+    {
+        LCD_StartRamWrite( );
+    }
+    else if ( LCD_ramwrTransaction != LCD_stats.transactions )
+    {
+        LCD_SPI_Command( ILI9341_RAMWRC );
+        LCD_ramwrTransaction = LCD_stats.transactions;
+    }
+}
+
+/**
+ * Makes the controller ready to receive the pixels of a 'w' x 'h' rectangle
+ * at (x,y), in rows. When the write pointer is already at (x,y) and the
+ * rectangle fits in what is left of the address window the memory write in
+ * progress is continued: with no command at all inside the same transaction,
+ * or with RAMWRC after CS was released. Otherwise the address window is set
+ * and RAMWR sent. A single row gets a window that is open to the right edge,
+ * or keeps the current columns when it fits them, so a run that follows on
+ * from it can continue too.
+ * The transaction must have been started.
+ *
+ *  @param  x      Horizontal position of the top left corner.
+ *  @param  y      Vertical position of the top left corner.
+ *  @param  w      Width in pixels, MUST be >= 1.
+ *  @param  h      Height in pixels, MUST be >= 1.
+ */
+static void LCD_OpenWindow( uint16_t x, uint16_t y, uint16_t w, uint16_t h )
+{
+    uint16_t x2 = x + w - 1;
+    uint16_t y2 = y + h - 1;
+
+    if ( LCD_ramwrOpen && ( x == LCD_ptrX ) && ( y == LCD_ptrY )
+            && ( ( ( h == 1 ) && ( x2 <= LCD_addrX2 ) )
+                    || ( ( x == LCD_addrX1 ) && ( x2 == LCD_addrX2 )
+                            && ( y2 <= LCD_addrY2 ) ) ) )
+    {
+        if ( LCD_ramwrTransaction == LCD_stats.transactions )
+        {
+            LCD_stats.cmdBytesSaved += 11;  // CASET, PASET and RAMWR
+        }
+        else
+        {
+            LCD_SPI_Command( ILI9341_RAMWRC );
+            LCD_ramwrTransaction = LCD_stats.transactions;
+            LCD_stats.cmdBytesSaved += 10;  // CASET and PASET
+        }
+        return;
+    }
+
+    if ( h == 1 )
+    {
+        // Keep the current columns if the row fits them, saves the CASET
+        if ( LCD_addrValid && ( x == LCD_addrX1 ) && ( x2 <= LCD_addrX2 ) )
+        {
+            x2 = LCD_addrX2;
+        }
+        else
+        {
+            x2 = LCD_width - 1;
+        }
+    }
+    LCD_SetAddrWindow( x, y, x2 - x + 1, h );
+    LCD_StartRamWrite( );
+}
+
+/**
+ * Moves the tracked write pointer on by 'len' pixels, wrapping at the edges
+ * of the address window like the controller does.
+ */
+static void LCD_AdvancePointer( uint32_t len )
+{
+    uint16_t w;
+    uint32_t pos;
+
+    // Most writes stay on the current row, avoid the (software) division
+    if ( len <= (uint32_t) ( LCD_addrX2 - LCD_ptrX ) )
+    {
+        LCD_ptrX += len;
+        return;
+    }
+
+    w = LCD_addrX2 - LCD_addrX1 + 1;
+    pos = (uint32_t) ( LCD_ptrY - LCD_addrY1 ) * w + ( LCD_ptrX - LCD_addrX1 )
+            + len;
+    pos %= (uint32_t) w * ( LCD_addrY2 - LCD_addrY1 + 1 );
+    LCD_ptrX = LCD_addrX1 + pos % w;
+    LCD_ptrY = LCD_addrY1 + pos / w;
+}
+
+/**
+ * Sends one color 'len' times after the memory write has been started, by
+ * DMA when LCD_useDMA is set and the run is long enough, and waits for it.
+ */
+static void LCD_StreamColor( uint16_t color, uint32_t len )
+{
+    if ( LCD_useDMA && ( len >= LCD_DMA_MIN_PIXELS ) )
+    {
+        LCD_SPI_Begin( );  // Ended when the DMA completes
+        LCD_SPI_ColorDMA( color, len, NULL );
+        LCD_WaitDMA( );
+    }
+    else
+    {
+        LCD_SPI_Color( color, len );
+    }
+    LCD_AdvancePointer( len );
+}
+
+/**
+ * Measures the run of equal bits that starts at bit index 'bit' of a glyph
+ * bitmap, looking at no more than 'len' bits.
+ *
+ * @param   bitmap  The glyph's bitmap, MSB first
+ * @param   bit     Index of the first bit of the run
+ * @param   len     Maximum run length, MUST be >= 1
+ * @param   set     Returns non-zero if the run is of set bits
+ * @return  The run length
+ */
+static uint8_t LCD_GlyphRun( const uint8_t *bitmap, uint16_t bit, uint8_t len,
+        uint8_t *set )
+{
+    uint8_t bits = bitmap[bit >> 3] << ( bit & 7 );
+    uint8_t value = bits & 0x80;
+    uint8_t run = 1;
+
+    while ( run < len )
+    {
+        bit++;
+        bits <<= 1;
+        if ( !( bit & 7 ) )
+        {
+            bits = bitmap[bit >> 3];
+        }
+        if ( ( bits & 0x80 ) != value ) break;
+        run++;
+    }
+
+    *set = value;
+    return run;
+}
+
+/**
+ * Returns a 4-bit code of a packed glyph.
+ *
+ * @param   data    The glyph's codes, MSB first
+ * @param   pos     Index of the code
+ */
+static uint8_t LCD_GlyphCode( const uint8_t *data, uint16_t pos )
+{
+    uint8_t code = data[pos >> 1];
+
+    return ( pos & 1 ) ? ( code & 0x0F ) : ( code >> 4 );
+}
+
+/**
+ * Starts a row of a packed glyph: a new row, or the previous row again
+ * while a repeat lasts.
+ */
+static void LCD_StartGlyphRow( LCD_GlyphReader *reader )
+{
+    reader->set = 0;
+    if ( reader->repeat == 0 )
+    {
+        if ( reader->resume )
+        {
+            reader->pos = reader->resume;
+            reader->resume = 0;
+        }
+        if ( LCD_GlyphCode( reader->data, reader->pos ) != LCD_GLYPH_REPEAT )
+        {
+            reader->rowPos = reader->pos;
+            return;
+        }
+        reader->repeat = LCD_GlyphCode( reader->data, reader->pos + 1 ) + 1;
+        reader->resume = reader->pos + 2;
+    }
+    reader->repeat--;
+    reader->pos = reader->rowPos;
+}
+
+/**
+ * Returns the Cohen-Sutherland outcode of a point: which of the edges of the
+ * clip rectangle it lies beyond, see LCD_ClipLine().
+ */
+static uint8_t LCD_OutCode( int32_t x, int32_t y )
+{
+    uint8_t code = 0;
+
+    if ( x < -1 )
+    {
+        code |= LCD_OUT_LEFT;
+    }
+    else if ( x > LCD_width )
+    {
+        code |= LCD_OUT_RIGHT;
+    }
+    if ( y < -1 )
+    {
+        code |= LCD_OUT_TOP;
+    }
+    else if ( y > LCD_height )
+    {
+        code |= LCD_OUT_BOTTOM;
+    }
+    return code;
+}
+
+/**
+ * Clips a line to the display with the Cohen-Sutherland algorithm. Each end
+ * that is off screen is moved along the line to the edge it crosses, until
+ * both ends are on screen or both are beyond the same edge. The clip
+ * rectangle is the display grown by one pixel on each side, so that rounding
+ * cannot reject a line whose Bresenham pixels touch the edge of the display.
+ *
+ * @return  non-zero if some of the line is on screen
+ */
+static uint8_t LCD_ClipLine( int16_t *x0, int16_t *y0, int16_t *x1,
+        int16_t *y1 )
+{
+    uint8_t code0 = LCD_OutCode( *x0, *y0 );
+    uint8_t code1 = LCD_OutCode( *x1, *y1 );
+    uint8_t code;
+    int32_t dx = (int32_t) *x1 - *x0;
+    int32_t dy = (int32_t) *y1 - *y0;
+    int32_t x;
+    int32_t y;
+
+    while ( code0 | code1 )
+    {
+        if ( code0 & code1 ) return 0;  // Entirely beyond one edge
+
+        code = code0 ? code0 : code1;
+        if ( code & LCD_OUT_TOP )
+        {
+            y = -1;
+            x = *x0 + LCD_MulDiv( dx, y - *y0, dy );
+        }
+        else if ( code & LCD_OUT_BOTTOM )
+        {
+            y = LCD_height;
+            x = *x0 + LCD_MulDiv( dx, y - *y0, dy );
+        }
+        else if ( code & LCD_OUT_LEFT )
+        {
+            x = -1;
+            y = *y0 + LCD_MulDiv( dy, x - *x0, dx );
+        }
+        else
+        {
+            x = LCD_width;
+            y = *y0 + LCD_MulDiv( dy, x - *x0, dx );
+        }
+
+        if ( code == code0 )
+        {
+            code0 = LCD_OutCode( x, y );
+            *x0 = x;
+            *y0 = y;
+        }
+        else
+        {
+            code1 = LCD_OutCode( x, y );
+            *x1 = x;
+            *y1 = y;
+        }
+    }
+    return 1;
+}
+
+/**
+ * Returns a * b / c rounded to the nearest integer. The product is kept in
+ * 64 bits since it can overflow for 16-bit coordinates far off screen.
+ */
+static int32_t LCD_MulDiv( int32_t a, int32_t b, int32_t c )
+{
+    int64_t n = (int64_t) a * b;
+
+    if ( ( n < 0 ) != ( c < 0 ) )
+    {
+        return (int32_t) ( ( n - c / 2 ) / c );
+    }
+    return (int32_t) ( ( n + c / 2 ) / c );
+}
+
+/**
+ * Draws one character at the cursor and moves it on, kerned after the
+ * glyph *prev, which is updated. A new line starts unkerned.
+ */
+static void LCD_PutChar( uint16_t c, const GFXglyph **prev )
 {
     if ( c == '\n' )
     {
         LCD_cursor_x = 0;
         LCD_cursor_y += ( LCD_textsize_y * ( LCD_font->yAdvance ) );
+        *prev = NULL;
     }
     else if ( c != '\r' )
     {
-        uint8_t first = (uint8_t) ( LCD_font->first );
-        if ( ( first <= c ) && ( c <= LCD_font->last ) )
+        const GFXglyph *glyph = LCD_GetGlyph( LCD_font, c );
+        if ( glyph != NULL )
         {
-            GFXglyph *glyph = LCD_font->glyph + ( c - first );
             uint8_t w = glyph->width;
             uint8_t h = glyph->height;
+            LCD_cursor_x += LCD_textsize_x * LCD_GetKerning( LCD_font, *prev, glyph );
             if ( ( w > 0 ) && ( h > 0 ) )
             {  // Is there an associated bitmap?
                 int16_t xo = (int8_t) ( glyph->xOffset );
@@ -707,25 +1812,94 @@ void LCD_DrawChar( uint8_t c )
             }
             LCD_cursor_x += ( LCD_textsize_x * ( glyph->xAdvance ) );
         }
+        *prev = glyph;
     }
 }
 
 /**
- *   Draws a string of text at the current cursor position. Text must be null-terminated and less than 128
- *   characters. Supports newline ('\n').
+ * Draws a character of LCD_Printf().
+ */
+static void LCD_PrintChar( uint8_t c )
+{
+    LCD_PutChar( c, &LCD_printPrev );
+}
+
+/**
+ * Widens a bounding box to include the glyph of one character drawn at the
+ * cursor (*x,*y) and moves the cursor on, as LCD_PutChar() does.
+ */
+static void LCD_CharBounds( uint16_t c, const GFXglyph **prev, int16_t *x,
+        int16_t *y, int16_t *minx, int16_t *miny, int16_t *maxx, int16_t *maxy )
+{
+    if ( c == '\n' )
+    {
+        *x = 0;
+        *y += ( LCD_textsize_y * ( LCD_font->yAdvance ) );
+        *prev = NULL;
+    }
+    else if ( c != '\r' )
+    {
+        const GFXglyph *glyph = LCD_GetGlyph( LCD_font, c );
+        if ( glyph != NULL )
+        {
+            uint8_t w = glyph->width;
+            uint8_t h = glyph->height;
+            *x += LCD_textsize_x * LCD_GetKerning( LCD_font, *prev, glyph );
+            if ( ( w > 0 ) && ( h > 0 ) )
+            {
+                int16_t xo = (int8_t) ( glyph->xOffset );
+                int16_t yo = (int8_t) ( glyph->yOffset );
+                if ( LCD_wrap
+                        && ( ( *x + LCD_textsize_x * ( xo + w ) ) > LCD_width ) )
+                {
+                    *x = 0;
+                    *y += ( LCD_textsize_y * ( LCD_font->yAdvance ) );
+                }
+                int16_t x1 = *x + xo * LCD_textsize_x;
+                int16_t y1 = *y + yo * LCD_textsize_y;
+                int16_t x2 = x1 + w * LCD_textsize_x - 1;
+                int16_t y2 = y1 + h * LCD_textsize_y - 1;
+                if ( x1 < *minx ) *minx = x1;
+                if ( y1 < *miny ) *miny = y1;
+                if ( x2 > *maxx ) *maxx = x2;
+                if ( y2 > *maxy ) *maxy = y2;
+            }
+            *x += ( LCD_textsize_x * ( glyph->xAdvance ) );
+        }
+        *prev = glyph;
+    }
+}
+
+/**
+ *   Computes the bounding box of a string, see LCD_GetTextBounds().
  *
- *   @param  text  The null-terminated text string.
+ *   @param  utf8  If set the string is UTF-8, otherwise ASCII or Latin-1
  */
-void LCD_DrawText( const uint8_t *text )
+static void LCD_TextBounds( int16_t x, int16_t y, const uint8_t *text,
+        uint8_t utf8, LCD_Rect *bounds )
 {
-    uint16_t overrun = 128;
+    int16_t minx = INT16_MAX;
+    int16_t miny = INT16_MAX;
+    int16_t maxx = INT16_MIN;
+    int16_t maxy = INT16_MIN;
+    const GFXglyph *prev = NULL;
+    uint16_t c;
+
+    while ( ( c = LCD_NextChar( &text, utf8 ) ) != 0 )
+    {
+        LCD_CharBounds( c, &prev, &x, &y, &minx, &miny, &maxx, &maxy );
+    }
 
-    while ( *text && overrun )
+    if ( maxx < minx )
     {
-        /* buffer to remove const attribute */
-        uint8_t c = (uint8_t) *text;
-        LCD_DrawChar( c );
-        text++;
-        overrun--;
+        bounds->x = x;
+        bounds->y = y;
+        bounds->w = 0;
+        bounds->h = 0;
+        return;
     }
+    bounds->x = minx;
+    bounds->y = miny;
+    bounds->w = maxx - minx + 1;
+    bounds->h = maxy - miny + 1;
 }
@@ -0,0 +1,268 @@
+/**
+ * @file    lcd_aafont.c
+ * @brief   Anti-aliased text, blended against the background through a
+ *          ramp of RGB565 colors
+ */
+/**
+ ******************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2021 John Vedder
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************
+ */
+
+#include "main.h"
+#include "lcd.h"
+#include "lcd_aafont.h"
+
+#include "Fonts/Lato12pt2b.h"
+
+/*
+ * Private Variables
+ */
+static uint16_t LCD_aaRamp[16];         // Color of each coverage level
+static uint16_t LCD_aaColor;            // Text color of the ramp
+static uint16_t LCD_aaBgcolor;          // Background color of the ramp
+static uint8_t LCD_aaBpp = 0;           // Bits per level of the ramp, 0 if none
+static uint16_t LCD_aaBuffer[LCD_AA_CHUNK];     // Pixels being decoded
+
+/*
+ * Private Function Prototypes
+ */
+static const GFXglyph* LCD_AAGlyph( const LCD_AAFont *font, uint8_t c );
+static void LCD_SendAAPixels( const LCD_AAFont *font, uint8_t c,
+        uint16_t index, uint16_t count, uint8_t *first );
+
+/*
+ *  -------------------
+ *  Public Functions
+ * -------------------
+ */
+
+/**
+ * Computes the colors of the coverage levels between a background and a
+ * text color, unless they are already those of the ramp.
+ *
+ * @param   color   16-bit 5-6-5 Color at full coverage
+ * @param   bgcolor 16-bit 5-6-5 Color at no coverage
+ * @param   bpp     Bits per level: 1, 2 or 4
+ */
+void LCD_SetAARamp( uint16_t color, uint16_t bgcolor, uint8_t bpp )
+{
+    uint8_t top = ( 1 << bpp ) - 1;
+    uint16_t r;
+    uint16_t g;
+    uint16_t b;
+    uint8_t i;
+
+    if ( color == LCD_aaColor && bgcolor == LCD_aaBgcolor && bpp == LCD_aaBpp )
+        return;
+    LCD_aaColor = color;
+    LCD_aaBgcolor = bgcolor;
+    LCD_aaBpp = bpp;
+
+    for ( i = 0; i <= top; i++ )
+    {
+        // Each channel from the background to the color, rounded
+        r = ( ( bgcolor >> 11 ) * ( top - i ) + ( color >> 11 ) * i + top / 2 ) / top;
+        g = ( ( ( bgcolor >> 5 ) & 0x3F ) * ( top - i )
+                + ( ( color >> 5 ) & 0x3F ) * i + top / 2 ) / top;
+        b = ( ( bgcolor & 0x1F ) * ( top - i ) + ( color & 0x1F ) * i + top / 2 ) / top;
+        LCD_aaRamp[i] = ( r << 11 ) | ( g << 5 ) | b;
+    }
+}
+
+/**
+ * Decodes pixels of a glyph through the ramp, see LCD_SetAARamp(), for
+ * instance to composite text in a buffer. The glyph's rows follow each
+ * other, pixel 'index' is at column index % width of row index / width.
+ *
+ * @param   font    The font
+ * @param   c       The character, which the font must have
+ * @param   index   First pixel
+ * @param   count   Pixels to decode
+ * @param   pixels  Returns the RGB565 pixels
+ */
+void LCD_GetAAPixels( const LCD_AAFont *font, uint8_t c, uint16_t index,
+        uint16_t count, uint16_t *pixels )
+{
+    const GFXglyph *glyph = &font->glyph[c - font->first];
+    uint8_t bpp = font->bpp;
+    uint8_t mask = ( 1 << bpp ) - 1;
+    uint32_t bit = (uint32_t) index * bpp;
+    const uint8_t *p = font->bitmap + glyph->bitmapOffset + ( bit >> 3 );
+    int8_t shift = 8 - bpp - ( bit & 7 );
+    uint8_t bits = *p++;
+
+    while ( count-- > 0 )
+    {
+        *pixels++ = LCD_aaRamp[( bits >> shift ) & mask];
+        shift -= bpp;
+        if ( shift < 0 && count > 0 )
+        {
+            shift += 8;
+            bits = *p++;
+        }
+    }
+}
+
+/**
+ * Draws a character of an anti-aliased font, blended against
+ * LCD_textbgcolor. Its bounding box is streamed through one address
+ * window, clipped to the display.
+ *
+ * @param   x       Cursor x coordinate
+ * @param   y       Cursor y coordinate (baseline)
+ * @param   font    The font
+ * @param   c       The character, nothing is drawn if the font lacks it
+ * @param   color   16-bit 5-6-5 Color of the text
+ */
+void LCD_DrawAAChar( int16_t x, int16_t y, const LCD_AAFont *font, uint8_t c,
+        uint16_t color )
+{
+    const GFXglyph *glyph = LCD_AAGlyph( font, c );
+    int16_t gx;
+    int16_t gy;
+    int16_t x1;
+    int16_t y1;
+    int16_t x2;
+    int16_t y2;
+    int16_t row;
+    uint8_t first = 1;
+
+    if ( glyph == NULL || glyph->width == 0 || glyph->height == 0 ) return;
+
+    gx = x + glyph->xOffset;
+    gy = y + glyph->yOffset;
+    x1 = ( gx < 0 ) ? 0 : gx;
+    y1 = ( gy < 0 ) ? 0 : gy;
+    x2 = ( gx + glyph->width > LCD_width ) ? LCD_width : gx + glyph->width;
+    y2 = ( gy + glyph->height > LCD_height ) ? LCD_height : gy + glyph->height;
+    if ( x1 >= x2 || y1 >= y2 ) return;
+
+    LCD_SetAARamp( color, LCD_textbgcolor, font->bpp );
+    LCD_StartWrite( );
+    LCD_SetAddrWindow( x1, y1, x2 - x1, y2 - y1 );
+    if ( x2 - x1 == glyph->width )
+    {
+        // Whole rows follow each other in the bitmap
+        LCD_SendAAPixels( font, c, ( y1 - gy ) * glyph->width,
+                ( y2 - y1 ) * glyph->width, &first );
+    }
+    else
+    {
+        for ( row = y1 - gy; row < y2 - gy; row++ )
+        {
+            LCD_SendAAPixels( font, c, row * glyph->width + ( x1 - gx ),
+                    x2 - x1, &first );
+        }
+    }
+    LCD_EndWrite( );
+}
+
+/**
+ * Draws a string in an anti-aliased font, see LCD_DrawAAChar(). Supports
+ * newline ('\n').
+ *
+ * @param   x       Cursor x coordinate to start from
+ * @param   y       Cursor y coordinate (baseline) to start from
+ * @param   font    The font
+ * @param   text    Null terminated string
+ * @param   color   16-bit 5-6-5 Color of the text
+ * @return  The cursor x coordinate after the text
+ */
+int16_t LCD_DrawAAText( int16_t x, int16_t y, const LCD_AAFont *font,
+        const uint8_t *text, uint16_t color )
+{
+    const GFXglyph *glyph;
+    int16_t left = x;
+
+    LCD_StartWrite( );
+    for ( ; *text; text++ )
+    {
+        if ( *text == '\n' )
+        {
+            x = left;
+            y += font->yAdvance;
+            continue;
+        }
+        glyph = LCD_AAGlyph( font, *text );
+        if ( glyph == NULL ) continue;
+        LCD_DrawAAChar( x, y, font, *text, color );
+        x += glyph->xAdvance;
+    }
+    LCD_EndWrite( );
+    return x;
+}
+
+/**
+ * Returns the advance width of a line of text in an anti-aliased font.
+ */
+uint16_t LCD_GetAATextWidth( const LCD_AAFont *font, const uint8_t *text )
+{
+    const GFXglyph *glyph;
+    uint16_t width = 0;
+
+    for ( ; *text && *text != '\n'; text++ )
+    {
+        glyph = LCD_AAGlyph( font, *text );
+        if ( glyph != NULL ) width += glyph->xAdvance;
+    }
+    return width;
+}
+
+/**
+ * -------------------
+ *  Private Functions
+ * -------------------
+ */
+
+/**
+ * Returns the glyph of a character, NULL if the font lacks it.
+ */
+static const GFXglyph* LCD_AAGlyph( const LCD_AAFont *font, uint8_t c )
+{
+    if ( c < font->first || c > font->last ) return NULL;
+    return &font->glyph[c - font->first];
+}
+
+/**
+ * Decodes pixels of a glyph in chunks and streams them on in the address
+ * window.
+ *
+ * @param   first   Set if the window has not been written to yet, cleared
+ */
+static void LCD_SendAAPixels( const LCD_AAFont *font, uint8_t c,
+        uint16_t index, uint16_t count, uint8_t *first )
+{
+    uint16_t n;
+
+    while ( count > 0 )
+    {
+        n = ( count > LCD_AA_CHUNK ) ? LCD_AA_CHUNK : count;
+        LCD_GetAAPixels( font, c, index, n, LCD_aaBuffer );
+        if ( *first ) LCD_WritePixels( LCD_aaBuffer, n );
+        else LCD_ContinuePixels( LCD_aaBuffer, n );
+        *first = 0;
+        index += n;
+        count -= n;
+    }
+}
@@ -0,0 +1,484 @@
+/**
+ * @file    lcd_bitmap.c
+ * @brief   Bitmap blits for the ILI9341 LCD driver: RGB565, monochrome
+ *          and 2, 4 or 8 bits per pixel through a palette
+ */
+/**
+ ******************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2021 John Vedder
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************
+ */
+
+#include "main.h"
+#include "lcd.h"
+#include "lcd_bitmap.h"
+
+/**
+ * Read position in an indexed bitmap, see LCD_ExpandPixels()
+ */
+typedef struct
+{
+    const uint8_t *row;         // First byte of the visible part of the row
+    const uint8_t *src;         // Byte of the next pixel
+    const uint16_t *palette;    // Colors of the indexes
+    uint16_t stride;            // Bytes per row
+    uint16_t w;                 // Visible pixels per row
+    uint16_t col;               // Visible pixels of the row read so far
+    int8_t first;               // Shift of the first visible pixel of a row
+    int8_t shift;               // Shift of the next pixel
+    uint8_t bpp;                // Bits per pixel
+    uint8_t mask;               // (1 << bpp) - 1
+} LCD_BitmapSource;
+
+/**
+ * Position in a compressed image being drawn, see LCD_ImageOut()
+ */
+typedef struct
+{
+    uint32_t pos;               // Pixels decoded so far
+    uint32_t start;             // First visible pixel, when no columns are clipped
+    uint32_t end;               // One past the last one
+    uint16_t w;                 // Width of the image
+    uint16_t col;               // Column of the next pixel
+    uint16_t row;               // Row of the next pixel
+    uint16_t x1;                // First visible column
+    uint16_t x2;                // One past the last
+    uint16_t y1;                // First visible row
+    uint16_t y2;                // One past the last
+    uint8_t rows;               // Non-zero if no columns are clipped
+    uint8_t first;              // Non-zero until the memory write is started
+} LCD_ImageSink;
+
+/*
+ * Private Variables
+ */
+static uint16_t LCD_bitmapBuffers[2][LCD_BITMAP_CHUNK];  // Expanded pixels
+
+/*
+ * Private Function Prototypes
+ */
+static uint8_t LCD_ClipBitmap( int16_t x, int16_t y, int16_t w, int16_t h,
+        LCD_Rect *visible );
+static void LCD_ExpandPixels( LCD_BitmapSource *source, uint16_t *pixels,
+        uint16_t len );
+static void LCD_ImageOut( LCD_ImageSink *sink, uint16_t color,
+        const uint16_t *pixels, uint32_t len );
+static void LCD_ImageSend( LCD_ImageSink *sink, uint16_t color,
+        const uint16_t *pixels, uint32_t len );
+
+/*
+ *  -------------------
+ *  Public Functions
+ * -------------------
+ */
+
+/**
+ * Draw a bitmap of RGB565 pixels, for instance from flash. The pixels are
+ * streamed straight from the bitmap: all of it at once when no columns are
+ * clipped, else row by row. Like every window the bitmap follows the
+ * rotation set by LCD_SetRotation().
+ *
+ * @param   x       Top left corner x coordinate
+ * @param   y       Top left corner y coordinate
+ * @param   bitmap  w x h pixels in rows, in the byte order of LCD_WritePixels()
+ * @param   w       Width in pixels
+ * @param   h       Height in pixels
+ */
+void LCD_DrawRGBBitmap( int16_t x, int16_t y, const uint16_t *bitmap,
+        int16_t w, int16_t h )
+{
+    LCD_Rect visible;
+    const uint16_t *row;
+    int16_t i;
+
+    if ( !LCD_ClipBitmap( x, y, w, h, &visible ) ) return;
+    row = bitmap + (int32_t) ( visible.y - y ) * w + ( visible.x - x );
+
+    LCD_StartWrite( );
+    LCD_SetAddrWindow( visible.x, visible.y, visible.w, visible.h );
+    if ( visible.w == w )
+    {
+        LCD_WritePixels( row, (uint32_t) w * visible.h );
+    }
+    else
+    {
+        LCD_WritePixels( row, visible.w );
+        for ( i = 1; i < visible.h; i++ )
+        {
+            row += w;
+            LCD_ContinuePixels( row, visible.w );
+        }
+    }
+    LCD_EndWrite( );
+}
+
+/**
+ * Draw a monochrome bitmap, set bits in 'color' and clear ones in 'bg'.
+ * Rows start on a byte boundary, MSB first, like the bitmaps of the
+ * Adafruit drawBitmap().
+ *
+ * @param   x       Top left corner x coordinate
+ * @param   y       Top left corner y coordinate
+ * @param   bitmap  h rows of (w + 7) / 8 bytes
+ * @param   w       Width in pixels
+ * @param   h       Height in pixels
+ * @param   color   16-bit 5-6-5 Color of the set bits
+ * @param   bg      16-bit 5-6-5 Color of the clear bits
+ */
+void LCD_DrawBitmap( int16_t x, int16_t y, const uint8_t *bitmap, int16_t w,
+        int16_t h, uint16_t color, uint16_t bg )
+{
+    uint16_t palette[2];
+
+    palette[0] = bg;
+    palette[1] = color;
+    LCD_DrawIndexedBitmap( x, y, bitmap, w, h, 1, palette );
+}
+
+/**
+ * Draw a bitmap of palette indexes of 1, 2, 4 or 8 bits. Rows start on a
+ * byte boundary and the leftmost pixel of a byte is in its most significant
+ * bits. The indexes are expanded through the palette a chunk at a time
+ * while the previous chunk is sent, all through one address window.
+ *
+ * @param   x       Top left corner x coordinate
+ * @param   y       Top left corner y coordinate
+ * @param   bitmap  h rows of (w * bpp + 7) / 8 bytes
+ * @param   w       Width in pixels
+ * @param   h       Height in pixels
+ * @param   bpp     Bits per pixel: 1, 2, 4 or 8
+ * @param   palette 1 << bpp 16-bit 5-6-5 colors
+ */
+void LCD_DrawIndexedBitmap( int16_t x, int16_t y, const uint8_t *bitmap,
+        int16_t w, int16_t h, uint8_t bpp, const uint16_t *palette )
+{
+    LCD_BitmapSource source;
+    LCD_Rect visible;
+    uint32_t left;
+    uint32_t bit;
+    uint16_t *pixels;
+    uint16_t len;
+    uint8_t first = 1;
+    uint8_t b = 0;
+
+    if ( bpp != 1 && bpp != 2 && bpp != 4 && bpp != 8 ) return;
+    if ( !LCD_ClipBitmap( x, y, w, h, &visible ) ) return;
+
+    bit = (uint32_t) ( visible.x - x ) * bpp;
+    source.stride = ( (uint32_t) w * bpp + 7 ) / 8;
+    source.row = bitmap + (uint32_t) ( visible.y - y ) * source.stride
+            + ( bit >> 3 );
+    source.src = source.row;
+    source.palette = palette;
+    source.w = visible.w;
+    source.col = 0;
+    source.first = 8 - bpp - ( bit & 7 );
+    source.shift = source.first;
+    source.bpp = bpp;
+    source.mask = ( 1 << bpp ) - 1;
+
+    LCD_StartWrite( );
+    LCD_SetAddrWindow( visible.x, visible.y, visible.w, visible.h );
+    for ( left = (uint32_t) visible.w * visible.h; left > 0; left -= len )
+    {
+        len = ( left > LCD_BITMAP_CHUNK ) ? LCD_BITMAP_CHUNK : left;
+        pixels = LCD_bitmapBuffers[b];
+        b ^= 1;
+
+        // The DMA may still be sending the other buffer
+        LCD_ExpandPixels( &source, pixels, len );
+        if ( LCD_useDMA && ( len >= LCD_DMA_MIN_PIXELS ) )
+        {
+            if ( first ) LCD_WritePixelsDMA( pixels, len, NULL );
+            else LCD_ContinuePixelsDMA( pixels, len, NULL );
+        }
+        else
+        {
+            if ( first ) LCD_WritePixels( pixels, len );
+            else LCD_ContinuePixels( pixels, len );
+        }
+        first = 0;
+    }
+    LCD_WaitDMA( );
+    LCD_EndWrite( );
+}
+
+/**
+ * Draw a compressed image, see lcd_bitmap.h, decoding it straight into one
+ * address window. Literal pixels are expanded a chunk at a time while the
+ * DMA sends the previous chunk, runs are streamed as one color. Only the
+ * rows down to the last visible one are decoded.
+ *
+ * @param   x       Top left corner x coordinate
+ * @param   y       Top left corner y coordinate
+ * @param   image   The image
+ */
+void LCD_DrawImage( int16_t x, int16_t y, const LCD_Image *image )
+{
+    const uint8_t *data = image->data;
+    const uint16_t *palette = image->palette;
+    LCD_ImageSink sink;
+    LCD_Rect visible;
+    uint32_t left;
+    uint32_t n;
+    uint16_t *pixels;
+    uint16_t len;
+    uint16_t i;
+    uint8_t j;
+    int8_t shift;
+    uint8_t bpp = image->bpp;
+    uint8_t mask = ( 1 << bpp ) - 1;
+    uint8_t b = 0;
+    uint8_t c;
+
+    if ( !LCD_ClipBitmap( x, y, image->width, image->height, &visible ) )
+        return;
+
+    sink.pos = 0;
+    sink.w = image->width;
+    sink.col = 0;
+    sink.row = 0;
+    sink.x1 = visible.x - x;
+    sink.x2 = sink.x1 + visible.w;
+    sink.y1 = visible.y - y;
+    sink.y2 = sink.y1 + visible.h;
+    sink.start = (uint32_t) sink.y1 * sink.w;
+    sink.end = (uint32_t) sink.y2 * sink.w;
+    sink.rows = ( visible.w == image->width );
+    sink.first = 1;
+
+    LCD_StartWrite( );
+    LCD_SetAddrWindow( visible.x, visible.y, visible.w, visible.h );
+    for ( left = sink.end; left > 0; left -= n )
+    {
+        c = *data++;
+        if ( c & LCD_IMAGE_RUN )
+        {
+            n = ( c & 0x3F );
+            if ( c & LCD_IMAGE_LONG_RUN ) n = ( n << 8 ) | *data++;
+            n++;
+            if ( n > left ) n = left;
+            LCD_ImageOut( &sink, palette[*data++], NULL, n );
+        }
+        else
+        {
+            n = c + 1;
+            if ( n > left ) n = left;
+            shift = 8 - bpp;
+            for ( i = 0; i < n; i += len )
+            {
+                len = ( n - i > LCD_BITMAP_CHUNK ) ? LCD_BITMAP_CHUNK : n - i;
+                pixels = LCD_bitmapBuffers[b];
+                b ^= 1;
+
+                // The DMA may still be sending the other buffer
+                for ( j = 0; j < len; j++ )
+                {
+                    pixels[j] = palette[( *data >> shift ) & mask];
+                    shift -= bpp;
+                    if ( shift < 0 )
+                    {
+                        shift += 8;
+                        data++;
+                    }
+                }
+                LCD_ImageOut( &sink, 0, pixels, len );
+            }
+            if ( shift != 8 - bpp ) data++;     // Padding
+        }
+    }
+    LCD_WaitDMA( );
+    LCD_EndWrite( );
+}
+
+/**
+ * -------------------
+ *  Private Functions
+ * -------------------
+ */
+
+/**
+ * Clips a bitmap to the display.
+ *
+ * @param   visible Returns the part of the bitmap on the display
+ * @return  Non-zero if any of it is
+ */
+static uint8_t LCD_ClipBitmap( int16_t x, int16_t y, int16_t w, int16_t h,
+        LCD_Rect *visible )
+{
+    int32_t x2 = (int32_t) x + w;   // exclusive
+    int32_t y2 = (int32_t) y + h;   // exclusive
+
+    if ( x2 > LCD_width ) x2 = LCD_width;
+    if ( y2 > LCD_height ) y2 = LCD_height;
+    if ( x < 0 ) x = 0;
+    if ( y < 0 ) y = 0;
+    if ( x >= x2 || y >= y2 ) return 0;
+
+    visible->x = x;
+    visible->y = y;
+    visible->w = x2 - x;
+    visible->h = y2 - y;
+    return 1;
+}
+
+/**
+ * Expands the next 'len' visible pixels of an indexed bitmap through its
+ * palette, moving on to the next row at the right edge of the visible part.
+ */
+static void LCD_ExpandPixels( LCD_BitmapSource *source, uint16_t *pixels,
+        uint16_t len )
+{
+    const uint8_t *src = source->src;
+    const uint16_t *palette = source->palette;
+    int8_t shift = source->shift;
+    uint8_t bpp = source->bpp;
+    uint8_t mask = source->mask;
+    uint16_t n;
+
+    while ( len > 0 )
+    {
+        if ( source->col == source->w )
+        {
+            source->row += source->stride;
+            source->col = 0;
+            src = source->row;
+            shift = source->first;
+        }
+
+        n = source->w - source->col;
+        if ( n > len ) n = len;
+        source->col += n;
+        len -= n;
+
+        if ( bpp == 8 )
+        {
+            while ( n-- > 0 )
+            {
+                *pixels++ = palette[*src++];
+            }
+        }
+        else
+        {
+            while ( n-- > 0 )
+            {
+                *pixels++ = palette[( *src >> shift ) & mask];
+                shift -= bpp;
+                if ( shift < 0 )
+                {
+                    shift += 8;
+                    src++;
+                }
+            }
+        }
+    }
+
+    source->src = src;
+    source->shift = shift;
+}
+
+/**
+ * Sends the visible part of a run of decoded pixels. With no columns
+ * clipped the visible pixels are one range of the stream, so a run that
+ * covers several rows is sent at once. Otherwise the run is split at the
+ * end of each row.
+ *
+ * @param   sink    Position in the image
+ * @param   color   Color of a run of one color
+ * @param   pixels  The pixels, NULL for a run of 'color'
+ * @param   len     Number of pixels
+ */
+static void LCD_ImageOut( LCD_ImageSink *sink, uint16_t color,
+        const uint16_t *pixels, uint32_t len )
+{
+    uint32_t start;
+    uint32_t end;
+    uint16_t n;
+
+    if ( sink->rows )
+    {
+        start = ( sink->pos > sink->start ) ? sink->pos : sink->start;
+        end = ( sink->pos + len < sink->end ) ? sink->pos + len : sink->end;
+        if ( start < end )
+        {
+            LCD_ImageSend( sink, color,
+                    pixels ? pixels + ( start - sink->pos ) : NULL,
+                    end - start );
+        }
+        sink->pos += len;
+        return;
+    }
+
+    while ( len > 0 )
+    {
+        n = sink->w - sink->col;
+        if ( n > len ) n = len;
+
+        if ( ( sink->row >= sink->y1 ) && ( sink->row < sink->y2 ) )
+        {
+            start = ( sink->col > sink->x1 ) ? sink->col : sink->x1;
+            end = ( sink->col + n < sink->x2 ) ? sink->col + n : sink->x2;
+            if ( start < end )
+            {
+                LCD_ImageSend( sink, color,
+                        pixels ? pixels + ( start - sink->col ) : NULL,
+                        end - start );
+            }
+        }
+
+        sink->col += n;
+        if ( sink->col == sink->w )
+        {
+            sink->col = 0;
+            sink->row++;
+        }
+        if ( pixels ) pixels += n;
+        len -= n;
+    }
+}
+
+/**
+ * Sends visible pixels to the window, starting the memory write with the
+ * first ones. Buffers of pixels long enough go by DMA without waiting, the
+ * next chunk is expanded in the other buffer meanwhile.
+ */
+static void LCD_ImageSend( LCD_ImageSink *sink, uint16_t color,
+        const uint16_t *pixels, uint32_t len )
+{
+    if ( pixels == NULL )
+    {
+        if ( sink->first ) LCD_WriteColor( color, len );
+        else LCD_ContinueColor( color, len );
+    }
+    else if ( LCD_useDMA && ( len >= LCD_DMA_MIN_PIXELS ) )
+    {
+        if ( sink->first ) LCD_WritePixelsDMA( pixels, len, NULL );
+        else LCD_ContinuePixelsDMA( pixels, len, NULL );
+    }
+    else
+    {
+        if ( sink->first ) LCD_WritePixels( pixels, len );
+        else LCD_ContinuePixels( pixels, len );
+    }
+    sink->first = 0;
+}
@@ -0,0 +1,724 @@
+/**
+ * @file    lcd_shapes.c
+ * @brief   Circles, ellipses, rounded rectangles, triangles and polygons for
+ *          the ILI9341 LCD driver, rasterized into horizontal spans
+ */
+/**
+ ******************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2021 John Vedder
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************
+ * Portions adapted from Adafruit Arduino Libraries. See LICENSE file.
+ ******************************************************************************
+ */
+
+#include "main.h"
+#include "lcd.h"
+#include "lcd_shapes.h"
+
+#define LCD_SHAPE_LANES     4       // Spans of a row that are merged with the next row
+
+#define SWAP_INT16(a, b) {int16_t t = a; a=b; b=t;}
+#define SWAP_INT32(a, b) {int32_t t = a; a=b; b=t;}
+
+/**
+ * State of the scan of a quarter ellipse, see LCD_EllipseStart()
+ */
+typedef struct
+{
+    int64_t f;      // 4x^2(2ry+1)^2 + 4k^2(2rx+1)^2
+    int64_t t;      // (2rx+1)^2 (2ry+1)^2, f <= t inside
+    int64_t dx;     // Decrease of f when x is decremented
+    int64_t dk;     // Increase of f when k is incremented
+    int64_t a8;     // Change of dx per step
+    int64_t b8;     // Change of dk per step
+    int16_t x;      // Half width of row k
+} LCD_Ellipse;
+
+/*
+ * Private Variables
+ */
+static LCD_Rect LCD_shapeLanes[LCD_SHAPE_LANES];    // Spans waiting to be merged
+static const LCD_Rect *LCD_shapeClip;               // Clip of the shape being drawn
+static LCD_SpanFunc LCD_shapeSpan;                  // Receives its spans
+static uint16_t LCD_shapeColor;                     // Its color
+
+/*
+ * Private Function Prototypes
+ */
+static void LCD_ShapeBegin( uint16_t color, const LCD_Rect *clip,
+        LCD_SpanFunc span );
+static void LCD_ShapeEnd( void );
+static void LCD_ShapeSpan( uint8_t lane, int32_t x, int32_t y, int32_t w,
+        int32_t h );
+static void LCD_ShapeFlush( uint8_t lane );
+static void LCD_EllipseStart( LCD_Ellipse *e, int16_t rx, int16_t ry );
+static int16_t LCD_EllipseStep( LCD_Ellipse *e );
+static void LCD_OutlineRow( uint8_t lane, int16_t xl, int16_t xr, int16_t y,
+        int16_t dx, int16_t outer );
+static int16_t LCD_CeilDiv( int64_t num, int32_t den );
+static void LCD_ScreenClip( LCD_Rect *clip );
+
+/*
+ *  -------------------
+ *  Public Functions
+ * -------------------
+ */
+
+/**
+ * Rasterizes a rectangle with elliptic corners into spans. Circles and
+ * ellipses are the case where the corners meet. Row k away from the
+ * straight middle part of a corner spans the pixels whose centers are
+ * inside the quarter ellipse grown by half a pixel,
+ * (x/(rx+1/2))^2 + (k/(ry+1/2))^2 <= 1, which for a circle is the
+ * midpoint criterion x^2 + k^2 <= r^2 + r. The outline is the pixels of
+ * the filled shape that have a 4-neighbor outside of it, so it is
+ * 8-connected and one pixel thick.
+ *
+ * @param   x       Top left corner x coordinate
+ * @param   y       Top left corner y coordinate
+ * @param   w       Width in pixels
+ * @param   h       Height in pixels
+ * @param   rx      Horizontal radius of the corners, limited to (w-1)/2
+ * @param   ry      Vertical radius of the corners, limited to (h-1)/2
+ * @param   fill    If set the shape is filled, else its outline is drawn
+ * @param   color   16-bit 5-6-5 Color to draw with
+ * @param   clip    Spans outside of this rectangle are dropped
+ * @param   span    Receives the clipped spans
+ */
+void LCD_RasterRoundRect( int16_t x, int16_t y, int16_t w, int16_t h,
+        int16_t rx, int16_t ry, uint8_t fill, uint16_t color,
+        const LCD_Rect *clip, LCD_SpanFunc span )
+{
+    LCD_Ellipse e;
+    int16_t xl;     // Center column of the left corners
+    int16_t xr;     // Center column of the right corners
+    int16_t yt;     // Center row of the top corners
+    int16_t yb;     // Center row of the bottom corners
+    int16_t dx;     // Half width of the current corner row
+    int16_t outer;  // Half width of the row outside of it, -1 if none
+    int16_t k;
+
+    if ( w <= 0 || h <= 0 ) return;
+    if ( ( x >= clip->x + clip->w ) || ( y >= clip->y + clip->h )
+            || ( (int32_t) x + w <= clip->x ) || ( (int32_t) y + h <= clip->y ) )
+        return;
+
+    if ( rx > ( w - 1 ) / 2 ) rx = ( w - 1 ) / 2;
+    if ( ry > ( h - 1 ) / 2 ) ry = ( h - 1 ) / 2;
+    if ( rx < 0 ) rx = 0;
+    if ( ry < 0 ) ry = 0;
+    xl = x + rx;
+    xr = x + w - 1 - rx;
+    yt = y + ry;
+    yb = y + h - 1 - ry;
+
+    LCD_EllipseStart( &e, rx, ry );
+    LCD_ShapeBegin( color, clip, span );
+    outer = ( ry > 0 ) ? LCD_EllipseStep( &e ) : -1;
+
+    if ( fill )
+    {
+        LCD_ShapeSpan( 0, x, yt, w, yb - yt + 1 );
+        for ( k = 1; k <= ry; k++ )
+        {
+            dx = outer;
+            LCD_ShapeSpan( 0, xl - dx, yt - k, xr - xl + 2 * dx + 1, 1 );
+            LCD_ShapeSpan( 1, xl - dx, yb + k, xr - xl + 2 * dx + 1, 1 );
+            if ( k < ry ) outer = LCD_EllipseStep( &e );
+        }
+    }
+    else
+    {
+        // The sides of the straight middle part, then its first and last rows
+        if ( yb - yt > 1 )
+        {
+            LCD_ShapeSpan( 0, x, yt + 1, 1, yb - yt - 1 );
+            if ( w > 1 ) LCD_ShapeSpan( 1, x + w - 1, yt + 1, 1, yb - yt - 1 );
+        }
+        LCD_OutlineRow( 0, xl, xr, yt, rx, outer );
+        if ( yb != yt ) LCD_OutlineRow( 2, xl, xr, yb, rx, outer );
+
+        for ( k = 1; k <= ry; k++ )
+        {
+            dx = outer;
+            outer = ( k < ry ) ? LCD_EllipseStep( &e ) : -1;
+            LCD_OutlineRow( 0, xl, xr, yt - k, dx, outer );
+            LCD_OutlineRow( 2, xl, xr, yb + k, dx, outer );
+        }
+    }
+
+    LCD_ShapeEnd( );
+}
+
+/**
+ * Rasterizes a filled triangle into spans, one per row. Each row spans
+ * the edges of the triangle, so the outline drawn by LCD_DrawTriangle()
+ * is part of the fill.
+ *
+ * @param   x0, y0  First vertex
+ * @param   x1, y1  Second vertex
+ * @param   x2, y2  Third vertex
+ * @param   color   16-bit 5-6-5 Color to draw with
+ * @param   clip    Spans outside of this rectangle are dropped
+ * @param   span    Receives the clipped spans
+ */
+void LCD_RasterTriangle( int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+        int16_t x2, int16_t y2, uint16_t color, const LCD_Rect *clip,
+        LCD_SpanFunc span )
+{
+    int32_t dx01, dy01, dx02, dy02, dx12, dy12;
+    int32_t sa;
+    int32_t sb;
+    int32_t a;
+    int32_t b;
+    int32_t y;
+    int32_t last;
+    int32_t bottom = (int32_t) clip->y + clip->h - 1;
+
+    // Sort coordinates by Y order (y2 >= y1 >= y0)
+    if ( y0 > y1 )
+    {
+        SWAP_INT16( y0, y1 );
+        SWAP_INT16( x0, x1 );
+    }
+    if ( y1 > y2 )
+    {
+        SWAP_INT16( y2, y1 );
+        SWAP_INT16( x2, x1 );
+    }
+    if ( y0 > y1 )
+    {
+        SWAP_INT16( y0, y1 );
+        SWAP_INT16( x0, x1 );
+    }
+    if ( y2 < clip->y || y0 > bottom ) return;
+
+    LCD_ShapeBegin( color, clip, span );
+
+    if ( y0 == y2 )
+    {
+        // All on the same row
+        a = b = x0;
+        if ( x1 < a ) a = x1;
+        else if ( x1 > b ) b = x1;
+        if ( x2 < a ) a = x2;
+        else if ( x2 > b ) b = x2;
+        LCD_ShapeSpan( 0, a, y0, b - a + 1, 1 );
+        LCD_ShapeEnd( );
+        return;
+    }
+
+    dx01 = x1 - x0;
+    dy01 = y1 - y0;
+    dx02 = x2 - x0;
+    dy02 = y2 - y0;
+    dx12 = x2 - x1;
+    dy12 = y2 - y1;
+
+    // The upper part, edges 0-1 and 0-2. Row y1 belongs to it if the lower
+    // part is flat, else to the lower part. Rows above the clip are skipped.
+    last = ( y1 == y2 ) ? y1 : y1 - 1;
+    if ( last > bottom ) last = bottom;
+    y = ( y0 < clip->y ) ? clip->y : y0;
+    sa = dx01 * ( y - y0 );
+    sb = dx02 * ( y - y0 );
+    for ( ; y <= last; y++ )
+    {
+        a = x0 + sa / dy01;
+        b = x0 + sb / dy02;
+        sa += dx01;
+        sb += dx02;
+        if ( a > b ) SWAP_INT32( a, b );
+        LCD_ShapeSpan( 0, a, y, b - a + 1, 1 );
+    }
+
+    // The lower part, edges 1-2 and 0-2
+    last = ( y2 > bottom ) ? bottom : y2;
+    if ( y < clip->y ) y = clip->y;
+    sa = dx12 * ( y - y1 );
+    sb = dx02 * ( y - y0 );
+    for ( ; y <= last; y++ )
+    {
+        a = x1 + sa / dy12;
+        b = x0 + sb / dy02;
+        sa += dx12;
+        sb += dx02;
+        if ( a > b ) SWAP_INT32( a, b );
+        LCD_ShapeSpan( 0, a, y, b - a + 1, 1 );
+    }
+
+    LCD_ShapeEnd( );
+}
+
+/**
+ * Rasterizes a filled polygon into spans with the even-odd rule. A pixel
+ * is filled if its center is inside the polygon, where vertices are pixel
+ * centers and pixels on the left and top edges are inside while those on
+ * the right and bottom edges are not. So polygons sharing an edge do not
+ * overlap, and the polygon (0,0) (10,0) (10,10) (0,10) fills the same
+ * 10x10 pixels as LCD_DrawFillRect( 0, 0, 10, 10 ). Rows crossed by more
+ * than LCD_POLY_MAX_CROSSINGS edges lose the spans right of the last one.
+ *
+ * @param   points  The vertices, the last one is joined to the first
+ * @param   count   Number of vertices
+ * @param   color   16-bit 5-6-5 Color to draw with
+ * @param   clip    Spans outside of this rectangle are dropped
+ * @param   span    Receives the clipped spans
+ */
+void LCD_RasterPolygon( const LCD_Point *points, uint8_t count,
+        uint16_t color, const LCD_Rect *clip, LCD_SpanFunc span )
+{
+    int16_t crossings[LCD_POLY_MAX_CROSSINGS];
+    const LCD_Point *p;
+    const LCD_Point *q;
+    int16_t top = INT16_MAX;
+    int16_t bottom = INT16_MIN;
+    int16_t cx;
+    int16_t y;
+    uint8_t n;
+    uint8_t i;
+    uint8_t j;
+
+    if ( count < 3 ) return;
+    for ( i = 0; i < count; i++ )
+    {
+        if ( points[i].y < top ) top = points[i].y;
+        if ( points[i].y > bottom ) bottom = points[i].y;
+    }
+    if ( top < clip->y ) top = clip->y;
+    if ( bottom > clip->y + clip->h ) bottom = clip->y + clip->h;
+
+    LCD_ShapeBegin( color, clip, span );
+    for ( y = top; y < bottom; y++ )
+    {
+        // Crossings of the edges with the row, sorted by insertion
+        n = 0;
+        q = &points[count - 1];
+        for ( i = 0; i < count; q = p, i++ )
+        {
+            p = &points[i];
+            if ( ( p->y <= y ) == ( q->y <= y ) ) continue;
+            if ( n == LCD_POLY_MAX_CROSSINGS ) break;
+
+            if ( p->y < q->y )
+                cx = LCD_CeilDiv( (int64_t) ( y - p->y ) * ( q->x - p->x ),
+                        q->y - p->y ) + p->x;
+            else
+                cx = LCD_CeilDiv( (int64_t) ( y - q->y ) * ( p->x - q->x ),
+                        p->y - q->y ) + q->x;
+
+            for ( j = n++; j > 0 && crossings[j - 1] > cx; j-- )
+            {
+                crossings[j] = crossings[j - 1];
+            }
+            crossings[j] = cx;
+        }
+
+        for ( i = 0; i + 1 < n; i += 2 )
+        {
+            if ( crossings[i + 1] > crossings[i] )
+            {
+                LCD_ShapeSpan(
+                        ( i / 2 < LCD_SHAPE_LANES ) ? i / 2 : LCD_SHAPE_LANES - 1,
+                        crossings[i], y, crossings[i + 1] - crossings[i], 1 );
+            }
+        }
+    }
+    LCD_ShapeEnd( );
+}
+
+/**
+ * Draw a circle outline
+ *
+ * @param   x0      Center x coordinate
+ * @param   y0      Center y coordinate
+ * @param   r       Radius in pixels, 0 to LCD_SHAPE_MAX_RADIUS
+ * @param   color   16-bit 5-6-5 Color to draw with
+ */
+void LCD_DrawCircle( int16_t x0, int16_t y0, int16_t r, uint16_t color )
+{
+    LCD_DrawEllipse( x0, y0, r, r, color );
+}
+
+/**
+ * Draw a filled circle
+ *
+ * @param   x0      Center x coordinate
+ * @param   y0      Center y coordinate
+ * @param   r       Radius in pixels, 0 to LCD_SHAPE_MAX_RADIUS
+ * @param   color   16-bit 5-6-5 Color to fill with
+ */
+void LCD_FillCircle( int16_t x0, int16_t y0, int16_t r, uint16_t color )
+{
+    LCD_FillEllipse( x0, y0, r, r, color );
+}
+
+/**
+ * Draw an ellipse outline
+ *
+ * @param   x0      Center x coordinate
+ * @param   y0      Center y coordinate
+ * @param   rx      Horizontal radius in pixels, 0 to LCD_SHAPE_MAX_RADIUS
+ * @param   ry      Vertical radius in pixels, 0 to LCD_SHAPE_MAX_RADIUS
+ * @param   color   16-bit 5-6-5 Color to draw with
+ */
+void LCD_DrawEllipse( int16_t x0, int16_t y0, int16_t rx, int16_t ry,
+        uint16_t color )
+{
+    LCD_Rect clip;
+
+    if ( rx < 0 || ry < 0 || rx > LCD_SHAPE_MAX_RADIUS
+            || ry > LCD_SHAPE_MAX_RADIUS ) return;
+
+    LCD_ScreenClip( &clip );
+    LCD_StartWrite( );
+    LCD_RasterRoundRect( x0 - rx, y0 - ry, 2 * rx + 1, 2 * ry + 1, rx, ry, 0,
+            color, &clip, LCD_WriteFillRectPreclipped );
+    LCD_EndWrite( );
+}
+
+/**
+ * Draw a filled ellipse
+ *
+ * @param   x0      Center x coordinate
+ * @param   y0      Center y coordinate
+ * @param   rx      Horizontal radius in pixels, 0 to LCD_SHAPE_MAX_RADIUS
+ * @param   ry      Vertical radius in pixels, 0 to LCD_SHAPE_MAX_RADIUS
+ * @param   color   16-bit 5-6-5 Color to fill with
+ */
+void LCD_FillEllipse( int16_t x0, int16_t y0, int16_t rx, int16_t ry,
+        uint16_t color )
+{
+    LCD_Rect clip;
+
+    if ( rx < 0 || ry < 0 || rx > LCD_SHAPE_MAX_RADIUS
+            || ry > LCD_SHAPE_MAX_RADIUS ) return;
+
+    LCD_ScreenClip( &clip );
+    LCD_StartWrite( );
+    LCD_RasterRoundRect( x0 - rx, y0 - ry, 2 * rx + 1, 2 * ry + 1, rx, ry, 1,
+            color, &clip, LCD_WriteFillRectPreclipped );
+    LCD_EndWrite( );
+}
+
+/**
+ * Draw a rounded rectangle outline
+ *
+ * @param   x       Top left corner x coordinate
+ * @param   y       Top left corner y coordinate
+ * @param   w       Width in pixels
+ * @param   h       Height in pixels
+ * @param   r       Radius of the corners, limited to fit the rectangle
+ * @param   color   16-bit 5-6-5 Color to draw with
+ */
+void LCD_DrawRoundRect( int16_t x, int16_t y, int16_t w, int16_t h,
+        int16_t r, uint16_t color )
+{
+    LCD_Rect clip;
+
+    LCD_ScreenClip( &clip );
+    LCD_StartWrite( );
+    LCD_RasterRoundRect( x, y, w, h, r, r, 0, color, &clip,
+            LCD_WriteFillRectPreclipped );
+    LCD_EndWrite( );
+}
+
+/**
+ * Draw a filled rounded rectangle
+ *
+ * @param   x       Top left corner x coordinate
+ * @param   y       Top left corner y coordinate
+ * @param   w       Width in pixels
+ * @param   h       Height in pixels
+ * @param   r       Radius of the corners, limited to fit the rectangle
+ * @param   color   16-bit 5-6-5 Color to fill with
+ */
+void LCD_FillRoundRect( int16_t x, int16_t y, int16_t w, int16_t h,
+        int16_t r, uint16_t color )
+{
+    LCD_Rect clip;
+
+    LCD_ScreenClip( &clip );
+    LCD_StartWrite( );
+    LCD_RasterRoundRect( x, y, w, h, r, r, 1, color, &clip,
+            LCD_WriteFillRectPreclipped );
+    LCD_EndWrite( );
+}
+
+/**
+ * Draw a triangle outline
+ *
+ * @param   x0, y0  First vertex
+ * @param   x1, y1  Second vertex
+ * @param   x2, y2  Third vertex
+ * @param   color   16-bit 5-6-5 Color to draw with
+ */
+void LCD_DrawTriangle( int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+        int16_t x2, int16_t y2, uint16_t color )
+{
+    LCD_StartWrite( );
+    LCD_DrawLine( x0, y0, x1, y1, color );
+    LCD_DrawLine( x1, y1, x2, y2, color );
+    LCD_DrawLine( x2, y2, x0, y0, color );
+    LCD_EndWrite( );
+}
+
+/**
+ * Draw a filled triangle, see LCD_RasterTriangle()
+ *
+ * @param   x0, y0  First vertex
+ * @param   x1, y1  Second vertex
+ * @param   x2, y2  Third vertex
+ * @param   color   16-bit 5-6-5 Color to fill with
+ */
+void LCD_FillTriangle( int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+        int16_t x2, int16_t y2, uint16_t color )
+{
+    LCD_Rect clip;
+
+    LCD_ScreenClip( &clip );
+    LCD_StartWrite( );
+    LCD_RasterTriangle( x0, y0, x1, y1, x2, y2, color, &clip,
+            LCD_WriteFillRectPreclipped );
+    LCD_EndWrite( );
+}
+
+/**
+ * Draw a polygon outline, the lines joining each vertex to the next and
+ * the last one to the first.
+ *
+ * @param   points  The vertices
+ * @param   count   Number of vertices
+ * @param   color   16-bit 5-6-5 Color to draw with
+ */
+void LCD_DrawPolygon( const LCD_Point *points, uint8_t count, uint16_t color )
+{
+    const LCD_Point *q;
+    uint8_t i;
+
+    if ( count == 0 ) return;
+    q = &points[count - 1];
+
+    LCD_StartWrite( );
+    for ( i = 0; i < count; i++ )
+    {
+        LCD_DrawLine( q->x, q->y, points[i].x, points[i].y, color );
+        q = &points[i];
+    }
+    LCD_EndWrite( );
+}
+
+/**
+ * Draw a filled polygon, convex or not, see LCD_RasterPolygon()
+ *
+ * @param   points  The vertices
+ * @param   count   Number of vertices
+ * @param   color   16-bit 5-6-5 Color to fill with
+ */
+void LCD_FillPolygon( const LCD_Point *points, uint8_t count, uint16_t color )
+{
+    LCD_Rect clip;
+
+    LCD_ScreenClip( &clip );
+    LCD_StartWrite( );
+    LCD_RasterPolygon( points, count, color, &clip,
+            LCD_WriteFillRectPreclipped );
+    LCD_EndWrite( );
+}
+
+/**
+ * -------------------
+ *  Private Functions
+ * -------------------
+ */
+
+/**
+ * Starts a shape: its spans are merged in the lanes, clipped and sent to
+ * span.
+ */
+static void LCD_ShapeBegin( uint16_t color, const LCD_Rect *clip,
+        LCD_SpanFunc span )
+{
+    uint8_t i;
+
+    LCD_shapeColor = color;
+    LCD_shapeClip = clip;
+    LCD_shapeSpan = span;
+    for ( i = 0; i < LCD_SHAPE_LANES; i++ )
+    {
+        LCD_shapeLanes[i].h = 0;
+    }
+}
+
+/**
+ * Ends a shape, sending the spans still waiting in the lanes.
+ */
+static void LCD_ShapeEnd( void )
+{
+    uint8_t i;
+
+    for ( i = 0; i < LCD_SHAPE_LANES; i++ )
+    {
+        LCD_ShapeFlush( i );
+    }
+}
+
+/**
+ * Adds a span, or a stack of equal spans, to a lane after clipping it.
+ * If the lane holds a rectangle of the same columns that it extends, above
+ * or below, it grows by the span, otherwise the rectangle is sent and the
+ * span takes its place.
+ *
+ * @param   lane    Lane of the span
+ * @param   x, y    Left end of the (first) span
+ * @param   w       Width in pixels
+ * @param   h       Number of rows
+ */
+static void LCD_ShapeSpan( uint8_t lane, int32_t x, int32_t y, int32_t w,
+        int32_t h )
+{
+    const LCD_Rect *clip = LCD_shapeClip;
+    LCD_Rect *r = &LCD_shapeLanes[lane];
+    int32_t x2 = x + w;     // exclusive
+    int32_t y2 = y + h;     // exclusive
+
+    if ( x < clip->x ) x = clip->x;
+    if ( y < clip->y ) y = clip->y;
+    if ( x2 > clip->x + clip->w ) x2 = clip->x + clip->w;
+    if ( y2 > clip->y + clip->h ) y2 = clip->y + clip->h;
+    if ( x >= x2 || y >= y2 ) return;
+
+    if ( ( r->h > 0 ) && ( r->x == x ) && ( r->x + r->w == x2 )
+            && ( ( r->y + r->h == y ) || ( r->y == y2 ) ) )
+    {
+        if ( y < r->y ) r->y = y;
+        r->h += y2 - y;
+        return;
+    }
+
+    LCD_ShapeFlush( lane );
+    r->x = x;
+    r->y = y;
+    r->w = x2 - x;
+    r->h = y2 - y;
+}
+
+/**
+ * Sends the rectangle waiting in a lane, if any.
+ */
+static void LCD_ShapeFlush( uint8_t lane )
+{
+    LCD_Rect *r = &LCD_shapeLanes[lane];
+
+    if ( r->h > 0 )
+    {
+        LCD_shapeSpan( r->x, r->y, r->w, r->h, LCD_shapeColor );
+        r->h = 0;
+    }
+}
+
+/**
+ * Starts the scan of a quarter ellipse at its widest row, k = 0. Scaled by
+ * 4(2rx+1)^2(2ry+1)^2 the criterion of LCD_RasterRoundRect() is
+ * 4x^2(2ry+1)^2 + 4k^2(2rx+1)^2 <= (2rx+1)^2(2ry+1)^2, which is updated
+ * with additions only as x and k step by one.
+ */
+static void LCD_EllipseStart( LCD_Ellipse *e, int16_t rx, int16_t ry )
+{
+    int64_t a = (int64_t) ( 2 * ry + 1 ) * ( 2 * ry + 1 );
+    int64_t b = (int64_t) ( 2 * rx + 1 ) * ( 2 * rx + 1 );
+
+    e->t = a * b;
+    e->f = 4 * a * rx * rx;
+    e->dx = 4 * a * ( 2 * rx - 1 );
+    e->dk = 4 * b;
+    e->a8 = 8 * a;
+    e->b8 = 8 * b;
+    e->x = rx;
+}
+
+/**
+ * Steps the scan of a quarter ellipse to the next row.
+ *
+ * @return  Half width of the row, 0 or more up to k = ry
+ */
+static int16_t LCD_EllipseStep( LCD_Ellipse *e )
+{
+    e->f += e->dk;
+    e->dk += e->b8;
+    while ( ( e->x > 0 ) && ( e->f > e->t ) )
+    {
+        e->f -= e->dx;
+        e->dx -= e->a8;
+        e->x--;
+    }
+    return e->x;
+}
+
+/**
+ * Adds the outline of a row of a round rectangle: the pixels of the left
+ * and right end of the row that are not above or below a pixel of the row
+ * outside of it, at least one each. The two merge into one span when they
+ * meet.
+ *
+ * @param   lane    Lane of the left end, the right end uses the next lane
+ * @param   xl, xr  Center columns of the left and right corners
+ * @param   y       Row
+ * @param   dx      Half width of the row
+ * @param   outer   Half width of the row outside of it, -1 if there is none
+ */
+static void LCD_OutlineRow( uint8_t lane, int16_t xl, int16_t xr, int16_t y,
+        int16_t dx, int16_t outer )
+{
+    int16_t len = ( dx > outer ) ? dx - outer : 1;
+
+    if ( ( outer < 0 ) || ( xr + dx - len + 1 <= xl - dx + len ) )
+    {
+        LCD_ShapeSpan( lane, xl - dx, y, xr - xl + 2 * dx + 1, 1 );
+        return;
+    }
+    LCD_ShapeSpan( lane, xl - dx, y, len, 1 );
+    LCD_ShapeSpan( lane + 1, xr + dx - len + 1, y, len, 1 );
+}
+
+/**
+ * Returns num / den rounded up, for den > 0.
+ */
+static int16_t LCD_CeilDiv( int64_t num, int32_t den )
+{
+    int64_t q = num / den;
+
+    if ( q * den < num ) q++;
+    return (int16_t) q;
+}
+
+/**
+ * Sets a clip rectangle to the display.
+ */
+static void LCD_ScreenClip( LCD_Rect *clip )
+{
+    clip->x = 0;
+    clip->y = 0;
+    clip->w = LCD_width;
+    clip->h = LCD_height;
+}
@@ -0,0 +1,416 @@
+/**
+ * @file    lcd_spi.c
+ * @brief   SPI transport for the ILI9341 LCD driver. Frames commands and
+ *          pixel data on SPI1 with the LCD CS and D/C lines.
+ */
+
+/**
+ ******************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2021 John Vedder
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************
+ * Portions adapted from Adafruit Arduino Libraries. See LICENSE file.
+ ******************************************************************************
+ */
+
+
+#include "main.h"
+#include "spi.h"
+#include "lcd.h"
+#include "lcd_spi.h"
+
+#ifdef LCD_SPI_DIRECT
+#define CS_ACTIVE()     ( LCD_CS_GPIO_Port->BSRR = (uint32_t) LCD_CS_Pin << 16 )
+#define CS_IDLE()       ( LCD_CS_GPIO_Port->BSRR = LCD_CS_Pin )
+
+#define DC_COMMAND()    ( DATA_CMD_GPIO_Port->BSRR = (uint32_t) DATA_CMD_Pin << 16 )
+#define DC_DATA()       ( DATA_CMD_GPIO_Port->BSRR = DATA_CMD_Pin )
+#else
+#define CS_ACTIVE()     HAL_GPIO_WritePin(LCD_CS_GPIO_Port, LCD_CS_Pin, GPIO_PIN_RESET)
+#define CS_IDLE()       HAL_GPIO_WritePin(LCD_CS_GPIO_Port, LCD_CS_Pin, GPIO_PIN_SET)
+
+#define DC_COMMAND()    HAL_GPIO_WritePin(DATA_CMD_GPIO_Port, DATA_CMD_Pin, GPIO_PIN_RESET)
+#define DC_DATA()       HAL_GPIO_WritePin(DATA_CMD_GPIO_Port, DATA_CMD_Pin, GPIO_PIN_SET)
+#endif
+
+#define LCD_TIMEOUT     1000    // 1 second
+
+/*
+ * Pixel data is sent in 16-bit SPI frames, one frame per pixel, so one DMA
+ * chunk is limited by the uint16_t HAL transfer size to 65535 pixels.
+ */
+#define LCD_DMA_MAX_PIXELS  0xFFFF
+
+/*
+ * Private Variables
+ */
+static volatile uint8_t LCD_spiDepth = 0;   // LCD_SPI_Begin() nesting, CS is active while non-zero,
+                                            // released by the DMA callback
+
+/*
+ * Private Variables for DMA transfers. A transfer longer than
+ * LCD_DMA_MAX_PIXELS is split into chunks, the next chunk is started from
+ * the SPI Tx complete callback.
+ */
+static volatile uint8_t LCD_dmaBusy = 0;    // non-zero while a DMA transfer is in progress
+static uint16_t LCD_dmaColor;               // color for solid fills
+static const uint16_t *LCD_dmaSource;       // next pixel to send
+static uint8_t LCD_dmaIncrement;            // zero to repeat *LCD_dmaSource
+static uint32_t LCD_dmaRemaining;           // pixels not yet handed to the DMA
+static LCD_DMACallback LCD_dmaCallback;     // called when the transfer completes
+
+/*
+ * Private Function Prototypes
+ */
+static void LCD_SPI_Release( void );
+static void LCD_SPI_SetFrameSize( uint32_t dataSize );
+static void LCD_SPI_StartDMA( const uint16_t *source, uint8_t increment,
+        uint32_t len, LCD_DMACallback callback );
+static void LCD_SPI_StartDMAChunk( void );
+
+#ifdef LCD_SPI_DIRECT
+/**
+ * Waits for room in the Tx FIFO, then queues one 8-bit frame. The byte
+ * access matters, a half-word write would be packed into two frames.
+ */
+static inline void LCD_SPI_Write8( uint8_t b )
+{
+    while ( !( SPI1->SR & SPI_SR_TXE ) )
+    {
+    }
+    *(__IO uint8_t*) &SPI1->DR = b;
+}
+
+/**
+ * Waits for room in the Tx FIFO, then queues one 16-bit frame.
+ */
+static inline void LCD_SPI_Write16( uint16_t w )
+{
+    while ( !( SPI1->SR & SPI_SR_TXE ) )
+    {
+    }
+    *(__IO uint16_t*) &SPI1->DR = w;
+}
+
+/**
+ * Waits until the Tx FIFO is empty and the last frame has left the shift
+ * register. Required before D/C, CS or the frame size may change.
+ */
+static void LCD_SPI_WaitIdle( void )
+{
+    while ( SPI1->SR & SPI_SR_FTLVL )
+    {
+    }
+    while ( SPI1->SR & SPI_SR_BSY )
+    {
+    }
+}
+#endif
+
+/*
+ *  -------------------
+ *  Public Functions
+ * -------------------
+ */
+
+/**
+ * Starts a transaction by asserting CS. Transactions nest, CS stays active
+ * until the outermost one ends, so a sequence of commands can share one
+ * transaction. Waits for any DMA transfer first.
+ */
+void LCD_SPI_Begin( void )
+{
+    LCD_WaitDMA( );
+    if ( LCD_spiDepth++ == 0 )
+    {
+#ifdef LCD_SPI_DIRECT
+        if ( !( SPI1->CR1 & SPI_CR1_SPE ) )
+        {
+            __HAL_SPI_ENABLE( &hspi1 );
+        }
+#endif
+        CS_ACTIVE( );
+        LCD_stats.transactions++;
+    }
+}
+
+/**
+ * Ends a transaction, see LCD_SPI_Begin(). Waits for any DMA transfer first.
+ */
+void LCD_SPI_End( void )
+{
+    LCD_WaitDMA( );
+    LCD_SPI_Release( );
+}
+
+/**
+ * Sends a command byte. D/C is left in data mode for the parameters.
+ */
+void LCD_SPI_Command( uint8_t cmd )
+{
+    LCD_WaitDMA( );
+    LCD_SPI_SetFrameSize( SPI_DATASIZE_8BIT );
+    LCD_stats.cmdBytes++;
+#ifdef LCD_SPI_DIRECT
+    LCD_SPI_WaitIdle( );
+    DC_COMMAND( );
+    LCD_SPI_Write8( cmd );
+    LCD_SPI_WaitIdle( );
+#else
+    DC_COMMAND( );
+    HAL_SPI_Transmit( &hspi1, &cmd, 1, LCD_TIMEOUT );
+#endif
+    DC_DATA( );
+}
+
+/**
+ * Sends command parameter bytes in 8-bit frames.
+ */
+void LCD_SPI_Data( const uint8_t *data, uint16_t len )
+{
+    LCD_WaitDMA( );
+    LCD_SPI_SetFrameSize( SPI_DATASIZE_8BIT );
+    LCD_stats.cmdBytes += len;
+#ifdef LCD_SPI_DIRECT
+    while ( len-- )
+    {
+        LCD_SPI_Write8( *data++ );
+    }
+#else
+    HAL_SPI_Transmit( &hspi1, (uint8_t*) data, len, LCD_TIMEOUT );
+#endif
+}
+
+/**
+ * Sends one color 'len' times in 16-bit frames, polled.
+ */
+void LCD_SPI_Color( uint16_t color, uint32_t len )
+{
+    LCD_WaitDMA( );
+    LCD_SPI_SetFrameSize( SPI_DATASIZE_16BIT );
+    LCD_stats.pixels += len;
+    while ( len-- )
+    {
+#ifdef LCD_SPI_DIRECT
+        LCD_SPI_Write16( color );
+#else
+        HAL_SPI_Transmit( &hspi1, (uint8_t*) &color, 1, LCD_TIMEOUT );
+#endif
+    }
+}
+
+/**
+ * Sends a buffer of pixels in 16-bit frames, polled.
+ */
+void LCD_SPI_Pixels( const uint16_t *pixels, uint32_t len )
+{
+    LCD_WaitDMA( );
+    LCD_SPI_SetFrameSize( SPI_DATASIZE_16BIT );
+    LCD_stats.pixels += len;
+#ifdef LCD_SPI_DIRECT
+    while ( len-- )
+    {
+        LCD_SPI_Write16( *pixels++ );
+    }
+#else
+    while ( len > 0 )
+    {
+        uint16_t n = ( len > 0xFFFF ) ? 0xFFFF : len;
+        HAL_SPI_Transmit( &hspi1, (uint8_t*) pixels, n, LCD_TIMEOUT );
+        pixels += n;
+        len -= n;
+    }
+#endif
+}
+
+/**
+ * Starts a DMA transfer of one color 'len' times. The transaction must have
+ * been started and the RAMWR command sent. The DMA completion takes the
+ * place of the matching LCD_SPI_End(), then the optional callback is
+ * invoked (interrupt context).
+ */
+void LCD_SPI_ColorDMA( uint16_t color, uint32_t len, LCD_DMACallback callback )
+{
+    LCD_dmaColor = color;
+    LCD_SPI_StartDMA( &LCD_dmaColor, 0, len, callback );
+}
+
+/**
+ * Starts a DMA transfer of a buffer of pixels, see LCD_SPI_ColorDMA(). The
+ * buffer must remain valid until the transfer completes.
+ */
+void LCD_SPI_PixelsDMA( const uint16_t *pixels, uint32_t len,
+        LCD_DMACallback callback )
+{
+    LCD_SPI_StartDMA( pixels, 1, len, callback );
+}
+
+/**
+ * Returns non-zero while a DMA transfer to the display is in progress.
+ */
+uint8_t LCD_IsBusy( void )
+{
+    return LCD_dmaBusy;
+}
+
+/**
+ * Waits for any DMA transfer to the display to complete. SPI1 is shared with
+ * the SD card, so this must be called before any other use of hspi1.
+ */
+void LCD_WaitDMA( void )
+{
+    while ( LCD_dmaBusy )
+    {
+    }
+}
+
+/**
+ * SPI Tx complete callback (interrupt context). Starts the next chunk of a
+ * long transfer or ends the transaction.
+ */
+void HAL_SPI_TxCpltCallback( SPI_HandleTypeDef *hspi )
+{
+    if ( ( hspi != &hspi1 ) || !LCD_dmaBusy ) return;
+
+    if ( LCD_dmaRemaining > 0 )
+    {
+        LCD_SPI_StartDMAChunk( );
+    }
+    else
+    {
+        LCD_SPI_Release( );
+        LCD_dmaBusy = 0;
+        if ( LCD_dmaCallback != NULL )
+        {
+            LCD_dmaCallback( );
+        }
+    }
+}
+
+/**
+ * SPI error callback (interrupt context). Abandons the DMA transfer.
+ */
+void HAL_SPI_ErrorCallback( SPI_HandleTypeDef *hspi )
+{
+    if ( ( hspi != &hspi1 ) || !LCD_dmaBusy ) return;
+
+    LCD_dmaRemaining = 0;
+    LCD_SPI_Release( );
+    LCD_dmaBusy = 0;
+}
+
+/**
+ * -------------------
+ *  Private Functions
+ * -------------------
+ */
+
+/**
+ * Ends one level of transaction nesting. When the outermost transaction
+ * ends SPI1 is left idle in 8-bit mode with an empty Rx FIFO, as the SD card
+ * driver expects it, and CS is released.
+ */
+static void LCD_SPI_Release( void )
+{
+    if ( LCD_spiDepth == 0 || --LCD_spiDepth > 0 ) return;
+
+#ifdef LCD_SPI_DIRECT
+    LCD_SPI_WaitIdle( );
+    // Nothing reads the Rx FIFO while transmitting, so drain it and clear the overrun
+    while ( SPI1->SR & SPI_SR_FRLVL )
+    {
+        (void) *(__IO uint8_t*) &SPI1->DR;
+    }
+    __HAL_SPI_CLEAR_OVRFLAG( &hspi1 );
+#endif
+    LCD_SPI_SetFrameSize( SPI_DATASIZE_8BIT );
+    CS_IDLE( );
+}
+
+/**
+ * Switches SPI1 between 8-bit frames for commands and parameters, and 16-bit
+ * frames for pixel data. A 16-bit frame is sent high byte first, so native
+ * '565' colors need no byte swap and each pixel is a single FIFO write.
+ * hspi1.Init.DataSize is kept in step because the HAL uses it to size each
+ * frame.
+ *
+ * @param   dataSize    SPI_DATASIZE_8BIT or SPI_DATASIZE_16BIT
+ */
+static void LCD_SPI_SetFrameSize( uint32_t dataSize )
+{
+    if ( hspi1.Init.DataSize != dataSize )
+    {
+#ifdef LCD_SPI_DIRECT
+        LCD_SPI_WaitIdle( );
+#endif
+        MODIFY_REG( hspi1.Instance->CR2, SPI_CR2_DS, dataSize );
+        hspi1.Init.DataSize = dataSize;
+    }
+}
+
+static void LCD_SPI_StartDMA( const uint16_t *source, uint8_t increment,
+        uint32_t len, LCD_DMACallback callback )
+{
+    LCD_dmaSource = source;
+    LCD_dmaIncrement = increment;
+    LCD_dmaRemaining = len;
+    LCD_dmaCallback = callback;
+    LCD_dmaBusy = 1;
+    LCD_stats.pixels += len;
+
+    LCD_SPI_SetFrameSize( SPI_DATASIZE_16BIT );
+    LCD_SPI_StartDMAChunk( );
+}
+
+/**
+ * Hands the next chunk of the current transfer to the DMA.
+ */
+static void LCD_SPI_StartDMAChunk( void )
+{
+    uint32_t n = LCD_dmaRemaining;
+    const uint16_t *source = LCD_dmaSource;
+
+    if ( n > LCD_DMA_MAX_PIXELS )
+    {
+        n = LCD_DMA_MAX_PIXELS;
+    }
+    LCD_dmaRemaining -= n;
+
+    // Solid fills repeat a single half-word, so the memory address must not increment
+    if ( LCD_dmaIncrement )
+    {
+        SET_BIT( hspi1.hdmatx->Instance->CCR, DMA_CCR_MINC );
+        LCD_dmaSource += n;
+    }
+    else
+    {
+        CLEAR_BIT( hspi1.hdmatx->Instance->CCR, DMA_CCR_MINC );
+    }
+
+    if ( HAL_SPI_Transmit_DMA( &hspi1, (uint8_t*) source, n ) != HAL_OK )
+    {
+        // Abandon the transfer rather than leaving the caller waiting forever
+        LCD_dmaRemaining = 0;
+        LCD_SPI_Release( );
+        LCD_dmaBusy = 0;
+    }
+}
@@ -0,0 +1,585 @@
+/**
+ * @file    lcd_text.c
+ * @brief   Text measurement and layout: word wrap, alignment, ellipsis and
+ *          clipped drawing
+ */
+/**
+ ******************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2021 John Vedder
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************
+ */
+
+#include "main.h"
+#include "lcd.h"
+#include "lcd_text.h"
+
+/*
+ * Private Variables
+ */
+static uint16_t LCD_fieldBuffer[LCD_FIELD_CHUNK];   // Part of a cell being composited
+
+/*
+ * Private Function Prototypes
+ */
+static uint16_t LCD_MeasureText( const uint8_t *text, uint16_t length,
+        uint8_t utf8 );
+static int16_t LCD_Advance( const GFXfont *font, uint16_t prev, uint16_t c );
+static uint16_t LCD_LastCharStart( const LCD_Layout *layout,
+        const LCD_Line *line );
+static uint16_t LCD_LastChar( const LCD_Layout *layout, const LCD_Line *line );
+static uint16_t LCD_DotsWidth( const LCD_Layout *layout, const LCD_Line *line );
+static uint16_t LCD_TrimLine( const LCD_Layout *layout, LCD_Line *line );
+static void LCD_WriteCell( const LCD_TextField *field, int16_t x, uint16_t w,
+        uint8_t c );
+
+/*
+ *  -------------------
+ *  Public Functions
+ * -------------------
+ */
+
+/**
+ * Returns the advance width of the first characters of a string in the
+ * current font and text size: how far the cursor moves drawing them,
+ * kerned as LCD_DrawText() does.
+ *
+ * @param   text    The text
+ * @param   length  Characters to measure, up to the end of the string
+ * @return  The width in pixels
+ */
+uint16_t LCD_GetTextWidth( const uint8_t *text, uint16_t length )
+{
+    return LCD_MeasureText( text, length, 0 );
+}
+
+/**
+ * Returns the advance width of the first characters of a UTF-8 string, as
+ * LCD_GetTextWidth() does for the characters LCD_DrawTextUTF8() draws.
+ *
+ * @param   text    The UTF-8 text
+ * @param   length  Bytes to measure, the characters that start in them, up
+ *                  to the end of the string
+ * @return  The width in pixels
+ */
+uint16_t LCD_GetTextWidthUTF8( const uint8_t *text, uint16_t length )
+{
+    return LCD_MeasureText( text, length, 1 );
+}
+
+/**
+ * Lays out a string in a box, in the current font and text size. Lines
+ * break at the last space that fits the width of the box, inside a word
+ * too long for a line, and at '\n'. Spaces at a break are dropped. Lines
+ * that do not fit the height of the box, or LCD_LAYOUT_MAX_LINES, are left
+ * out, and with LCD_LAYOUT_ELLIPSIS the last line is shortened to end with
+ * "...".
+ *
+ * @param   layout  Returns the layout
+ * @param   text    Null terminated string, must remain valid while the
+ *                  layout is in use
+ * @param   box     The box to lay the text out in
+ * @param   flags   LCD_ALIGN_LEFT, LCD_ALIGN_CENTER or LCD_ALIGN_RIGHT,
+ *                  or'ed with LCD_LAYOUT_ELLIPSIS and LCD_LAYOUT_UTF8
+ */
+void LCD_LayoutText( LCD_Layout *layout, const uint8_t *text,
+        const LCD_Rect *box, uint8_t flags )
+{
+    const GFXfont *font = LCD_font;
+    const uint8_t *p;
+    LCD_Line *line;
+    uint16_t maxLines = LCD_LAYOUT_MAX_LINES;
+    uint16_t pos = 0;
+    uint16_t i;
+    uint16_t end;
+    uint16_t next;
+    uint16_t after;
+    uint16_t breakEnd;
+    uint16_t breakWidth;
+    uint16_t width;
+    uint16_t descent;
+    int16_t advance;
+    uint16_t prev;
+    uint16_t c;
+
+    layout->text = text;
+    layout->font = font;
+    layout->box = *box;
+    layout->sizeX = LCD_textsize_x;
+    layout->sizeY = LCD_textsize_y;
+    layout->utf8 = ( flags & LCD_LAYOUT_UTF8 ) ? 1 : 0;
+    layout->lineHeight = font->yAdvance * LCD_textsize_y;
+    layout->lines = 0;
+    layout->width = 0;
+
+    // The baseline is below the tallest glyph
+    LCD_GetFontExtent( font, &layout->ascent, &descent );
+    layout->ascent *= LCD_textsize_y;
+
+    if ( layout->lineHeight == 0 || box->w <= 0 || box->h <= 0 )
+    {
+        layout->truncated = ( text[0] != '\0' );
+        return;
+    }
+    if ( box->h / layout->lineHeight < maxLines )
+        maxLines = box->h / layout->lineHeight;
+
+    while ( text[pos] && layout->lines < maxLines )
+    {
+        width = 0;
+        breakEnd = pos;
+        breakWidth = 0;
+        prev = 0;
+        for ( i = pos;; i = after )
+        {
+            p = text + i;
+            c = LCD_NextChar( &p, layout->utf8 );
+            after = p - text;
+            if ( c == '\0' || c == '\n' )
+            {
+                end = i;
+                next = after;
+                break;
+            }
+            advance = LCD_Advance( font, prev, c ) * LCD_textsize_x;
+            if ( c == ' ' )
+            {
+                // A break after a word, the spaces may hang past the edge
+                if ( i > pos && prev != ' ' )
+                {
+                    breakEnd = i;
+                    breakWidth = width;
+                }
+            }
+            else if ( ( width + advance > box->w ) && ( i > pos ) )
+            {
+                if ( breakEnd > pos )
+                {
+                    end = breakEnd;
+                    width = breakWidth;
+                }
+                else
+                {
+                    end = i;
+                }
+                for ( next = end; text[next] == ' '; next++ )
+                    ;
+                break;
+            }
+            width += advance;
+            prev = c;
+        }
+
+        line = &layout->line[layout->lines++];
+        line->start = pos;
+        line->length = end - pos;
+        line->width = width;
+        line->ellipsis = 0;
+        line->width = LCD_TrimLine( layout, line );
+        pos = next;
+    }
+    layout->truncated = ( text[pos] != '\0' );
+
+    if ( layout->truncated && ( flags & LCD_LAYOUT_ELLIPSIS ) && layout->lines )
+    {
+        line = &layout->line[layout->lines - 1];
+        while ( line->length > 0
+                && line->width + LCD_DotsWidth( layout, line ) > box->w )
+        {
+            c = LCD_LastChar( layout, line );
+            line->length = LCD_LastCharStart( layout, line ) - line->start;
+            line->width -= LCD_Advance( font, LCD_LastChar( layout, line ), c )
+                    * LCD_textsize_x;
+        }
+        line->width = LCD_TrimLine( layout, line );
+        line->width += LCD_DotsWidth( layout, line );
+        line->ellipsis = 1;
+    }
+
+    for ( i = 0; i < layout->lines; i++ )
+    {
+        line = &layout->line[i];
+        line->x = box->x;
+        if ( ( flags & LCD_ALIGN_MASK ) == LCD_ALIGN_CENTER )
+            line->x += ( box->w - (int16_t) line->width ) / 2;
+        else if ( ( flags & LCD_ALIGN_MASK ) == LCD_ALIGN_RIGHT )
+            line->x += box->w - (int16_t) line->width;
+        if ( line->width > layout->width ) layout->width = line->width;
+    }
+}
+
+/**
+ * Returns the height of the lines of a layout in pixels.
+ */
+uint16_t LCD_GetLayoutHeight( const LCD_Layout *layout )
+{
+    return layout->lines * layout->lineHeight;
+}
+
+/**
+ * Draws a layout in LCD_textcolor, opaque if LCD_textbgcolor differs from
+ * it (see LCD_SetTextColors()). Only the lines inside the clip rectangle are drawn, and of those the
+ * characters inside it, whole.
+ *
+ * @param   layout  The layout
+ * @param   clip    Clip rectangle, or NULL for the display
+ */
+void LCD_DrawLayout( const LCD_Layout *layout, const LCD_Rect *clip )
+{
+    const GFXfont *font = LCD_font;
+    const GFXglyph *glyph;
+    const GFXglyph *prev;
+    const LCD_Line *line;
+    const uint8_t *text;
+    const uint8_t *end;
+    int16_t clipX1 = 0;
+    int16_t clipY1 = 0;
+    int16_t clipX2 = LCD_width;
+    int16_t clipY2 = LCD_height;
+    int16_t top;
+    int16_t x;
+    int16_t gx;
+    uint16_t c;
+    uint8_t dots;
+    uint8_t i;
+
+    if ( clip != NULL )
+    {
+        clipX1 = clip->x;
+        clipY1 = clip->y;
+        clipX2 = clip->x + clip->w;
+        clipY2 = clip->y + clip->h;
+    }
+
+    LCD_font = layout->font;
+    LCD_StartWrite( );
+    for ( i = 0; i < layout->lines; i++ )
+    {
+        top = layout->box.y + i * layout->lineHeight;
+        if ( top >= clipY2 ) break;
+        if ( top + (int16_t) layout->lineHeight <= clipY1 ) continue;
+
+        line = &layout->line[i];
+        text = layout->text + line->start;
+        end = text + line->length;
+        x = line->x;
+        dots = line->ellipsis ? 3 : 0;
+        prev = NULL;
+        while ( ( text < end || dots > 0 ) && x < clipX2 )
+        {
+            if ( text < end )
+            {
+                c = LCD_NextChar( &text, layout->utf8 );
+            }
+            else
+            {
+                c = '.';
+                dots--;
+            }
+            glyph = LCD_GetGlyph( layout->font, c );
+            x += LCD_GetKerning( layout->font, prev, glyph ) * layout->sizeX;
+            prev = glyph;
+            if ( glyph == NULL ) continue;
+            gx = x + (int8_t) glyph->xOffset * layout->sizeX;
+            if ( glyph->width > 0 && glyph->height > 0
+                    && gx < clipX2 && gx + glyph->width * layout->sizeX > clipX1 )
+            {
+                LCD_WriteChar( x, top + layout->ascent, c, LCD_textcolor,
+                        layout->sizeX, layout->sizeY );
+            }
+            x += glyph->xAdvance * layout->sizeX;
+        }
+    }
+    LCD_EndWrite( );
+    LCD_font = font;
+}
+
+/**
+ * Initializes an empty text field, in the current font and text size.
+ * Nothing is drawn, the field's area must already be its background color
+ * (after the display was cleared, initialize the field again).
+ *
+ * @param   field   The text field
+ * @param   x       Cursor x coordinate of the first character
+ * @param   y       Cursor y coordinate (baseline)
+ * @param   color   16-bit 5-6-5 Color of the text
+ * @param   bgcolor 16-bit 5-6-5 Color of the background
+ */
+void LCD_InitTextField( LCD_TextField *field, int16_t x, int16_t y,
+        uint16_t color, uint16_t bgcolor )
+{
+    const GFXfont *font = LCD_font;
+    uint16_t ascent;
+    uint16_t descent;
+
+    // The cells span the tallest glyph above the baseline to the deepest below
+    LCD_GetFontExtent( font, &ascent, &descent );
+
+    field->font = font;
+    field->x = x;
+    field->y = y;
+    field->top = y - ascent * LCD_textsize_y;
+    field->height = ( ascent + descent ) * LCD_textsize_y;
+    field->width = 0;
+    field->color = color;
+    field->bgcolor = bgcolor;
+    field->sizeX = LCD_textsize_x;
+    field->sizeY = LCD_textsize_y;
+    field->length = 0;
+}
+
+/**
+ * Shows a string in a text field, repainting only the cells that changed.
+ * Cells left over from a longer string are cleared.
+ *
+ * @param   field   The text field
+ * @param   text    Null terminated string, up to LCD_FIELD_MAX characters
+ *                  are shown
+ */
+void LCD_SetTextField( LCD_TextField *field, const uint8_t *text )
+{
+    int16_t x = field->x;
+    uint16_t advance;
+    uint8_t shifted = 0;
+    uint8_t i;
+
+    LCD_StartWrite( );
+    for ( i = 0; i < LCD_FIELD_MAX && text[i]; i++ )
+    {
+        advance = LCD_Advance( field->font, 0, text[i] ) * field->sizeX;
+        if ( shifted || i >= field->length || text[i] != field->text[i] )
+        {
+            LCD_WriteCell( field, x, advance, text[i] );
+            // The cells after a change of width have moved
+            if ( i >= field->length
+                    || advance != LCD_Advance( field->font, 0, field->text[i] )
+                            * field->sizeX ) shifted = 1;
+            field->text[i] = text[i];
+        }
+        x += advance;
+    }
+
+    if ( x < field->x + (int16_t) field->width )
+    {
+        LCD_WriteCell( field, x, field->x + field->width - x, ' ' );
+    }
+    LCD_EndWrite( );
+
+    field->length = i;
+    field->width = x - field->x;
+}
+
+/**
+ * -------------------
+ *  Private Functions
+ * -------------------
+ */
+
+/**
+ * Measures a string, see LCD_GetTextWidth().
+ *
+ * @param   length  Bytes to measure, the characters that start in them
+ * @param   utf8    If set the text is UTF-8, otherwise ASCII or Latin-1
+ */
+static uint16_t LCD_MeasureText( const uint8_t *text, uint16_t length,
+        uint8_t utf8 )
+{
+    const uint8_t *start = text;
+    uint16_t width = 0;
+    uint16_t prev = 0;
+    uint16_t c;
+
+    while ( (uint16_t) ( text - start ) < length
+            && ( c = LCD_NextChar( &text, utf8 ) ) != 0 )
+    {
+        width += LCD_Advance( LCD_font, prev, c );
+        prev = c;
+    }
+    return width * LCD_textsize_x;
+}
+
+/**
+ * Returns the advance width of a character in a font at size 1, kerned
+ * after the character 'prev' (0 for none), 0 if the font does not have it.
+ */
+static int16_t LCD_Advance( const GFXfont *font, uint16_t prev, uint16_t c )
+{
+    const GFXglyph *glyph = LCD_GetGlyph( font, c );
+
+    if ( glyph == NULL ) return 0;
+    if ( font->kerning == NULL || prev == 0 ) return glyph->xAdvance;
+    return glyph->xAdvance + LCD_GetKerning( font, LCD_GetGlyph( font, prev ), glyph );
+}
+
+/**
+ * Returns the offset in the text of the first byte of the last character
+ * of a line that is not empty. In UTF-8 that is the start of the sequence
+ * it ends with, if the line decodes up to its end from there, otherwise
+ * its last byte, which decodes on its own as LCD_UTF8_INVALID.
+ */
+static uint16_t LCD_LastCharStart( const LCD_Layout *layout,
+        const LCD_Line *line )
+{
+    uint16_t end = line->start + line->length;
+    uint16_t i = end - 1;
+    const uint8_t *p;
+
+    if ( !layout->utf8 ) return i;
+    while ( i > line->start && end - i < 4 && ( layout->text[i] & 0xC0 ) == 0x80 )
+    {
+        i--;
+    }
+    p = layout->text + i;
+    LCD_DecodeUTF8( &p );
+    return ( p == layout->text + end ) ? i : end - 1;
+}
+
+/**
+ * Returns the last character of a line, 0 if it is empty.
+ */
+static uint16_t LCD_LastChar( const LCD_Layout *layout, const LCD_Line *line )
+{
+    const uint8_t *p;
+
+    if ( line->length == 0 ) return 0;
+    p = layout->text + LCD_LastCharStart( layout, line );
+    return LCD_NextChar( &p, layout->utf8 );
+}
+
+/**
+ * Returns the width of the "..." that ends a line shortened by
+ * LCD_LAYOUT_ELLIPSIS, kerned after the last character of the line.
+ */
+static uint16_t LCD_DotsWidth( const LCD_Layout *layout, const LCD_Line *line )
+{
+    return ( LCD_Advance( layout->font, LCD_LastChar( layout, line ), '.' )
+            + 2 * LCD_Advance( layout->font, '.', '.' ) ) * layout->sizeX;
+}
+
+/**
+ * Drops the spaces at the end of a line.
+ *
+ * @return  The width of the line without them
+ */
+static uint16_t LCD_TrimLine( const LCD_Layout *layout, LCD_Line *line )
+{
+    uint16_t width = line->width;
+
+    while ( LCD_LastChar( layout, line ) == ' ' )
+    {
+        line->length--;
+        width -= LCD_Advance( layout->font, LCD_LastChar( layout, line ), ' ' )
+                * layout->sizeX;
+    }
+    return width;
+}
+
+/**
+ * Draws a cell of a text field in one address window: its background and
+ * the pixels of the glyph inside it, clipped to the display.
+ *
+ * @param   x       Left edge of the cell, the cursor x coordinate
+ * @param   w       Width of the cell in pixels
+ * @param   c       The character
+ */
+static void LCD_WriteCell( const LCD_TextField *field, int16_t x, uint16_t w,
+        uint8_t c )
+{
+    const GFXfont *font = field->font;
+    const GFXglyph *glyph = NULL;
+    LCD_GlyphReader rowStart;
+    LCD_GlyphReader reader;
+    int16_t x1 = ( x < 0 ) ? 0 : x;
+    int16_t x2 = ( x + w > LCD_width ) ? LCD_width : x + w;
+    int16_t y1 = ( field->top < 0 ) ? 0 : field->top;
+    int16_t y2 = field->top + field->height;
+    int16_t gx = 0;
+    int16_t gy = 0;
+    int16_t gw = 0;
+    int16_t gh = 0;
+    int16_t px;
+    int16_t py;
+    int16_t row;
+    int16_t col;
+    int16_t startRow = 0;
+    int16_t runEnd = 0;
+    uint16_t color;
+    uint8_t set = 0;
+    uint8_t n = 0;
+    uint8_t first = 1;
+
+    if ( y2 > LCD_height ) y2 = LCD_height;
+    if ( x1 >= x2 || y1 >= y2 ) return;
+
+    glyph = LCD_GetGlyph( font, c );
+    if ( glyph != NULL )
+    {
+        LCD_OpenGlyph( &rowStart, font, glyph );
+        gx = x + (int8_t) glyph->xOffset * field->sizeX;
+        gy = field->y + (int8_t) glyph->yOffset * field->sizeY;
+        gw = glyph->width * field->sizeX;
+        gh = glyph->height * field->sizeY;
+    }
+
+    LCD_SetAddrWindow( x1, y1, x2 - x1, y2 - y1 );
+    for ( py = y1; py < y2; py++ )
+    {
+        // Glyph row, -1 above or below the glyph
+        row = py - gy;
+        row = ( row >= 0 && row < gh ) ? row / field->sizeY : -1;
+        if ( row >= 0 )
+        {
+            LCD_SkipGlyphRows( &rowStart, row - startRow );
+            startRow = row;
+            reader = rowStart;
+            runEnd = 0;
+        }
+        for ( px = x1; px < x2; px++ )
+        {
+            color = field->bgcolor;
+            col = px - gx;
+            if ( row >= 0 && col >= 0 && col < gw )
+            {
+                col = ( field->sizeX > 1 ) ? col / field->sizeX : col;
+                while ( col >= runEnd )
+                {
+                    runEnd += LCD_ReadGlyphRun( &reader, &set );
+                }
+                if ( set )
+                    color = field->color;
+            }
+            LCD_fieldBuffer[n++] = color;
+            if ( n == LCD_FIELD_CHUNK )
+            {
+                if ( first ) LCD_WritePixels( LCD_fieldBuffer, n );
+                else LCD_ContinuePixels( LCD_fieldBuffer, n );
+                first = 0;
+                n = 0;
+            }
+        }
+    }
+    if ( n > 0 )
+    {
+        if ( first ) LCD_WritePixels( LCD_fieldBuffer, n );
+        else LCD_ContinuePixels( LCD_fieldBuffer, n );
+    }
+}
@@ -19,6 +19,7 @@
 /* USER CODE END Header */
 /* Includes ------------------------------------------------------------------*/
 #include "main.h"
+#include "dma.h"
 #include "fatfs.h"
 #include "i2c.h"
 #include "spi.h"
@@ -29,7 +30,10 @@
 /* USER CODE BEGIN Includes */
 #include "lcd.h"
 #include "ts.h"
-#include <stdio.h>
+#include "bench.h"
+#include "lcd_text.h"
+#include "console.h"
+#include "fmt.h"
 #include <string.h>
 
 //#include <stdarg.h> //for va_list var arg functions
@@ -43,6 +47,9 @@
 
 /* Private define ------------------------------------------------------------*/
 /* USER CODE BEGIN PD */
+//#define LCD_BENCHMARK     // Print LCD throughput benchmarks at start up
+//#define LCD_STATS_REPORT  // Print the LCD command traffic of each touch readout
+//#define LCD_CONSOLE       // Mirror printf output to a scrolling console on the display
 /* USER CODE END PD */
 
 /* Private macro -------------------------------------------------------------*/
@@ -109,6 +116,7 @@ int main(void)
 
   /* Initialize all configured peripherals */
   MX_GPIO_Init();
+  MX_DMA_Init();
   MX_USART2_UART_Init();
   MX_I2C1_Init();
   MX_SPI1_Init();
@@ -117,15 +125,27 @@ int main(void)
 
   HAL_Delay(1000);
 
-  printf("\r\n\r\nPOR\r\n");
-  printf("Build: " __DATE__ ", " __TIME__ "\r\n");
+  FMT_Printf("\r\n\r\nPOR\r\n");
+  FMT_Printf("Build: " __DATE__ ", " __TIME__ "\r\n");
 
   LCD_Init();
+#ifdef LCD_BENCHMARK
+  BENCH_Run();
+#endif
   LCD_FillScreen(LCD_WHITE);
   LCD_cursor_x = 0;
   LCD_cursor_y = 40;
-  LCD_textcolor = LCD_BLACK;
+  LCD_SetTextColor(LCD_BLACK);
   LCD_font = &FreeMono12pt7b;
+#ifdef LCD_CONSOLE
+  // printf output scrolls below a header line, the touch readout included
+  LCD_FillScreen(LCD_BLACK);
+  LCD_SetTextColor(LCD_WHITE);
+  LCD_cursor_y = LCD_font->yAdvance - 6;
+  LCD_DrawText((const uint8_t *) "Console");
+  CON_Open(LCD_font->yAdvance, 0, LCD_GREEN, LCD_BLACK);
+  FMT_Printf("Build: " __DATE__ ", " __TIME__ "\r\n");
+#endif
   //  LCD_Font = &FreeMono12pt7b;
 //  LCD_DrawText( (const uint8_t *)"Mono\n" );
 //  LCD_Font = &FreeSans12pt7b;
@@ -133,7 +153,10 @@ int main(void)
 //  LCD_Font = &FreeSerif12pt7b;
 //  LCD_DrawText( (const uint8_t *)"Serif\n" );
 
-  char text[64];
+  char readout[16] = "";
+  LCD_TextField field;
+  TS_Event touch;
+  uint8_t touched;
   //LCD_WriteFillRectPreclipped(10, 20, 30, 40, ILI9341_RED);
   //LCD_DrawHLine(41,60, 30, ILI9341_BLUE );
   //LCD_DrawVLine(40,61, 40, ILI9341_GREEN );
@@ -146,10 +169,26 @@ int main(void)
   /* Infinite loop */
   /* USER CODE BEGIN WHILE */
   flag = 0;
+#ifdef LCD_CONSOLE
+  while (1)
+  {
+      if (TS_GetEvent(&touch) && touch.touched)
+      {
+          for (uint8_t i = 0; i < touch.touched; i++)
+          {
+              FMT_Printf("#%d %3d,%3d ", touch.points[i].id, touch.points[i].x, touch.points[i].y);
+          }
+          FMT_Printf("\r\n");
+      }
+  }
+#endif
   uint8_t rot= 3;
   LCD_SetRotation(rot);
   TS_SetRotation(rot);
 
+  // The touch readout is a text field, so only the digits that change are repainted
+  LCD_InitTextField(&field, 0, 2 * LCD_font->yAdvance, LCD_BLACK, LCD_WHITE);
+
   while (1)
   {
       if (HAL_GPIO_ReadPin(USER_BTN_GPIO_Port, USER_BTN_Pin) != GPIO_PIN_SET)
@@ -160,20 +199,32 @@ int main(void)
           LCD_FillScreen(LCD_WHITE);
           LCD_cursor_x = 0;
           LCD_cursor_y = LCD_font->yAdvance;
-          sprintf(text, "Rotation %d", rot);
-          printf("%s\r\n", text);
-          LCD_DrawText( (uint8_t *) text);
+          // Formatted straight into the glyphs, without a buffer
+          LCD_Printf("Rotation %d", rot);
+          FMT_Printf("Rotation %d\r\n", rot);
+          LCD_InitTextField(&field, 0, 2 * LCD_font->yAdvance, LCD_BLACK, LCD_WHITE);
       }
 
-      TS_ReadData();
-      if (TS_isTouched)
+      // Touches are read by the TS_INT interrupt; show only the latest one queued
+      touched = 0;
+      while (TS_GetEvent(&touch))
       {
-          sprintf(text, "%3d,%3d", TS_touchX, TS_touchY);
-          printf("%s\r\n", text);
-          LCD_cursor_x = 0;
-          LCD_cursor_y = 2 * LCD_font->yAdvance;
-          LCD_DrawFillRect(LCD_cursor_x, LCD_cursor_y, 120,-LCD_font->yAdvance, LCD_WHITE);
-          LCD_DrawText( (uint8_t *) text);
+          touched = touch.touched;
+      }
+      if (touched)
+      {
+#ifdef LCD_STATS_REPORT
+          LCD_ResetStats();
+#endif
+          FMT_Format(readout, sizeof(readout), "%3d,%3d", touch.points[0].x, touch.points[0].y);
+          FMT_Printf("%s\r\n", readout);
+          LCD_SetTextField(&field, (uint8_t *) readout);
+#ifdef LCD_STATS_REPORT
+          FMT_Printf("LCD: %lu cmd bytes sent, %lu saved, %lu pixels\r\n",
+                  (unsigned long) LCD_stats.cmdBytes,
+                  (unsigned long) LCD_stats.cmdBytesSaved,
+                  (unsigned long) LCD_stats.pixels);
+#endif
       }
 
 #if 0
@@ -181,12 +232,12 @@ int main(void)
       TS_ReadData();
       if (TS_isTouched)
       {
-          printf("(%d,%d)\r\n", TS_touchX, TS_touchY);
+          FMT_Printf("(%d,%d)\r\n", TS_touchX, TS_touchY);
           flag = 0;
       }
       else if (flag == 0)
       {
-          printf("Not Touched\r\n");
+          FMT_Printf("Not Touched\r\n");
           flag = 1;
       }
 #endif
@@ -194,11 +245,11 @@ int main(void)
 #if 0
       if (HAL_GPIO_ReadPin(TS_INT_GPIO_Port, TS_INT_Pin))
       {
-          printf("*\r\n");
+          FMT_Printf("*\r\n");
       }
       else
       {
-          printf(".\r\n");
+          FMT_Printf(".\r\n");
       }
 #endif
 
@@ -259,6 +310,9 @@ int __io_putchar(int ch)
 {
     /* Write a character to the UART and block until transmitted */
     HAL_UART_Transmit(&UART_HANDLE, (uint8_t *)&ch, 1, HAL_MAX_DELAY);
+#ifdef LCD_CONSOLE
+    CON_PutChar(ch);
+#endif
     return ch;
 }
 
@@ -0,0 +1,464 @@
+/**
+ * @file    sprite.c
+ * @brief   Sprites: small images with a transparent color moved over a
+ *          background that is restored from its source
+ */
+/**
+ ******************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2021 John Vedder
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************
+ */
+
+#include "main.h"
+#include "lcd.h"
+#include "sprite.h"
+
+/*
+ * Sprite flags
+ */
+#define SPRITE_USED     0x01    // The slot is in use
+#define SPRITE_VISIBLE  0x02    // To be shown by the next SPRITE_Update()
+#define SPRITE_SHOWN    0x04    // On the display
+#define SPRITE_CHANGED  0x08    // Its pixels changed since it was drawn
+
+#define SPRITE_REGIONS  5       // Most areas repainted per sprite: its new one and 4 uncovered
+
+/**
+ * A sprite. (x,y) is where it is on the display, (newX,newY) where
+ * SPRITE_Update() moves it to.
+ */
+typedef struct
+{
+    const uint16_t *pixels; // RGB565 pixels in rows
+    int16_t x;
+    int16_t y;
+    int16_t newX;
+    int16_t newY;
+    uint16_t key;           // Transparent color
+    uint8_t w;              // Width in pixels
+    uint8_t h;              // Height in pixels
+    uint8_t flags;          // SPRITE_USED, SPRITE_VISIBLE, ...
+} SPRITE_Sprite;
+
+/*
+ * Private Variables
+ */
+static SPRITE_Sprite SPRITE_sprites[SPRITE_MAX];        // The sprites, bottom to top
+static uint16_t SPRITE_buffer[SPRITE_BUFFER_PIXELS];    // The compositing buffer
+static uint16_t SPRITE_color = LCD_BLACK;               // Solid background color
+static const SPRITE_TileMap *SPRITE_tiles;              // Tiled background
+static SPRITE_BackgroundFunc SPRITE_background;         // Background source, solid if not set
+
+/*
+ * Private Function Prototypes
+ */
+static uint8_t SPRITE_Uncovered( const LCD_Rect *o, const LCD_Rect *n,
+        LCD_Rect *rects );
+static void SPRITE_Paint( const LCD_Rect *area );
+static void SPRITE_Composite( int16_t x, int16_t y, uint16_t w, uint16_t h );
+static void SPRITE_ColorBackground( int16_t x, int16_t y, uint16_t w,
+        uint16_t *pixels );
+static void SPRITE_TileBackground( int16_t x, int16_t y, uint16_t w,
+        uint16_t *pixels );
+
+/*
+ *  -------------------
+ *  Public Functions
+ * -------------------
+ */
+
+/**
+ * Makes the background a solid color. The display is not repainted, see
+ * SPRITE_Repaint().
+ *
+ * @param   color   16-bit 5-6-5 Color of the background
+ */
+void SPRITE_SetBackgroundColor( uint16_t color )
+{
+    SPRITE_color = color;
+    SPRITE_background = SPRITE_ColorBackground;
+}
+
+/**
+ * Makes the background a tile map, repeated across the display from its
+ * top left corner. The map must remain valid while it is in use.
+ *
+ * @param   map     The tile map
+ */
+void SPRITE_SetBackgroundTiles( const SPRITE_TileMap *map )
+{
+    SPRITE_tiles = map;
+    SPRITE_background = SPRITE_TileBackground;
+}
+
+/**
+ * Makes the background whatever a function generates, for instance the
+ * rows of an image.
+ *
+ * @param   func    Generates a row of background pixels
+ */
+void SPRITE_SetBackgroundFunc( SPRITE_BackgroundFunc func )
+{
+    SPRITE_background = func;
+}
+
+/**
+ * Adds a sprite on top of the others. It is hidden at (0,0) until
+ * SPRITE_MoveTo() and SPRITE_Show() are called.
+ *
+ * @param   pixels  w x h RGB565 pixels in rows, must remain valid
+ * @param   w       Width in pixels
+ * @param   h       Height in pixels
+ * @param   key     Transparent color, pixels of this color are not drawn
+ * @return  The sprite number, or SPRITE_NONE if all are in use
+ */
+uint8_t SPRITE_Add( const uint16_t *pixels, uint8_t w, uint8_t h,
+        uint16_t key )
+{
+    SPRITE_Sprite *s;
+    uint8_t i;
+
+    for ( i = 0; i < SPRITE_MAX; i++ )
+    {
+        s = &SPRITE_sprites[i];
+        if ( s->flags == 0 )
+        {
+            s->pixels = pixels;
+            s->x = s->newX = 0;
+            s->y = s->newY = 0;
+            s->key = key;
+            s->w = w;
+            s->h = h;
+            s->flags = SPRITE_USED;
+            return i;
+        }
+    }
+    return SPRITE_NONE;
+}
+
+/**
+ * Removes a sprite. Where it was is repainted by the next SPRITE_Update().
+ */
+void SPRITE_Remove( uint8_t sprite )
+{
+    if ( sprite >= SPRITE_MAX ) return;
+    // The slot is free once nothing of it is shown
+    SPRITE_sprites[sprite].flags &= SPRITE_SHOWN;
+}
+
+/**
+ * Changes the pixels of a sprite, for instance to the next frame of an
+ * animation. It is redrawn by the next SPRITE_Update().
+ *
+ * @param   pixels  w x h RGB565 pixels in rows, must remain valid
+ */
+void SPRITE_SetPixels( uint8_t sprite, const uint16_t *pixels )
+{
+    if ( sprite >= SPRITE_MAX ) return;
+    SPRITE_sprites[sprite].pixels = pixels;
+    SPRITE_sprites[sprite].flags |= SPRITE_CHANGED;
+}
+
+/**
+ * Moves a sprite, the display is updated by the next SPRITE_Update().
+ *
+ * @param   x       New top left corner x coordinate
+ * @param   y       New top left corner y coordinate
+ */
+void SPRITE_MoveTo( uint8_t sprite, int16_t x, int16_t y )
+{
+    if ( sprite >= SPRITE_MAX ) return;
+    SPRITE_sprites[sprite].newX = x;
+    SPRITE_sprites[sprite].newY = y;
+}
+
+/**
+ * Shows or hides a sprite, the display is updated by the next
+ * SPRITE_Update().
+ */
+void SPRITE_Show( uint8_t sprite, uint8_t visible )
+{
+    if ( sprite >= SPRITE_MAX ) return;
+    if ( visible && ( SPRITE_sprites[sprite].flags & SPRITE_USED ) )
+        SPRITE_sprites[sprite].flags |= SPRITE_VISIBLE;
+    else
+        SPRITE_sprites[sprite].flags &= ~SPRITE_VISIBLE;
+}
+
+/**
+ * Brings the display up to date with the sprites that were moved, shown,
+ * hidden, removed or changed. For each one its new area is repainted, and
+ * of its old area only what it no longer covers, at most 4 rectangles.
+ * All of the areas are repainted with every sprite at its new position, in
+ * one transaction.
+ */
+void SPRITE_Update( void )
+{
+    LCD_Rect areas[SPRITE_MAX * SPRITE_REGIONS];
+    LCD_Rect o;
+    LCD_Rect n;
+    SPRITE_Sprite *s;
+    uint8_t count = 0;
+    uint8_t shown;
+    uint8_t visible;
+    uint8_t i;
+
+    for ( i = 0; i < SPRITE_MAX; i++ )
+    {
+        s = &SPRITE_sprites[i];
+        shown = s->flags & SPRITE_SHOWN;
+        visible = s->flags & SPRITE_VISIBLE;
+        if ( !shown && !visible ) continue;
+        if ( shown && visible && !( s->flags & SPRITE_CHANGED )
+                && ( s->x == s->newX ) && ( s->y == s->newY ) ) continue;
+
+        o.x = s->x;
+        o.y = s->y;
+        n.x = s->newX;
+        n.y = s->newY;
+        o.w = n.w = s->w;
+        o.h = n.h = s->h;
+        if ( visible )
+        {
+            areas[count++] = n;
+            if ( shown ) count += SPRITE_Uncovered( &o, &n, &areas[count] );
+            s->flags |= SPRITE_SHOWN;
+        }
+        else
+        {
+            areas[count++] = o;
+            s->flags &= ~SPRITE_SHOWN;
+        }
+        s->x = s->newX;
+        s->y = s->newY;
+        s->flags &= ~SPRITE_CHANGED;
+    }
+
+    LCD_StartWrite( );
+    for ( i = 0; i < count; i++ )
+    {
+        SPRITE_Paint( &areas[i] );
+    }
+    LCD_EndWrite( );
+}
+
+/**
+ * Repaints an area of the display from the background and the sprites, for
+ * instance to draw the background in the first place.
+ *
+ * @param   x       Top left corner x coordinate
+ * @param   y       Top left corner y coordinate
+ * @param   w       Width in pixels
+ * @param   h       Height in pixels
+ */
+void SPRITE_Repaint( int16_t x, int16_t y, int16_t w, int16_t h )
+{
+    LCD_Rect area = { x, y, w, h };
+
+    SPRITE_Paint( &area );
+}
+
+/**
+ * -------------------
+ *  Private Functions
+ * -------------------
+ */
+
+/**
+ * Splits the part of rectangle 'o' outside of rectangle 'n', of the same
+ * size, into rectangles: the rows above and below 'n', then left and right
+ * of it.
+ *
+ * @param   rects   Returns the rectangles, up to 4
+ * @return  The number of rectangles
+ */
+static uint8_t SPRITE_Uncovered( const LCD_Rect *o, const LCD_Rect *n,
+        LCD_Rect *rects )
+{
+    int16_t top = ( o->y > n->y ) ? o->y : n->y;
+    int16_t bottom = ( o->y + o->h < n->y + n->h ) ? o->y + o->h : n->y + n->h;
+    uint8_t count = 0;
+
+    if ( top >= bottom )
+    {
+        // They do not share a row
+        rects[0] = *o;
+        return 1;
+    }
+
+    if ( o->y < top )
+    {
+        rects[count].x = o->x;
+        rects[count].y = o->y;
+        rects[count].w = o->w;
+        rects[count++].h = top - o->y;
+    }
+    if ( o->y + o->h > bottom )
+    {
+        rects[count].x = o->x;
+        rects[count].y = bottom;
+        rects[count].w = o->w;
+        rects[count++].h = o->y + o->h - bottom;
+    }
+    if ( o->x < n->x )
+    {
+        rects[count].x = o->x;
+        rects[count].y = top;
+        rects[count].w = ( ( n->x < o->x + o->w ) ? n->x : o->x + o->w ) - o->x;
+        rects[count++].h = bottom - top;
+    }
+    if ( o->x + o->w > n->x + n->w )
+    {
+        rects[count].x = ( n->x + n->w > o->x ) ? n->x + n->w : o->x;
+        rects[count].y = top;
+        rects[count].w = o->x + o->w - rects[count].x;
+        rects[count++].h = bottom - top;
+    }
+    return count;
+}
+
+/**
+ * Repaints an area, clipped to the display, through one address window
+ * per strip of SPRITE_BUFFER_PIXELS columns. Each strip is composited as
+ * many rows at a time as fit in the buffer.
+ */
+static void SPRITE_Paint( const LCD_Rect *area )
+{
+    int16_t x = area->x;
+    int16_t y = area->y;
+    int16_t x2 = area->x + area->w;
+    int16_t y2 = area->y + area->h;
+    int16_t rows;
+    int16_t row;
+    uint16_t w;
+    uint16_t h;
+
+    if ( x < 0 ) x = 0;
+    if ( y < 0 ) y = 0;
+    if ( x2 > LCD_width ) x2 = LCD_width;
+    if ( y2 > LCD_height ) y2 = LCD_height;
+    if ( x >= x2 || y >= y2 ) return;
+    if ( !SPRITE_background ) SPRITE_background = SPRITE_ColorBackground;
+
+    LCD_StartWrite( );
+    for ( ; x < x2; x += w )
+    {
+        w = ( x2 - x > SPRITE_BUFFER_PIXELS ) ? SPRITE_BUFFER_PIXELS : x2 - x;
+        rows = SPRITE_BUFFER_PIXELS / w;
+
+        LCD_SetAddrWindow( x, y, w, y2 - y );
+        for ( row = y; row < y2; row += h )
+        {
+            h = ( y2 - row > rows ) ? rows : y2 - row;
+            SPRITE_Composite( x, row, w, h );
+            if ( row == y ) LCD_WritePixels( SPRITE_buffer, (uint32_t) w * h );
+            else LCD_ContinuePixels( SPRITE_buffer, (uint32_t) w * h );
+        }
+    }
+    LCD_EndWrite( );
+}
+
+/**
+ * Composites an area in the buffer: the background, then the shown sprites
+ * bottom to top, leaving out their transparent pixels.
+ */
+static void SPRITE_Composite( int16_t x, int16_t y, uint16_t w, uint16_t h )
+{
+    const SPRITE_Sprite *s;
+    const uint16_t *src;
+    uint16_t *dst;
+    int16_t x1;
+    int16_t x2;
+    int16_t y1;
+    int16_t y2;
+    int16_t i;
+    uint16_t row;
+    uint8_t n;
+
+    for ( row = 0; row < h; row++ )
+    {
+        SPRITE_background( x, y + row, w, &SPRITE_buffer[row * w] );
+    }
+
+    for ( n = 0; n < SPRITE_MAX; n++ )
+    {
+        s = &SPRITE_sprites[n];
+        if ( !( s->flags & SPRITE_SHOWN ) ) continue;
+
+        x1 = ( s->x > x ) ? s->x : x;
+        x2 = ( s->x + s->w < x + w ) ? s->x + s->w : x + w;
+        y1 = ( s->y > y ) ? s->y : y;
+        y2 = ( s->y + s->h < y + h ) ? s->y + s->h : y + h;
+        for ( ; y1 < y2; y1++ )
+        {
+            src = s->pixels + ( y1 - s->y ) * s->w + ( x1 - s->x );
+            dst = &SPRITE_buffer[( y1 - y ) * w + ( x1 - x )];
+            for ( i = x1; i < x2; i++, src++, dst++ )
+            {
+                if ( *src != s->key ) *dst = *src;
+            }
+        }
+    }
+}
+
+/**
+ * Background of SPRITE_SetBackgroundColor()
+ */
+static void SPRITE_ColorBackground( int16_t x, int16_t y, uint16_t w,
+        uint16_t *pixels )
+{
+    while ( w-- > 0 )
+    {
+        *pixels++ = SPRITE_color;
+    }
+}
+
+/**
+ * Background of SPRITE_SetBackgroundTiles()
+ */
+static void SPRITE_TileBackground( int16_t x, int16_t y, uint16_t w,
+        uint16_t *pixels )
+{
+    const SPRITE_TileMap *map = SPRITE_tiles;
+    const uint8_t *cells;
+    const uint16_t *src;
+    uint16_t tileSize = map->tileW * map->tileH;
+    uint16_t my = y % ( map->rows * map->tileH );
+    uint16_t mx = x % ( map->cols * map->tileW );
+    uint16_t ty = my % map->tileH;
+    uint8_t col = mx / map->tileW;
+    uint8_t tx = mx % map->tileW;
+
+    cells = map->map + ( my / map->tileH ) * map->cols;
+    src = map->tiles + cells[col] * tileSize + ty * map->tileW + tx;
+    while ( w-- > 0 )
+    {
+        *pixels++ = *src++;
+        if ( ++tx == map->tileW )
+        {
+            tx = 0;
+            if ( ++col == map->cols ) col = 0;
+            src = map->tiles + cells[col] * tileSize + ty * map->tileW;
+        }
+    }
+}
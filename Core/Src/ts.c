@@ -34,7 +34,7 @@
 #include "main.h"
 #include "i2c.h"
 #include "ts.h"
-#include <stdio.h>
+#include "fmt.h"
 #include <string.h>
 
 #define TS_DEBUG
@@ -50,16 +50,48 @@ uint8_t TS_isTouched;    // non-zero if touch screen is being touched
 uint16_t TS_touchX;  // x coordinate of current touch after accounting for current rotation
 uint16_t TS_touchY;  // y coordinate of current touch after accounting for current rotation
 
+TS_Event TS_touch;              // latest report, all of its points
+volatile uint8_t TS_dropped;    // events lost to a full queue
+
 /*
  * Private Variables
  */
 static uint8_t i2cdata[16];
 
+/*
+ * The interrupt is the only writer of TS_queueHead and TS_GetEvent() the only
+ * writer of TS_queueTail, so the queue needs no locking. Both indexes are
+ * single bytes, which the Cortex-M0 reads and writes atomically, and they
+ * run freely, wrapping at 256, a multiple of TS_QUEUE_SIZE.
+ */
+static TS_Event TS_queue[TS_QUEUE_SIZE];
+static volatile uint8_t TS_queueHead;   // next event to write
+static volatile uint8_t TS_queueTail;   // next event to read
+
+/*
+ * The interrupt-driven read is two sequential transfers, so that no HAL call
+ * polls the bus from an interrupt: the register address is written, then the
+ * report is read after a repeated start. HAL_I2C_Mem_Read_IT() would instead
+ * busy-wait for the address phase against HAL_GetTick().
+ */
+#define TS_READ_IDLE        (0)     // No read in progress
+#define TS_READ_ADDRESS     (1)     // Writing the register address
+#define TS_READ_DATA        (2)     // Reading the report
+
+static uint8_t TS_itRegister = FT6206_REG_MODE; // first register of the report
+static uint8_t TS_itData[TS_DATA_SIZE]; // filled by the interrupt-driven read
+static volatile uint8_t TS_itEnabled;   // non-zero once TS_Init() has configured the chip
+static volatile uint8_t TS_itBusy;      // TS_READ_ADDRESS or TS_READ_DATA during a read
+static volatile uint8_t TS_itPending;   // INT fell again during the read
+
 /*
  * Private Function Prototypes
  */
 static uint8_t TS_ReadRegister8( uint8_t reg );
 static void TS_WriteRegister8( uint8_t reg, uint8_t val );
+static void TS_Decode( const uint8_t *data, TS_Event *event );
+static void TS_DecodePoint( const uint8_t *data, TS_Point *point );
+static void TS_StartRead( void );
 
 /*
  *  -------------------
@@ -78,18 +110,19 @@ static void TS_WriteRegister8( uint8_t reg, uint8_t val );
  */
 int8_t TS_Init( uint8_t thresh )
 {
+    TS_itEnabled = 0;
 
 #ifdef TS_DEBUG
-    printf( "TS_DEBUG\r\n" );
-    printf( "  Vend ID:       0x%02X\r\n",
+    FMT_Printf( "TS_DEBUG\r\n" );
+    FMT_Printf( "  Vend ID:       0x%02X\r\n",
             TS_ReadRegister8( FT6206_REG_VENDID ) );
-    printf( "  Chip ID:       0x%02X\r\n",
+    FMT_Printf( "  Chip ID:       0x%02X\r\n",
             TS_ReadRegister8( FT6206_REG_CHIPID ) );
-    printf( "  Firm V:        0x%02X\r\n",
+    FMT_Printf( "  Firm V:        0x%02X\r\n",
             TS_ReadRegister8( FT6206_REG_FIRMVERS ) );
-    printf( "  Point Rate Hz: 0x%02X\r\n",
+    FMT_Printf( "  Point Rate Hz: 0x%02X\r\n",
             TS_ReadRegister8( FT6206_REG_POINTRATE ) );
-    printf( "  THRESH:        0x%02X\r\n",
+    FMT_Printf( "  THRESH:        0x%02X\r\n",
             TS_ReadRegister8( FT6206_REG_THRESHHOLD ) );
 #endif
 
@@ -102,51 +135,74 @@ int8_t TS_Init( uint8_t thresh )
         return 1;  // failure
     }
 
+    // pulse INT for each new report, rather than holding it low while touched
+    TS_WriteRegister8( FT6206_REG_GMODE, FT6206_VAL_TRIGGERMODE );
+
     TS_isTouched = 0;
     TS_touchX = 0;
     TS_touchY = 0;
+    TS_touch.touched = 0;
     TS_SetRotation( 0 );
 
+    TS_queueHead = TS_queueTail;
+    TS_dropped = 0;
+    TS_itEnabled = 1;
+
     return 0;  // OK
 }
 
 /**
  * Reads the bulk of data from cap touch chip. Fills in FT6206_touched,
  * FT6206_touchX, and FT6206_touchY with results. The X and Y coordinates are adjusted
- * per the current setting of TS_rotation.
+ * per the current setting of TS_rotation. Both points are read in the same
+ * burst and left in TS_touch.
+ *
+ * This blocks on the I2C bus and is the polled alternative to TS_GetEvent().
+ * It fails, leaving the results unchanged, when it finds the bus busy with
+ * a read started by the interrupt.
  */
 void TS_ReadData( void )
 {
-    // Read: 1 address byte, 7 data bytes, 1000mSec timeout
-    HAL_I2C_Mem_Read( &FT6206_I2C_HANDLE, FT6206_ADDR, 0x00, 1, i2cdata, 7,
-            1000 );
-
-    TS_isTouched = ( i2cdata[0x02] & 0x0F ) ? 1 : 0;
-    uint16_t x = ( ( i2cdata[0x03] & 0x0F ) << 8 ) + ( i2cdata[0x04] );
-    uint16_t y = ( ( i2cdata[0x05] & 0x0F ) << 8 ) + ( i2cdata[0x06] );
-
-    switch ( TS_rotation )
+    // Read: 1 address byte, 15 data bytes, 1000mSec timeout
+    if ( HAL_I2C_Mem_Read( &FT6206_I2C_HANDLE, FT6206_ADDR, 0x00, 1, i2cdata,
+            TS_DATA_SIZE, 1000 ) != HAL_OK )
     {
-        case 0:
-            // Noon
-            TS_touchX = TS_WIDTH - x;
-            TS_touchY = TS_HEIGHT - y;
-            break;
-        case 1:
-            // 3 o'clock
-            TS_touchX = TS_HEIGHT - y;
-            TS_touchY = x;
-            break;
-        case 2:
-            // 6 o'clock
-            TS_touchX = x;
-            TS_touchY = y;
-            break;
-        case 3:
-            TS_touchX = y;
-            TS_touchY = TS_WIDTH - x;
-            break;
+        return;
     }
+
+    TS_Decode( i2cdata, &TS_touch );
+    TS_isTouched = TS_touch.touched ? 1 : 0;
+    TS_touchX = TS_touch.points[0].x;
+    TS_touchY = TS_touch.points[0].y;
+}
+
+/**
+ * Takes the oldest touch report from the queue filled by the interrupt. The
+ * main loop spends no time on the I2C bus: each pulse of TS_INT starts a
+ * non-blocking read, and the interrupt that ends it decodes the report into
+ * the queue. TS_touch, TS_isTouched, TS_touchX and TS_touchY follow the
+ * events taken.
+ *
+ * @param   event  Filled in with the oldest report
+ *
+ * @return  Non-zero if an event was taken, zero if the queue was empty
+ */
+uint8_t TS_GetEvent( TS_Event *event )
+{
+    uint8_t tail = TS_queueTail;
+
+    if ( tail == TS_queueHead ) return 0;
+
+    __DMB( );   // read the event only after seeing the head that covers it
+    *event = TS_queue[tail & ( TS_QUEUE_SIZE - 1 )];
+    __DMB( );   // finish reading before the interrupt may reuse the slot
+    TS_queueTail = tail + 1;
+
+    TS_touch = *event;
+    TS_isTouched = event->touched ? 1 : 0;
+    TS_touchX = event->points[0].x;
+    TS_touchY = event->points[0].y;
+    return 1;
 }
 
 /**
@@ -172,12 +228,169 @@ void TS_SetRotation( uint8_t m )
     }
 }
 
+/**
+ * EXTI callback (interrupt context). A falling edge of TS_INT means the
+ * chip has a new report, so the read is started, or left pending if the
+ * last one has not finished.
+ */
+void HAL_GPIO_EXTI_Callback( uint16_t GPIO_Pin )
+{
+    if ( ( GPIO_Pin != TS_INT_Pin ) || !TS_itEnabled ) return;
+
+    if ( TS_itBusy )
+    {
+        TS_itPending = 1;
+    }
+    else
+    {
+        TS_StartRead( );
+    }
+}
+
+/**
+ * I2C master transmit complete callback (interrupt context). The register
+ * address has been written, so the report is read after a repeated start.
+ */
+void HAL_I2C_MasterTxCpltCallback( I2C_HandleTypeDef *hi2c )
+{
+    if ( ( hi2c != &FT6206_I2C_HANDLE ) || ( TS_itBusy != TS_READ_ADDRESS ) ) return;
+
+    TS_itBusy = TS_READ_DATA;
+    if ( HAL_I2C_Master_Seq_Receive_IT( &FT6206_I2C_HANDLE, FT6206_ADDR,
+            TS_itData, TS_DATA_SIZE, I2C_LAST_FRAME ) != HAL_OK )
+    {
+        TS_itBusy = TS_READ_IDLE;
+    }
+}
+
+/**
+ * I2C master receive complete callback (interrupt context). Queues the
+ * report, or drops it if the main loop has let the queue fill.
+ */
+void HAL_I2C_MasterRxCpltCallback( I2C_HandleTypeDef *hi2c )
+{
+    uint8_t head = TS_queueHead;
+
+    if ( ( hi2c != &FT6206_I2C_HANDLE ) || ( TS_itBusy != TS_READ_DATA ) ) return;
+
+    if ( (uint8_t) ( head - TS_queueTail ) < TS_QUEUE_SIZE )
+    {
+        TS_Decode( TS_itData, &TS_queue[head & ( TS_QUEUE_SIZE - 1 )] );
+        __DMB( );   // write the event before publishing it
+        TS_queueHead = head + 1;
+    }
+    else
+    {
+        TS_dropped++;
+    }
+
+    TS_itBusy = TS_READ_IDLE;
+    if ( TS_itPending )
+    {
+        TS_StartRead( );
+    }
+}
+
+/**
+ * I2C error callback (interrupt context). Abandons the read; the next
+ * pulse of TS_INT tries again.
+ */
+void HAL_I2C_ErrorCallback( I2C_HandleTypeDef *hi2c )
+{
+    if ( ( hi2c != &FT6206_I2C_HANDLE ) || !TS_itBusy ) return;
+
+    TS_itBusy = TS_READ_IDLE;
+    if ( TS_itPending )
+    {
+        TS_StartRead( );
+    }
+}
+
 /**
  * -------------------
  *  Private Functions
  * -------------------
  */
 
+/**
+ * Decodes the touch registers into an event, both points of it.
+ *
+ * @param   data   The registers read from address 0
+ * @param   event  Filled in with the report
+ */
+static void TS_Decode( const uint8_t *data, TS_Event *event )
+{
+    uint8_t i;
+
+    // the chip reports 0x0F, not a count, before its first scan
+    event->touched = data[FT6206_REG_STATUS] & 0x0F;
+    if ( event->touched > TS_MAX_POINTS )
+    {
+        event->touched = 0;
+    }
+    for ( i = 0; i < TS_MAX_POINTS; i++ )
+    {
+        TS_DecodePoint( data + i * FT6206_POINT_STRIDE, &event->points[i] );
+    }
+}
+
+/**
+ * Decodes the registers of one touch point, adjusting the X and Y
+ * coordinates per the current setting of TS_rotation.
+ *
+ * @param   data   The registers of the point, offset so that its X high
+ *                 bits are at FT6206_REG_X_HI
+ * @param   point  Filled in with the point
+ */
+static void TS_DecodePoint( const uint8_t *data, TS_Point *point )
+{
+    uint16_t x = ( ( data[FT6206_REG_X_HI] & 0x0F ) << 8 ) + ( data[FT6206_REG_X_LO] );
+    uint16_t y = ( ( data[FT6206_REG_Y_HI] & 0x0F ) << 8 ) + ( data[FT6206_REG_Y_LO] );
+
+    point->event = data[FT6206_REG_X_HI] >> 6;
+    point->id = data[FT6206_REG_Y_HI] >> 4;
+    point->weight = data[FT6206_REG_WEIGHT];
+    point->area = data[FT6206_REG_MISC] >> 4;
+    switch ( TS_rotation )
+    {
+        case 0:
+            // Noon
+            point->x = TS_WIDTH - x;
+            point->y = TS_HEIGHT - y;
+            break;
+        case 1:
+            // 3 o'clock
+            point->x = TS_HEIGHT - y;
+            point->y = x;
+            break;
+        case 2:
+            // 6 o'clock
+            point->x = x;
+            point->y = y;
+            break;
+        case 3:
+            point->x = y;
+            point->y = TS_WIDTH - x;
+            break;
+    }
+}
+
+/**
+ * Starts the non-blocking read of a report (interrupt context) by writing
+ * the register address, without a stop. If the bus is taken by a blocking
+ * transfer the report is lost, and the next pulse of TS_INT tries again.
+ */
+static void TS_StartRead( void )
+{
+    TS_itPending = 0;
+    TS_itBusy = TS_READ_ADDRESS;
+    if ( HAL_I2C_Master_Seq_Transmit_IT( &FT6206_I2C_HANDLE, FT6206_ADDR,
+            &TS_itRegister, 1, I2C_FIRST_FRAME ) != HAL_OK )
+    {
+        TS_itBusy = TS_READ_IDLE;
+    }
+}
+
 static uint8_t TS_ReadRegister8( uint8_t reg )
 {
     uint8_t val;
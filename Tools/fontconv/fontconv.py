@@ -0,0 +1,329 @@
+#!/usr/bin/env python3
+"""
+fontconv.py - converts a TrueType (or any FreeType) font to the anti-aliased
+LCD_AAFont format of Core/Inc/lcd_aafont.h, or with --gfx to a 1-bit GFXfont
+(Core/Inc/lcd.h), written as a C header to include in one source file, like
+the GFX fonts.
+
+    fontconv.py [--bpp 1|2|4] [--first 0x20] [--last 0x7E] [--notice TEXT]
+                font.ttf 12 Name > Name.h
+    fontconv.py --gfx [--ranges 0x20-0x7E,0xA0-0xFF,0x20AC] [--kern]
+                font.ttf 12 Name
+
+The size is in points at 141 DPI, as the GFX fonts were converted, so 12 pt
+here matches the height of FreeSans12pt7b. Each glyph is rendered with
+FreeType's anti-aliasing, its coverage quantized to 'bpp' bits and its
+bounding box trimmed to the pixels that are not 0. GFX fonts are rendered
+without anti-aliasing and may have sparse ranges of Unicode characters, up
+to U+FFFF, drawn by LCD_DrawTextUTF8(). Tools/fontpack packs them.
+
+--kern adds the pair kerning of the font's 'kern' table (format 0, as most
+TrueType fonts have; kerning only in OpenType GPOS is not read), rounded to
+pixels, as an LCD_Kerning table of classes: characters kerned alike share a
+class, so the table holds a class per glyph and an adjustment per pair of
+classes rather than a list of pairs.
+
+Copyright (c) 2021 John Vedder, MIT License, see Core/Inc/lcd_aafont.h
+"""
+
+import argparse
+import os
+import struct
+import sys
+
+from PIL import Image, ImageDraw, ImageFont
+
+DPI = 141
+
+
+def render(font, ch, bpp, mono=False):
+    """
+    Returns the bounding box (x, y, w, h) of a glyph relative to the cursor
+    on the baseline, and its coverage levels in rows.
+    """
+    x0, y0, x1, y1 = font.getbbox(ch, anchor="ls")
+    if x1 <= x0 or y1 <= y0:
+        return (0, 0, 0, 0), []
+    img = Image.new("L", (x1 - x0, y1 - y0), 0)
+    draw = ImageDraw.Draw(img)
+    if mono:
+        draw.fontmode = "1"
+    draw.text((-x0, -y0), ch, font=font, fill=255, anchor="ls")
+    w, h = img.size
+    top = (1 << bpp) - 1
+    raw = img.tobytes()
+    levels = [(raw[i] * top + 127) // 255 for i in range(len(raw))]
+    rows = [levels[r * w:(r + 1) * w] for r in range(h)]
+
+    # Trim what quantized to nothing
+    while rows and not any(rows[0]):
+        rows.pop(0)
+        y0 += 1
+    while rows and not any(rows[-1]):
+        rows.pop()
+    if not rows:
+        return (0, 0, 0, 0), []
+    while not any(r[0] for r in rows):
+        rows = [r[1:] for r in rows]
+        x0 += 1
+    while not any(r[-1] for r in rows):
+        rows = [r[:-1] for r in rows]
+    return (x0, y0, len(rows[0]), len(rows)), rows
+
+
+def pack(levels, bpp):
+    """Packs coverage levels MSB first, padded to a whole byte."""
+    out = bytearray()
+    acc = 0
+    n = 0
+    for v in levels:
+        acc = (acc << bpp) | v
+        n += bpp
+        if n == 8:
+            out.append(acc)
+            acc = 0
+            n = 0
+    if n:
+        out.append(acc << (8 - n))
+    return out
+
+
+def sfnt_tables(data):
+    """Returns the (offset, length) of each table of a TrueType font."""
+    count = struct.unpack_from(">H", data, 4)[0]
+    tables = {}
+    for i in range(count):
+        tag, _, offset, length = struct.unpack_from(">4sIII", data, 12 + 16 * i)
+        tables[tag.decode("latin-1")] = (offset, length)
+    return tables
+
+
+def read_cmap(data, offset):
+    """Returns the glyph id of each character of a format 4 Unicode cmap."""
+    count = struct.unpack_from(">H", data, offset + 2)[0]
+    for i in range(count):
+        platform, encoding, sub = struct.unpack_from(">HHI", data, offset + 4 + 8 * i)
+        base = offset + sub
+        if (platform, encoding) not in ((3, 1), (0, 3)) \
+                or struct.unpack_from(">H", data, base)[0] != 4:
+            continue
+        segments = struct.unpack_from(">H", data, base + 6)[0] // 2
+        ends = struct.unpack_from(">%uH" % segments, data, base + 14)
+        pos = base + 16 + 2 * segments
+        starts = struct.unpack_from(">%uH" % segments, data, pos)
+        deltas = struct.unpack_from(">%uh" % segments, data, pos + 2 * segments)
+        pos += 4 * segments
+        cmap = {}
+        for k in range(segments):
+            range_offset = struct.unpack_from(">H", data, pos + 2 * k)[0]
+            for code in range(starts[k], min(ends[k], 0xFFFE) + 1):
+                if range_offset:
+                    at = pos + 2 * k + range_offset + 2 * (code - starts[k])
+                    gid = struct.unpack_from(">H", data, at)[0]
+                    gid = (gid + deltas[k]) & 0xFFFF if gid else 0
+                else:
+                    gid = (code + deltas[k]) & 0xFFFF
+                if gid:
+                    cmap[code] = gid
+        return cmap
+    sys.exit("fontconv: the font has no Unicode cmap")
+
+
+def read_kerning(path, codes, pixels):
+    """
+    Returns the kerning of the pairs of characters that have one, in pixels
+    at 'pixels' per em.
+    """
+    data = open(path, "rb").read()
+    tables = sfnt_tables(data)
+    if "kern" not in tables:
+        sys.exit("fontconv: %s has no kern table" % path)
+    units = struct.unpack_from(">H", data, tables["head"][0] + 18)[0]
+    cmap = read_cmap(data, tables["cmap"][0])
+
+    offset = tables["kern"][0]
+    version, count = struct.unpack_from(">HH", data, offset)
+    if version != 0:
+        sys.exit("fontconv: %s has an Apple kern table, not read" % path)
+    by_gid = {}
+    pos = offset + 4
+    for _ in range(count):
+        _, length, coverage = struct.unpack_from(">HHH", data, pos)
+        # Format 0, horizontal, not minimum or cross-stream values
+        if coverage >> 8 == 0 and coverage & 0x07 == 0x01:
+            pairs = struct.unpack_from(">H", data, pos + 6)[0]
+            for i in range(pairs):
+                left, right, value = struct.unpack_from(">HHh", data, pos + 14 + 6 * i)
+                by_gid[(left, right)] = by_gid.get((left, right), 0) + value
+        pos += length
+
+    kerning = {}
+    for a in codes:
+        for b in codes:
+            value = by_gid.get((cmap.get(a), cmap.get(b)), 0)
+            value = int(round(value * pixels / units))
+            if value:
+                if not -128 <= value <= 127:
+                    sys.exit("fontconv: kerning of 0x%02X 0x%02X is too large" % (a, b))
+                kerning[(a, b)] = value
+    return kerning
+
+
+def kern_classes(codes, kerning):
+    """
+    Returns the class of each character as the first and as the second of a
+    pair, and the adjustments of the pairs of classes, a row per left class.
+    Characters kerned alike share a class, those never kerned are class 0.
+    """
+    def classify(lines):
+        classes = {}
+        numbers = [classes.setdefault(line, len(classes) + 1) if any(line) else 0
+                   for line in lines]
+        return numbers, list(classes)
+
+    left, rows = classify([tuple(kerning.get((a, b), 0) for b in codes)
+                           for a in codes])
+    right, _ = classify([tuple(kerning.get((a, b), 0) for a in codes)
+                         for b in codes])
+    firsts = [codes[right.index(n)] for n in range(1, max(right, default=0) + 1)]
+    if len(rows) > 255 or len(firsts) > 255:
+        sys.exit("fontconv: more than 255 kerning classes")
+    adjust = [row[codes.index(b)] for row in rows for b in firsts]
+    return left, right, adjust, len(firsts)
+
+
+def parse_ranges(text):
+    """Returns the ranges of "0x20-0x7E,0xB0" as (first, last) pairs."""
+    ranges = []
+    for part in text.split(","):
+        ends = [int(v, 0) for v in part.split("-")]
+        ranges.append((ends[0], ends[-1]))
+    return ranges
+
+
+def c_array(data, fmt, per_line):
+    lines = []
+    for i in range(0, len(data), per_line):
+        lines.append("    " + ", ".join(fmt % v for v in data[i:i + per_line]))
+    return ",\n".join(lines)
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Convert a font to an LCD_AAFont C header")
+    parser.add_argument("font")
+    parser.add_argument("size", type=float, help="size in points at 141 DPI")
+    parser.add_argument("name", help="C name of the LCD_AAFont")
+    parser.add_argument("--bpp", type=int, default=4, choices=(1, 2, 4),
+                        help="bits of coverage per pixel")
+    parser.add_argument("--first", type=lambda s: int(s, 0), default=0x20)
+    parser.add_argument("--last", type=lambda s: int(s, 0), default=0x7E)
+    parser.add_argument("--gfx", action="store_true",
+                        help="write a 1-bit GFXfont rather than an LCD_AAFont")
+    parser.add_argument("--ranges", type=parse_ranges,
+                        help="characters of a GFXfont, e.g. 0x20-0x7E,0xB0")
+    parser.add_argument("--kern", action="store_true",
+                        help="add the pair kerning of the font to a GFXfont")
+    parser.add_argument("--notice", default="",
+                        help="copyright and license of the font, for the header")
+    args = parser.parse_args()
+
+    ranges = args.ranges or [(args.first, args.last)]
+    limit = 0xFFFF if args.gfx else 0xFF
+    for i, (first, last) in enumerate(ranges):
+        if not 0 <= first <= last <= limit or (i and first <= ranges[i - 1][1]):
+            parser.error("the characters must be 0 to 0x%X, in order" % limit)
+    if len(ranges) > 1 and not args.gfx:
+        parser.error("--ranges needs --gfx, an LCD_AAFont has one range")
+    if args.kern and not args.gfx:
+        parser.error("--kern needs --gfx, an LCD_AAFont is not kerned")
+    bpp = 1 if args.gfx else args.bpp
+    pixels = round(args.size * DPI / 72)
+    font = ImageFont.truetype(args.font, pixels)
+    ascent, descent = font.getmetrics()
+
+    bitmap = bytearray()
+    glyphs = []
+    codes = [c for first, last in ranges for c in range(first, last + 1)]
+    for code in codes:
+        ch = chr(code)
+        (x, y, w, h), rows = render(font, ch, bpp, args.gfx)
+        advance = round(font.getlength(ch))
+        if w > 255 or h > 255 or advance > 255 or not -128 <= x <= 127 \
+                or not -128 <= y <= 127:
+            sys.exit("fontconv: glyph 0x%02X is too large" % code)
+        if len(bitmap) > 0xFFFF:
+            sys.exit("fontconv: more than 64 KB of glyphs")
+        glyphs.append((len(bitmap), w, h, advance, x, y, code))
+        bitmap.extend(pack([v for r in rows for v in r], bpp))
+
+    size = len(bitmap) + 7 * len(glyphs) + (7 if args.gfx else 12)
+    if len(ranges) > 1:
+        size += 6 * len(ranges)
+    if args.kern:
+        kerning = read_kerning(args.font, codes, pixels)
+        left, right, adjust, right_classes = kern_classes(codes, kerning)
+        size += len(left) + len(right) + len(adjust) + 13
+    print("// %s %g pt, %u-bit coverage, %s (generated by fontconv.py)"
+          % (os.path.basename(args.font), args.size, bpp,
+             ", ".join("0x%02X to 0x%02X" % r if r[0] < r[1] else "0x%02X" % r[0]
+                       for r in ranges)))
+    print("// " + (args.notice or "The font's own license applies to this data."))
+    print()
+    print("const uint8_t %sBitmaps[] = {" % args.name)
+    print(c_array(bitmap, "0x%02X", 12) + " };")
+    print()
+    print("const GFXglyph %sGlyphs[] = {" % args.name)
+    entries = []
+    for offset, w, h, advance, x, y, code in glyphs:
+        shown = chr(code) if 0x20 <= code < 0x7F and chr(code) not in "\\'" \
+            else "\\x%02X" % code if code <= 0xFF else "\\u%04X" % code
+        entries.append("    {%u, %u, %u, %u, %d, %d}, // 0x%02X '%s'"
+                       % (offset, w, h, advance, x, y, code, shown))
+    entries[-1] = entries[-1].replace("}, //", "}}; //", 1)
+    print("\n".join(entries))
+    print()
+    kern = "NULL"
+    if args.kern:
+        print("// %u pairs kerned, %u x %u classes"
+              % (len(kerning), len(adjust) // max(right_classes, 1), right_classes))
+        print("const uint8_t %sKernLeft[] = {" % args.name)
+        print(c_array(left, "%u", 16) + " };")
+        print("const uint8_t %sKernRight[] = {" % args.name)
+        print(c_array(right, "%u", 16) + " };")
+        print("const int8_t %sKernAdjust[] = {" % args.name)
+        print(c_array(adjust or [0], "%d", 16) + " };")
+        print()
+        print("const LCD_Kerning %sKerning = { %sKernLeft, %sKernRight, "
+              "%sKernAdjust, %u };"
+              % (args.name, args.name, args.name, args.name, right_classes))
+        print()
+        kern = "&%sKerning" % args.name
+    if not args.gfx:
+        print("const LCD_AAFont %s = { %sBitmaps, %sGlyphs, 0x%02X, 0x%02X, %u, %u };"
+              % (args.name, args.name, args.name, ranges[0][0], ranges[0][1],
+                 ascent + descent, bpp))
+    elif len(ranges) == 1:
+        print("const GFXfont %s = { (uint8_t *)%sBitmaps, (GFXglyph *)%sGlyphs, "
+              "0x%02X, 0x%02X, %u, 0, NULL, 0, %s };"
+              % (args.name, args.name, args.name, ranges[0][0], ranges[0][1],
+                 ascent + descent, kern))
+    else:
+        print("const LCD_GlyphRange %sRanges[] = {" % args.name)
+        index = 0
+        entries = []
+        for first, last in ranges:
+            entries.append("    {0x%02X, 0x%02X, %u}" % (first, last, index))
+            index += last - first + 1
+        print(",\n".join(entries) + " };")
+        print()
+        print("const GFXfont %s = { (uint8_t *)%sBitmaps, (GFXglyph *)%sGlyphs, "
+              "0x%02X, 0x%02X, %u, 0, %sRanges, %u, %s };"
+              % (args.name, args.name, args.name, ranges[0][0], ranges[-1][1],
+                 ascent + descent, args.name, len(ranges), kern))
+    print()
+    print("// Approx. %u bytes" % size)
+
+
+if __name__ == "__main__":
+    main()
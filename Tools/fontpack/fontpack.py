@@ -0,0 +1,393 @@
+#!/usr/bin/env python3
+"""
+fontpack.py - subsets a GFX font header (Core/Inc/Fonts) to the characters a
+project uses and packs its glyphs in the run-length encoding of
+Core/Inc/lcd.h (LCD_FONT_PACKED), written as a C header to include in one
+source file, like the GFX fonts.
+
+    fontpack.py [--chars TEXT] [--plain] FreeSans24pt7b.h Name
+                [--scan FILE ...] > Name.h
+
+The characters kept are those of --chars and of the string and character
+literals of the --scan files (e.g. Core/Src/*.c, read as UTF-8), or all of
+them if neither is given. The glyph table of a GFX font still runs from the
+first to the last character kept; the others in between keep their advance
+but lose their bitmap. A font with sparse ranges (LCD_GlyphRange) keeps
+only the glyphs of the characters kept, in as many ranges as it takes.
+--plain subsets only, for the fastest drawing. The kerning of a font
+(LCD_Kerning) is kept for the pairs of characters kept, in new classes.
+
+Each glyph is packed only if that makes it smaller, and decoded again and
+compared with the input before it is written. The flash saved is printed on
+stderr.
+
+Copyright (c) 2021 John Vedder, MIT License, see Core/Inc/lcd.h
+"""
+
+import argparse
+import os
+import re
+import sys
+
+LONG_RUN = 14       # LCD_GLYPH_LONG_RUN
+REPEAT = 15         # LCD_GLYPH_REPEAT
+MAX_REPEAT = 16     # Rows one repeat code stands for
+PLAIN = 0x8000      # LCD_GLYPH_PLAIN
+GLYPH_SIZE = 7      # Flash per glyph and per font, as the GFX headers count it
+RANGE_SIZE = 6      # Flash per LCD_GlyphRange
+KERNING_SIZE = 13   # Flash per LCD_Kerning
+
+ESCAPES = {"n": "\n", "t": "\t", "r": "\r", "a": "\a", "b": "\b",
+           "f": "\f", "v": "\v"}
+
+
+def notice(path):
+    """Returns the comments the header starts with, its copyright notice."""
+    lines = []
+    block = False
+    for line in open(path).read().splitlines():
+        if block or line.startswith("/*"):
+            block = "*/" not in line
+        elif not line.startswith("//"):
+            break
+        lines.append(line)
+    return lines
+
+
+def load(path):
+    """
+    Returns the bitmap, the glyphs by character, whether the font has
+    sparse ranges, yAdvance, and the kerning of the pairs of characters.
+    """
+    text = re.sub(r"/\*.*?\*/|//[^\n]*", " ", open(path).read(), flags=re.S)
+    data = re.search(r"Bitmaps\[\][^{]*\{(.*?)\};", text, re.S)
+    table = re.search(r"Glyphs\[\][^{]*\{(.*?)\};", text, re.S)
+    ranges = re.search(r"LCD_GlyphRange\s+\w+\[\][^{]*\{(.*?)\};", text, re.S)
+    font = re.search(r"GFXfont\s+\w+[^{]*\{[^,]*,[^,]*,\s*(\w+),\s*(\w+),\s*(\d+)",
+                     text)
+    kerning = re.search(r"LCD_Kerning\s+\w+[^{]*\{[^,]*,[^,]*,[^,]*,\s*(\d+)", text)
+    if not (data and table and font):
+        sys.exit("fontpack: %s is not a GFX font header" % path)
+    if re.search(r"LCD_FONT_PACKED", text):
+        sys.exit("fontpack: %s is packed already" % path)
+    bitmap = [int(v, 16) for v in re.findall(r"0x[0-9A-Fa-f]{2}\b", data.group(1))]
+    glyphs = [tuple(int(v) for v in g) for g in re.findall(
+        r"\{\s*(-?\d+),\s*(-?\d+),\s*(-?\d+),\s*(-?\d+),\s*(-?\d+),\s*(-?\d+)\s*\}",
+        table.group(1))]
+    if ranges:
+        spans = [tuple(int(v, 0) for v in r) for r in re.findall(
+            r"\{\s*(\w+),\s*(\w+),\s*(\w+)\s*\}", ranges.group(1))]
+    else:
+        spans = [(int(font.group(1), 0), int(font.group(2), 0), 0)]
+
+    by_code = {}
+    for first, last, index in spans:
+        # Glyphs past 'last' are conditionally compiled out, as in TomThumb.h
+        if index + last - first >= len(glyphs):
+            sys.exit("fontpack: %s has %u glyphs for 0x%02X to 0x%02X"
+                     % (path, len(glyphs), first, last))
+        for code in range(first, last + 1):
+            by_code[code] = glyphs[index + code - first]
+
+    pairs = {}
+    if kerning:
+        classes = []
+        for table in ("KernLeft", "KernRight", "KernAdjust"):
+            found = re.search(table + r"\[\][^{]*\{(.*?)\};", text, re.S)
+            classes.append([int(v) for v in re.findall(r"-?\d+", found.group(1))])
+        left, right, adjust = classes
+        right_classes = int(kerning.group(1))
+        codes = [code for first, last, _ in spans for code in range(first, last + 1)]
+        for a, l in zip(codes, left):
+            for b, r in zip(codes, right):
+                if l and r and adjust[(l - 1) * right_classes + r - 1]:
+                    pairs[(a, b)] = adjust[(l - 1) * right_classes + r - 1]
+    return bitmap, by_code, ranges is not None, int(font.group(3)), pairs
+
+
+def kern_classes(codes, kerning):
+    """
+    Returns the class of each character as the first and as the second of a
+    pair, and the adjustments of the pairs of classes, a row per left class,
+    as Tools/fontconv does.
+    """
+    def classify(lines):
+        classes = {}
+        numbers = [classes.setdefault(line, len(classes) + 1) if any(line) else 0
+                   for line in lines]
+        return numbers, list(classes)
+
+    left, rows = classify([tuple(kerning.get((a, b), 0) for b in codes)
+                           for a in codes])
+    right, _ = classify([tuple(kerning.get((a, b), 0) for a in codes)
+                         for b in codes])
+    firsts = [codes[right.index(n)] for n in range(1, max(right, default=0) + 1)]
+    adjust = [row[codes.index(b)] for row in rows for b in firsts]
+    return left, right, adjust, len(firsts)
+
+
+def unescape(literal):
+    """Returns the characters of the body of a C string or char literal."""
+    out = []
+    i = 0
+    while i < len(literal):
+        c = literal[i]
+        i += 1
+        if c != "\\" or i == len(literal):
+            out.append(c)
+            continue
+        c = literal[i]
+        i += 1
+        if c == "x":
+            m = re.match(r"[0-9A-Fa-f]+", literal[i:])
+            if m:
+                out.append(chr(int(m.group(0), 16) & 0xFF))
+                i += len(m.group(0))
+        elif c in "01234567":
+            m = re.match(r"[0-7]{1,3}", literal[i - 1:])
+            out.append(chr(int(m.group(0), 8) & 0xFF))
+            i += len(m.group(0)) - 1
+        else:
+            out.append(ESCAPES.get(c, c))
+    return out
+
+
+def scan(path):
+    """Returns the characters of the string and char literals of a C file."""
+    text = open(path, encoding="utf-8", errors="replace").read()
+    text = re.sub(r"/\*.*?\*/|//[^\n]*", " ", text, flags=re.S)
+    chars = set()
+    for m in re.finditer(r'"((?:[^"\\\n]|\\.)*)"|\'((?:[^\'\\\n]|\\.)+)\'', text):
+        chars.update(unescape(m.group(1) if m.group(1) is not None else m.group(2)))
+    return chars
+
+
+def glyph_bits(bitmap, glyph):
+    offset, w, h = glyph[0], glyph[1], glyph[2]
+    return [(bitmap[offset + (i >> 3)] >> (7 - (i & 7))) & 1 for i in range(w * h)]
+
+
+def pack_bits(bits):
+    """Packs bits MSB first, padded to a whole byte."""
+    out = bytearray((len(bits) + 7) // 8)
+    for i, b in enumerate(bits):
+        out[i >> 3] |= b << (7 - (i & 7))
+    return out
+
+
+def runs(row):
+    """Returns the alternating runs of a row, starting with clear pixels."""
+    out = []
+    value = 0
+    n = 0
+    for b in row:
+        if b != value:
+            out.append(n)
+            value = b
+            n = 0
+        n += 1
+    out.append(n)
+    return out
+
+
+def encode(bits, w, h):
+    """Returns the 4-bit codes of a glyph, see lcd.h."""
+    codes = []
+    previous = None
+    y = 0
+    while y < h:
+        row = bits[y * w:(y + 1) * w]
+        if row == previous:
+            n = 1
+            while (y + n < h and n < MAX_REPEAT
+                   and bits[(y + n) * w:(y + n + 1) * w] == previous):
+                n += 1
+            codes += [REPEAT, n - 1]
+            y += n
+            continue
+        for run in runs(row):
+            while run > LONG_RUN:
+                codes += [LONG_RUN, 0]
+                run -= LONG_RUN
+            codes.append(run)
+        previous = row
+        y += 1
+    out = bytearray((len(codes) + 1) // 2)
+    for i, c in enumerate(codes):
+        out[i >> 1] |= c << (0 if i & 1 else 4)
+    return out
+
+
+def decode(data, w, h):
+    """Decodes the codes as LCD_ReadGlyphRun() does, for checking."""
+    def code(pos):
+        return (data[pos >> 1] & 0x0F) if pos & 1 else (data[pos >> 1] >> 4)
+
+    out = []
+    pos = 0
+    row_pos = 0
+    resume = 0
+    repeat = 0
+    for _ in range(h):
+        if repeat == 0:
+            if resume:
+                pos = resume
+                resume = 0
+            if code(pos) == REPEAT:
+                repeat = code(pos + 1) + 1
+                resume = pos + 2
+            else:
+                row_pos = pos
+        if repeat:
+            repeat -= 1
+            pos = row_pos
+        col = 0
+        value = 0
+        while col < w:
+            run = 0
+            while True:
+                c = code(pos)
+                pos += 1
+                run += c
+                if c != LONG_RUN or col + run >= w or code(pos) != 0:
+                    break
+                pos += 1
+            out += [value] * run
+            col += run
+            value ^= 1
+    return out
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Subset and pack a GFX font C header")
+    parser.add_argument("font", help="GFX font header, e.g. Core/Inc/Fonts/FreeSans24pt7b.h")
+    parser.add_argument("name", help="C name of the GFXfont")
+    parser.add_argument("--chars", default="", help="characters to keep")
+    parser.add_argument("--scan", nargs="+", default=[], metavar="FILE",
+                        help="keep the characters of the literals of C files")
+    parser.add_argument("--plain", action="store_true",
+                        help="subset only, do not pack the glyphs")
+    args = parser.parse_args()
+
+    bitmap, glyphs, ranged, y_advance, kerning = load(args.font)
+    wanted = set(args.chars)
+    for path in args.scan:
+        wanted |= scan(path)
+    if wanted:
+        keep = sorted(ord(c) for c in wanted if ord(c) in glyphs)
+        if not keep:
+            sys.exit("fontpack: none of the characters are in the font")
+    else:
+        keep = sorted(glyphs)
+
+    # The characters of the glyph table, and its ranges if more than one
+    if ranged:
+        codes = keep
+    else:
+        codes = list(range(keep[0], keep[-1] + 1))
+    ranges = []
+    for i, code in enumerate(codes):
+        if ranges and ranges[-1][1] == code - 1:
+            ranges[-1][1] = code
+        else:
+            ranges.append([code, code, i])
+
+    data = bytearray()
+    table = []
+    packed = 0
+    for code in codes:
+        offset, w, h, advance, x, y = glyphs[code]
+        if code not in keep:
+            table.append((0, 0, 0, advance, 0, 0, code))
+            continue
+        bits = glyph_bits(bitmap, glyphs[code])
+        plain = pack_bits(bits)
+        rle = encode(bits, w, h) if not args.plain else None
+        if rle is not None and len(rle) < len(plain):
+            if decode(rle, w, h) != bits:
+                sys.exit("fontpack: internal error, glyph 0x%02X does not decode" % code)
+            table.append((len(data), w, h, advance, x, y, code))
+            data += rle
+            packed += 1
+        else:
+            flag = PLAIN if bits and not args.plain else 0
+            table.append((len(data) | flag, w, h, advance, x, y, code))
+            data += plain
+    if len(data) >= PLAIN:
+        sys.exit("fontpack: more than 32 KB of glyphs")
+
+    source = os.path.splitext(os.path.basename(args.font))[0]
+    used = max(g[0] + (g[1] * g[2] + 7) // 8 for g in glyphs.values())
+    before = used + GLYPH_SIZE * len(glyphs) + GLYPH_SIZE
+    size = len(data) + GLYPH_SIZE * len(table) + GLYPH_SIZE
+    if len(ranges) > 1:
+        size += RANGE_SIZE * len(ranges)
+    if kerning:
+        kerning = dict(((a, b), v) for (a, b), v in kerning.items()
+                       if a in keep and b in keep)
+        left, right, adjust, right_classes = kern_classes(codes, kerning)
+        size += len(left) + len(right) + len(adjust) + KERNING_SIZE
+        before += len(left) + len(right) + len(adjust) + KERNING_SIZE
+    for line in notice(args.font):
+        print(line)
+    print("// %s, %u of %u glyphs, %u packed (generated by fontpack.py)"
+          % (source, len(keep), len(glyphs), packed))
+    print()
+    print("const uint8_t %sBitmaps[] = {" % args.name)
+    print(",\n".join("    " + ", ".join("0x%02X" % v for v in data[i:i + 12])
+                     for i in range(0, len(data), 12)) + " };")
+    print()
+    print("const GFXglyph %sGlyphs[] = {" % args.name)
+    entries = []
+    for offset, w, h, advance, x, y, code in table:
+        shown = chr(code) if 0x20 <= code < 0x7F and chr(code) not in "\\'" \
+            else "\\x%02X" % code if code <= 0xFF else "\\u%04X" % code
+        where = "LCD_GLYPH_PLAIN | %u" % (offset & ~PLAIN) if offset & PLAIN \
+            else "%u" % offset
+        entries.append("    {%s, %u, %u, %u, %d, %d}, // 0x%02X '%s'"
+                       % (where, w, h, advance, x, y, code, shown))
+    entries[-1] = entries[-1].replace("}, //", "}}; //", 1)
+    print("\n".join(entries))
+    print()
+    flags = "0" if args.plain else "LCD_FONT_PACKED"
+    kern = "NULL"
+    if kerning:
+        print("// %u pairs kerned, %u x %u classes"
+              % (len(kerning), len(adjust) // max(right_classes, 1), right_classes))
+        for table, values in (("uint8_t %sKernLeft", left),
+                              ("uint8_t %sKernRight", right),
+                              ("int8_t %sKernAdjust", adjust or [0])):
+            print(("const " + table + "[] = {") % args.name)
+            print(",\n".join("    " + ", ".join("%d" % v for v in values[i:i + 16])
+                             for i in range(0, len(values), 16)) + " };")
+        print()
+        print("const LCD_Kerning %sKerning = { %sKernLeft, %sKernRight, "
+              "%sKernAdjust, %u };"
+              % (args.name, args.name, args.name, args.name, right_classes))
+        print()
+        kern = "&%sKerning" % args.name
+    if len(ranges) > 1:
+        print("const LCD_GlyphRange %sRanges[] = {" % args.name)
+        print(",\n".join("    {0x%02X, 0x%02X, %u}" % tuple(r) for r in ranges) + " };")
+        print()
+        print("const GFXfont %s = { (uint8_t *)%sBitmaps, (GFXglyph *)%sGlyphs, "
+              "0x%02X, 0x%02X, %u, %s, %sRanges, %u, %s };"
+              % (args.name, args.name, args.name, codes[0], codes[-1], y_advance,
+                 flags, args.name, len(ranges), kern))
+    else:
+        print("const GFXfont %s = { (uint8_t *)%sBitmaps, (GFXglyph *)%sGlyphs, "
+              "0x%02X, 0x%02X, %u, %s, NULL, 0, %s };"
+              % (args.name, args.name, args.name, codes[0], codes[-1], y_advance,
+                 flags, kern))
+    print()
+    print("// Approx. %u bytes" % size)
+
+    sys.stderr.write("%s: %u -> %u bytes of glyphs, %u -> %u bytes in all, "
+                     "%u saved (%.0f%%)\n"
+                     % (source, used, len(data), before, size,
+                        before - size, 100.0 * (before - size) / before))
+
+
+if __name__ == "__main__":
+    main()
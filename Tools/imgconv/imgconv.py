@@ -0,0 +1,199 @@
+#!/usr/bin/env python3
+"""
+imgconv.py - converts an image (PNG, or anything Pillow reads) to the
+run-length encoded LCD_Image format of Core/Inc/lcd_bitmap.h, written as a C
+header to include in one source file, like the GFX fonts.
+
+    imgconv.py [--colors N] [--background RRGGBB] image.png Name > Name.h
+
+The colors are reduced to RGB565 and, if there are more than N (at most and
+by default 256), quantized to N. Literal indexes take the fewest bits (1, 2,
+4 or 8) that hold the palette. The output is decoded again and compared with
+the input before it is written.
+
+Copyright (c) 2021 John Vedder, MIT License, see Core/Inc/lcd_bitmap.h
+"""
+
+import argparse
+import os
+import sys
+
+from PIL import Image
+
+RUN = 0x80          # Control byte of a run
+LONG_RUN = 0x40     # Run length has a second byte
+MAX_LITERAL = 128
+MAX_SHORT_RUN = 64
+MAX_RUN = 16384
+
+
+def rgb565(r, g, b):
+    return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3)
+
+
+def rgb565_pixels(img):
+    raw = img.tobytes()
+    return [rgb565(raw[i], raw[i + 1], raw[i + 2]) for i in range(0, len(raw), 3)]
+
+
+def load(path, colors, background):
+    """Returns the size, the RGB565 palette and the indexes of an image."""
+    img = Image.open(path)
+    if img.mode in ("RGBA", "LA", "P"):
+        img = img.convert("RGBA")
+        under = Image.new("RGBA", img.size, background + (255,))
+        img = Image.alpha_composite(under, img)
+    img = img.convert("RGB")
+
+    # Reduce to RGB565 first, quantize only if that is still too many colors
+    pixels = rgb565_pixels(img)
+    if len(set(pixels)) > colors:
+        img = img.quantize(colors).convert("RGB")
+        pixels = rgb565_pixels(img)
+
+    # Most frequent colors first, any order decodes the same
+    counts = {}
+    for p in pixels:
+        counts[p] = counts.get(p, 0) + 1
+    palette = sorted(counts, key=lambda c: -counts[c])
+    index = {c: i for i, c in enumerate(palette)}
+    return img.size, palette, [index[p] for p in pixels]
+
+
+def bits_for(colors):
+    for bpp in (1, 2, 4, 8):
+        if colors <= 1 << bpp:
+            return bpp
+    raise ValueError("more than 256 colors")
+
+
+def pack(indexes, bpp):
+    """Packs indexes MSB first, padded to a whole byte."""
+    out = bytearray()
+    acc = 0
+    n = 0
+    for i in indexes:
+        acc = (acc << bpp) | i
+        n += bpp
+        if n == 8:
+            out.append(acc)
+            acc = 0
+            n = 0
+    if n:
+        out.append(acc << (8 - n))
+    return out
+
+
+def encode(indexes, bpp):
+    """
+    Greedy encoding: a run is used when it is shorter than the literal it
+    replaces, 16 / bpp + 1 pixels or more, literal pixels are gathered
+    until the next such run.
+    """
+    threshold = 16 // bpp + 1
+    out = bytearray()
+    literal = []
+
+    def flush():
+        for i in range(0, len(literal), MAX_LITERAL):
+            chunk = literal[i:i + MAX_LITERAL]
+            out.append(len(chunk) - 1)
+            out.extend(pack(chunk, bpp))
+        del literal[:]
+
+    i = 0
+    while i < len(indexes):
+        run = 1
+        while (i + run < len(indexes) and run < MAX_RUN
+               and indexes[i + run] == indexes[i]):
+            run += 1
+        if run >= threshold:
+            flush()
+            n = run - 1
+            if run <= MAX_SHORT_RUN:
+                out.append(RUN | n)
+            else:
+                out.append(RUN | LONG_RUN | (n >> 8))
+                out.append(n & 0xFF)
+            out.append(indexes[i])
+        else:
+            literal.extend(indexes[i:i + run])
+        i += run
+    flush()
+    return out
+
+
+def decode(data, count, bpp):
+    """Decodes the packets as LCD_DrawImage() does, for checking."""
+    mask = (1 << bpp) - 1
+    out = []
+    i = 0
+    while len(out) < count:
+        c = data[i]
+        i += 1
+        if c & RUN:
+            n = c & 0x3F
+            if c & LONG_RUN:
+                n = (n << 8) | data[i]
+                i += 1
+            out.extend([data[i]] * (n + 1))
+            i += 1
+        else:
+            shift = 8 - bpp
+            for _ in range(c + 1):
+                out.append((data[i] >> shift) & mask)
+                shift -= bpp
+                if shift < 0:
+                    shift += 8
+                    i += 1
+            if shift != 8 - bpp:
+                i += 1
+    return out
+
+
+def c_array(data, fmt, per_line):
+    lines = []
+    for i in range(0, len(data), per_line):
+        lines.append("    " + ", ".join(fmt % v for v in data[i:i + per_line]))
+    return ",\n".join(lines)
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Convert an image to an LCD_Image C header")
+    parser.add_argument("image")
+    parser.add_argument("name", help="C name of the LCD_Image")
+    parser.add_argument("--colors", type=int, default=256,
+                        help="most colors in the palette, 2 to 256")
+    parser.add_argument("--background", default="000000",
+                        help="color under transparent pixels, RRGGBB")
+    args = parser.parse_args()
+
+    if not 2 <= args.colors <= 256:
+        parser.error("--colors must be 2 to 256")
+    background = tuple(int(args.background[i:i + 2], 16) for i in (0, 2, 4))
+
+    (w, h), palette, indexes = load(args.image, args.colors, background)
+    bpp = bits_for(len(palette))
+    data = encode(indexes, bpp)
+    if decode(data, w * h, bpp) != indexes:
+        sys.exit("imgconv: internal error, the image does not decode")
+
+    size = len(data) + 2 * len(palette)
+    print("// %s: %ux%u, %u colors, %u-bit literal indexes" %
+          (os.path.basename(args.image), w, h, len(palette), bpp))
+    print("// %u bytes of flash, %.1f%% of RGB565 (generated by imgconv.py)" %
+          (size, 100.0 * size / (2 * w * h)))
+    print()
+    print("const uint16_t %sPalette[] = {" % args.name)
+    print(c_array(palette, "0x%04X", 8) + " };")
+    print()
+    print("const uint8_t %sData[] = {" % args.name)
+    print(c_array(data, "0x%02X", 12) + " };")
+    print()
+    print("const LCD_Image %s = { %sPalette, %sData, %u, %u, %u };" %
+          (args.name, args.name, args.name, w, h, bpp))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,532 @@
+// lcdsim.ppm: 240x320, 9 colors, 4-bit literal indexes
+// 6281 bytes of flash, 4.1% of RGB565 (generated by imgconv.py)
+
+const uint16_t DemoImagePalette[] = {
+    0xFFFF, 0x001F, 0xFD20, 0xF800, 0x0000, 0x07FF, 0x07E0, 0xFFE0,
+    0xF81F };
+
+const uint8_t DemoImageData[] = {
+    0xC9, 0x69, 0x00, 0xC0, 0x63, 0x03, 0xC9, 0x05, 0x00, 0xC0, 0x63, 0x01,
+    0x89, 0x00, 0x00, 0x40, 0x97, 0x00, 0x8A, 0x03, 0xC0, 0x5D, 0x00, 0xC0,
+    0x63, 0x01, 0x89, 0x00, 0x00, 0x40, 0x94, 0x00, 0x02, 0x33, 0x30, 0x8A,
+    0x00, 0x02, 0x33, 0x30, 0xC0, 0x5A, 0x00, 0xC0, 0x63, 0x01, 0x89, 0x00,
+    0x00, 0x40, 0x91, 0x00, 0x02, 0x33, 0x30, 0x90, 0x00, 0x02, 0x33, 0x30,
+    0xC0, 0x57, 0x00, 0xC0, 0x63, 0x01, 0x89, 0x00, 0x00, 0x40, 0x90, 0x00,
+    0x00, 0x30, 0x96, 0x00, 0x00, 0x30, 0xC0, 0x56, 0x00, 0xC0, 0x63, 0x01,
+    0x89, 0x00, 0x00, 0x40, 0x8E, 0x00, 0x01, 0x33, 0x98, 0x00, 0x01, 0x33,
+    0xC0, 0x54, 0x00, 0xC0, 0x63, 0x01, 0x89, 0x00, 0x00, 0x40, 0x8D, 0x00,
+    0x00, 0x30, 0x9C, 0x00, 0x00, 0x30, 0xA2, 0x00, 0x88, 0x03, 0xA7, 0x00,
+    0xC0, 0x63, 0x01, 0x89, 0x00, 0x00, 0x40, 0x8B, 0x00, 0x01, 0x33, 0x9E,
+    0x00, 0x01, 0x33, 0x9D, 0x00, 0x8E, 0x03, 0xA4, 0x00, 0xC0, 0x63, 0x01,
+    0x89, 0x00, 0x00, 0x40, 0x8A, 0x00, 0x00, 0x30, 0xA2, 0x00, 0x00, 0x30,
+    0x9A, 0x00, 0x92, 0x03, 0xA2, 0x00, 0xC0, 0x63, 0x01, 0x89, 0x00, 0x00,
+    0x40, 0x89, 0x00, 0x00, 0x30, 0xA4, 0x00, 0x00, 0x30, 0x97, 0x00, 0x96,
+    0x03, 0xA0, 0x00, 0xC0, 0x63, 0x01, 0x89, 0x00, 0x00, 0x40, 0x89, 0x00,
+    0x00, 0x30, 0xA4, 0x00, 0x00, 0x30, 0x96, 0x00, 0x98, 0x03, 0x9F, 0x00,
+    0xC0, 0x63, 0x01, 0x89, 0x00, 0x00, 0x40, 0x88, 0x00, 0x00, 0x30, 0xA6,
+    0x00, 0x00, 0x30, 0x94, 0x00, 0x9A, 0x03, 0x9E, 0x00, 0xC0, 0x63, 0x01,
+    0x89, 0x00, 0x00, 0x40, 0x87, 0x00, 0x00, 0x30, 0xA8, 0x00, 0x00, 0x30,
+    0x92, 0x00, 0x9C, 0x03, 0x9D, 0x00, 0xC0, 0x63, 0x01, 0x89, 0x00, 0x00,
+    0x40, 0x87, 0x00, 0x00, 0x30, 0xA8, 0x00, 0x00, 0x30, 0x91, 0x00, 0x9E,
+    0x03, 0x9C, 0x00, 0xC0, 0x63, 0x01, 0x89, 0x00, 0x00, 0x40, 0x86, 0x00,
+    0x00, 0x30, 0xAA, 0x00, 0x00, 0x30, 0x8F, 0x00, 0xA0, 0x03, 0x9B, 0x00,
+    0xC0, 0x63, 0x01, 0x89, 0x00, 0x00, 0x40, 0x85, 0x00, 0x00, 0x30, 0xAC,
+    0x00, 0x00, 0x30, 0x8D, 0x00, 0xA2, 0x03, 0x9A, 0x00, 0xC0, 0x63, 0x01,
+    0x89, 0x00, 0x00, 0x40, 0x85, 0x00, 0x00, 0x30, 0xAC, 0x00, 0x00, 0x30,
+    0x8D, 0x00, 0xA2, 0x03, 0x9A, 0x00, 0xC0, 0x63, 0x01, 0x89, 0x00, 0x00,
+    0x40, 0x85, 0x00, 0x00, 0x30, 0xAC, 0x00, 0x00, 0x30, 0x8C, 0x00, 0xA4,
+    0x03, 0x99, 0x00, 0xC0, 0x63, 0x01, 0x89, 0x00, 0x00, 0x40, 0x84, 0x00,
+    0x00, 0x30, 0xAE, 0x00, 0x00, 0x30, 0x8B, 0x00, 0xA4, 0x03, 0x99, 0x00,
+    0xC0, 0x63, 0x01, 0x89, 0x00, 0x00, 0x40, 0x84, 0x00, 0x00, 0x30, 0xAE,
+    0x00, 0x00, 0x30, 0x8A, 0x00, 0xA6, 0x03, 0x98, 0x00, 0xC0, 0x63, 0x01,
+    0x89, 0x00, 0x00, 0x40, 0x84, 0x00, 0x00, 0x30, 0xAE, 0x00, 0x00, 0x30,
+    0x8A, 0x00, 0xA6, 0x03, 0x98, 0x00, 0xC0, 0x63, 0x01, 0x89, 0x00, 0x05,
+    0x40, 0x00, 0x03, 0xB0, 0x00, 0x00, 0x30, 0x89, 0x00, 0xA6, 0x03, 0x98,
+    0x00, 0xC0, 0x63, 0x01, 0x89, 0x00, 0x05, 0x40, 0x00, 0x03, 0xB0, 0x00,
+    0x00, 0x30, 0x88, 0x00, 0xA8, 0x03, 0x97, 0x00, 0xC0, 0x63, 0x01, 0x89,
+    0x00, 0x05, 0x40, 0x00, 0x03, 0xB0, 0x00, 0x00, 0x30, 0x88, 0x00, 0xA8,
+    0x03, 0x97, 0x00, 0xC0, 0x63, 0x01, 0x89, 0x00, 0x05, 0x40, 0x00, 0x03,
+    0xB0, 0x00, 0x00, 0x30, 0x88, 0x00, 0xA8, 0x03, 0x97, 0x00, 0xC0, 0x63,
+    0x01, 0x89, 0x00, 0x05, 0x40, 0x00, 0x03, 0xB0, 0x00, 0x00, 0x30, 0x88,
+    0x00, 0xA8, 0x03, 0x97, 0x00, 0xC0, 0x63, 0x01, 0x89, 0x00, 0x05, 0x40,
+    0x00, 0x03, 0xB0, 0x00, 0x00, 0x30, 0x88, 0x00, 0xA8, 0x03, 0x97, 0x00,
+    0xC0, 0x63, 0x01, 0x89, 0x00, 0x05, 0x40, 0x00, 0x03, 0xB0, 0x00, 0x00,
+    0x30, 0x88, 0x00, 0xA8, 0x03, 0x97, 0x00, 0xC0, 0x63, 0x01, 0x89, 0x00,
+    0x05, 0x40, 0x00, 0x03, 0xB0, 0x00, 0x00, 0x30, 0x88, 0x00, 0xA8, 0x03,
+    0x97, 0x00, 0xC0, 0x63, 0x01, 0x89, 0x00, 0x05, 0x40, 0x00, 0x03, 0xB0,
+    0x00, 0x00, 0x30, 0x88, 0x00, 0xA8, 0x03, 0x97, 0x00, 0xC0, 0x63, 0x01,
+    0x89, 0x00, 0x05, 0x40, 0x00, 0x03, 0xB0, 0x00, 0x00, 0x30, 0x88, 0x00,
+    0xA8, 0x03, 0x97, 0x00, 0xC0, 0x63, 0x01, 0x89, 0x00, 0x05, 0x40, 0x00,
+    0x03, 0xB0, 0x00, 0x00, 0x30, 0x89, 0x00, 0xA6, 0x03, 0x98, 0x00, 0xC0,
+    0x63, 0x01, 0x89, 0x00, 0x00, 0x40, 0x84, 0x00, 0x00, 0x30, 0xAE, 0x00,
+    0x00, 0x30, 0x8A, 0x00, 0xA6, 0x03, 0x98, 0x00, 0xC0, 0x63, 0x01, 0x89,
+    0x00, 0x00, 0x40, 0x84, 0x00, 0x00, 0x30, 0xAE, 0x00, 0x00, 0x30, 0x8A,
+    0x00, 0xA6, 0x03, 0x98, 0x00, 0xC0, 0x63, 0x01, 0x89, 0x00, 0x00, 0x40,
+    0x84, 0x00, 0x00, 0x30, 0xAE, 0x00, 0x00, 0x30, 0x8B, 0x00, 0xA4, 0x03,
+    0x99, 0x00, 0xC0, 0x63, 0x01, 0x89, 0x00, 0x00, 0x40, 0x85, 0x00, 0x00,
+    0x30, 0xAC, 0x00, 0x00, 0x30, 0x8C, 0x00, 0xA4, 0x03, 0x99, 0x00, 0xC0,
+    0x63, 0x01, 0x89, 0x00, 0x00, 0x40, 0x85, 0x00, 0x00, 0x30, 0xAC, 0x00,
+    0x00, 0x30, 0x8D, 0x00, 0xA2, 0x03, 0x9A, 0x00, 0xC0, 0x63, 0x01, 0x89,
+    0x00, 0x00, 0x40, 0x85, 0x00, 0x00, 0x30, 0xAC, 0x00, 0x00, 0x30, 0x8D,
+    0x00, 0xA2, 0x03, 0x9A, 0x00, 0xC0, 0x63, 0x01, 0x89, 0x00, 0x00, 0x40,
+    0x86, 0x00, 0x00, 0x30, 0xAA, 0x00, 0x00, 0x30, 0x8F, 0x00, 0xA0, 0x03,
+    0x9B, 0x00, 0xC0, 0x63, 0x01, 0x89, 0x00, 0x00, 0x40, 0x87, 0x00, 0x00,
+    0x30, 0xA8, 0x00, 0x00, 0x30, 0x91, 0x00, 0x9E, 0x03, 0x9C, 0x00, 0xC0,
+    0x63, 0x01, 0x89, 0x00, 0x00, 0x40, 0x87, 0x00, 0x00, 0x30, 0xA8, 0x00,
+    0x00, 0x30, 0x92, 0x00, 0x9C, 0x03, 0x9D, 0x00, 0xC0, 0x63, 0x01, 0x89,
+    0x00, 0x00, 0x40, 0x88, 0x00, 0x00, 0x30, 0xA6, 0x00, 0x00, 0x30, 0x94,
+    0x00, 0x9A, 0x03, 0x9E, 0x00, 0xC0, 0x63, 0x01, 0x89, 0x00, 0x00, 0x40,
+    0x89, 0x00, 0x00, 0x30, 0xA4, 0x00, 0x00, 0x30, 0x96, 0x00, 0x98, 0x03,
+    0x9F, 0x00, 0xC0, 0x63, 0x01, 0x89, 0x00, 0x00, 0x40, 0x89, 0x00, 0x00,
+    0x30, 0xA4, 0x00, 0x00, 0x30, 0x97, 0x00, 0x96, 0x03, 0xA0, 0x00, 0xC0,
+    0x63, 0x01, 0x89, 0x00, 0x00, 0x40, 0x8A, 0x00, 0x00, 0x30, 0xA2, 0x00,
+    0x00, 0x30, 0x9A, 0x00, 0x92, 0x03, 0xA2, 0x00, 0xC0, 0x63, 0x01, 0x89,
+    0x00, 0x00, 0x40, 0x8B, 0x00, 0x01, 0x33, 0x9E, 0x00, 0x01, 0x33, 0x9D,
+    0x00, 0x8E, 0x03, 0xA4, 0x00, 0xC0, 0x63, 0x01, 0x89, 0x00, 0x00, 0x40,
+    0x8D, 0x00, 0x00, 0x30, 0x9C, 0x00, 0x00, 0x30, 0xA2, 0x00, 0x88, 0x03,
+    0xA7, 0x00, 0xC0, 0x63, 0x01, 0x89, 0x00, 0x00, 0x40, 0x8E, 0x00, 0x01,
+    0x33, 0x98, 0x00, 0x01, 0x33, 0xC0, 0x54, 0x00, 0xC0, 0x63, 0x01, 0x89,
+    0x00, 0x00, 0x40, 0x90, 0x00, 0x00, 0x30, 0x96, 0x00, 0x00, 0x30, 0xC0,
+    0x56, 0x00, 0xC0, 0x63, 0x01, 0x89, 0x00, 0x00, 0x40, 0x91, 0x00, 0x02,
+    0x33, 0x30, 0x90, 0x00, 0x02, 0x33, 0x30, 0xC0, 0x57, 0x00, 0xC0, 0x63,
+    0x01, 0x89, 0x00, 0x00, 0x40, 0x94, 0x00, 0x02, 0x33, 0x30, 0x8A, 0x00,
+    0x02, 0x33, 0x30, 0xC0, 0xC8, 0x00, 0x00, 0x40, 0x97, 0x00, 0x8A, 0x03,
+    0xC0, 0xCB, 0x00, 0x00, 0x40, 0xC0, 0xEE, 0x00, 0x00, 0x40, 0xC0, 0xEE,
+    0x00, 0x00, 0x40, 0xC0, 0xEE, 0x00, 0x00, 0x40, 0xC0, 0xEE, 0x00, 0x00,
+    0x40, 0xC0, 0xEE, 0x00, 0x00, 0x40, 0xC0, 0xEE, 0x00, 0x00, 0x40, 0xC0,
+    0xEE, 0x00, 0x00, 0x40, 0xC0, 0xEE, 0x00, 0x00, 0x40, 0xC0, 0x80, 0x00,
+    0xC0, 0x63, 0x06, 0x89, 0x00, 0x00, 0x40, 0xAA, 0x00, 0x96, 0x01, 0xBE,
+    0x00, 0x00, 0x60, 0xC0, 0x61, 0x00, 0x00, 0x60, 0x89, 0x00, 0x00, 0x40,
+    0xA2, 0x00, 0x87, 0x01, 0x96, 0x00, 0x87, 0x01, 0xB6, 0x00, 0x00, 0x60,
+    0xC0, 0x61, 0x00, 0x00, 0x60, 0x89, 0x00, 0x00, 0x40, 0x9D, 0x00, 0x84,
+    0x01, 0xA6, 0x00, 0x84, 0x01, 0xB1, 0x00, 0x00, 0x60, 0xC0, 0x61, 0x00,
+    0x00, 0x60, 0x89, 0x00, 0x00, 0x40, 0x99, 0x00, 0x03, 0x11, 0x11, 0xB0,
+    0x00, 0x03, 0x11, 0x11, 0xAD, 0x00, 0x00, 0x60, 0xC0, 0x61, 0x00, 0x00,
+    0x60, 0x89, 0x00, 0x00, 0x40, 0x95, 0x00, 0x03, 0x11, 0x11, 0xB8, 0x00,
+    0x03, 0x11, 0x11, 0xA9, 0x00, 0x00, 0x60, 0xC0, 0x61, 0x00, 0x00, 0x60,
+    0x89, 0x00, 0x00, 0x40, 0x93, 0x00, 0x01, 0x11, 0xC0, 0x40, 0x00, 0x01,
+    0x11, 0xA7, 0x00, 0x00, 0x60, 0xC0, 0x61, 0x00, 0x00, 0x60, 0x89, 0x00,
+    0x00, 0x40, 0x90, 0x00, 0x02, 0x11, 0x10, 0xC0, 0x44, 0x00, 0x02, 0x11,
+    0x10, 0xA4, 0x00, 0x00, 0x60, 0xC0, 0x61, 0x00, 0x00, 0x60, 0x89, 0x00,
+    0x00, 0x40, 0x8F, 0x00, 0x00, 0x10, 0x9A, 0x00, 0x94, 0x05, 0x9A, 0x00,
+    0x00, 0x10, 0xA3, 0x00, 0x00, 0x60, 0xC0, 0x61, 0x00, 0x00, 0x60, 0x89,
+    0x00, 0x00, 0x40, 0x8D, 0x00, 0x01, 0x11, 0x94, 0x00, 0xA2, 0x05, 0x94,
+    0x00, 0x01, 0x11, 0xA1, 0x00, 0x00, 0x60, 0xC0, 0x61, 0x00, 0x00, 0x60,
+    0x89, 0x00, 0x00, 0x40, 0x8C, 0x00, 0x00, 0x10, 0x92, 0x00, 0xAA, 0x05,
+    0x92, 0x00, 0x00, 0x10, 0xA0, 0x00, 0x00, 0x60, 0xC0, 0x61, 0x00, 0x00,
+    0x60, 0x89, 0x00, 0x00, 0x40, 0x8A, 0x00, 0x01, 0x11, 0x90, 0x00, 0xB0,
+    0x05, 0x90, 0x00, 0x01, 0x11, 0x9E, 0x00, 0x00, 0x60, 0xC0, 0x61, 0x00,
+    0x00, 0x60, 0x89, 0x00, 0x00, 0x40, 0x8A, 0x00, 0x00, 0x10, 0x8F, 0x00,
+    0xB4, 0x05, 0x8F, 0x00, 0x00, 0x10, 0x9E, 0x00, 0x00, 0x60, 0xC0, 0x61,
+    0x00, 0x00, 0x60, 0x89, 0x00, 0x00, 0x40, 0x89, 0x00, 0x00, 0x10, 0x8E,
+    0x00, 0xB8, 0x05, 0x8E, 0x00, 0x00, 0x10, 0x9D, 0x00, 0x00, 0x60, 0xC0,
+    0x61, 0x00, 0x00, 0x60, 0x89, 0x00, 0x00, 0x40, 0x88, 0x00, 0x00, 0x10,
+    0x8E, 0x00, 0xBA, 0x05, 0x8E, 0x00, 0x00, 0x10, 0x9C, 0x00, 0x00, 0x60,
+    0xC0, 0x61, 0x00, 0x00, 0x60, 0x89, 0x00, 0x00, 0x40, 0x88, 0x00, 0x00,
+    0x10, 0x8D, 0x00, 0xBC, 0x05, 0x8D, 0x00, 0x00, 0x10, 0x9C, 0x00, 0x00,
+    0x60, 0xC0, 0x61, 0x00, 0x00, 0x60, 0x89, 0x00, 0x00, 0x40, 0x88, 0x00,
+    0x00, 0x10, 0x8D, 0x00, 0xBC, 0x05, 0x8D, 0x00, 0x00, 0x10, 0x9C, 0x00,
+    0x00, 0x60, 0xC0, 0x61, 0x00, 0x00, 0x60, 0x89, 0x00, 0x00, 0x40, 0x88,
+    0x00, 0x00, 0x10, 0x8D, 0x00, 0xBC, 0x05, 0x8D, 0x00, 0x00, 0x10, 0x9C,
+    0x00, 0x00, 0x60, 0xC0, 0x61, 0x00, 0x00, 0x60, 0x89, 0x00, 0x00, 0x40,
+    0x88, 0x00, 0x00, 0x10, 0x8E, 0x00, 0xBA, 0x05, 0x8E, 0x00, 0x00, 0x10,
+    0x9C, 0x00, 0x00, 0x60, 0xC0, 0x61, 0x00, 0x00, 0x60, 0x89, 0x00, 0x00,
+    0x40, 0x89, 0x00, 0x00, 0x10, 0x8E, 0x00, 0xB8, 0x05, 0x8E, 0x00, 0x00,
+    0x10, 0x9D, 0x00, 0x00, 0x60, 0xC0, 0x61, 0x00, 0x00, 0x60, 0x89, 0x00,
+    0x00, 0x40, 0x8A, 0x00, 0x00, 0x10, 0x8F, 0x00, 0xB4, 0x05, 0x8F, 0x00,
+    0x00, 0x10, 0x9E, 0x00, 0x00, 0x60, 0xC0, 0x61, 0x00, 0x00, 0x60, 0x89,
+    0x00, 0x00, 0x40, 0x8A, 0x00, 0x01, 0x11, 0x90, 0x00, 0xB0, 0x05, 0x90,
+    0x00, 0x01, 0x11, 0x9E, 0x00, 0x00, 0x60, 0xC0, 0x61, 0x00, 0x00, 0x60,
+    0x89, 0x00, 0x00, 0x40, 0x8C, 0x00, 0x00, 0x10, 0x92, 0x00, 0xAA, 0x05,
+    0x92, 0x00, 0x00, 0x10, 0xA0, 0x00, 0x00, 0x60, 0xC0, 0x61, 0x00, 0x00,
+    0x60, 0x89, 0x00, 0x00, 0x40, 0x8D, 0x00, 0x01, 0x11, 0x94, 0x00, 0xA2,
+    0x05, 0x94, 0x00, 0x01, 0x11, 0xA1, 0x00, 0x00, 0x60, 0xC0, 0x61, 0x00,
+    0x00, 0x60, 0x89, 0x00, 0x00, 0x40, 0x8F, 0x00, 0x00, 0x10, 0x9A, 0x00,
+    0x94, 0x05, 0x9A, 0x00, 0x00, 0x10, 0xA3, 0x00, 0x00, 0x60, 0xC0, 0x61,
+    0x00, 0x00, 0x60, 0x89, 0x00, 0x00, 0x40, 0x90, 0x00, 0x02, 0x11, 0x10,
+    0xC0, 0x44, 0x00, 0x02, 0x11, 0x10, 0xA4, 0x00, 0x00, 0x60, 0xC0, 0x61,
+    0x00, 0x00, 0x60, 0x89, 0x00, 0x00, 0x40, 0x93, 0x00, 0x01, 0x11, 0xC0,
+    0x40, 0x00, 0x01, 0x11, 0xA7, 0x00, 0x00, 0x60, 0xC0, 0x61, 0x00, 0x00,
+    0x60, 0x89, 0x00, 0x00, 0x40, 0x95, 0x00, 0x03, 0x11, 0x11, 0xB8, 0x00,
+    0x03, 0x11, 0x11, 0xA9, 0x00, 0x00, 0x60, 0xC0, 0x61, 0x00, 0x00, 0x60,
+    0x89, 0x00, 0x00, 0x40, 0x99, 0x00, 0x03, 0x11, 0x11, 0xB0, 0x00, 0x03,
+    0x11, 0x11, 0xAD, 0x00, 0x00, 0x60, 0xC0, 0x61, 0x00, 0x00, 0x60, 0x89,
+    0x00, 0x00, 0x40, 0x9D, 0x00, 0x84, 0x01, 0xA6, 0x00, 0x84, 0x01, 0xB1,
+    0x00, 0x00, 0x60, 0xC0, 0x61, 0x00, 0x00, 0x60, 0x89, 0x00, 0x00, 0x40,
+    0xA2, 0x00, 0x87, 0x01, 0x96, 0x00, 0x87, 0x01, 0xB6, 0x00, 0x00, 0x60,
+    0xC0, 0x61, 0x00, 0x00, 0x60, 0x89, 0x00, 0x00, 0x40, 0xAA, 0x00, 0x96,
+    0x01, 0xBE, 0x00, 0x00, 0x60, 0xC0, 0x61, 0x00, 0x00, 0x60, 0x89, 0x00,
+    0x00, 0x40, 0xC0, 0x80, 0x00, 0x00, 0x60, 0xC0, 0x61, 0x00, 0x00, 0x60,
+    0x89, 0x00, 0x00, 0x40, 0xC0, 0x80, 0x00, 0x00, 0x60, 0xC0, 0x61, 0x00,
+    0x00, 0x60, 0x89, 0x00, 0x00, 0x40, 0xC0, 0x80, 0x00, 0x00, 0x60, 0xC0,
+    0x61, 0x00, 0x00, 0x60, 0x89, 0x00, 0x00, 0x40, 0xC0, 0x80, 0x00, 0x00,
+    0x60, 0xC0, 0x61, 0x00, 0x00, 0x60, 0x89, 0x00, 0x00, 0x40, 0x8E, 0x00,
+    0xC0, 0x52, 0x04, 0x9E, 0x00, 0x00, 0x60, 0xC0, 0x61, 0x00, 0x00, 0x60,
+    0x89, 0x00, 0x00, 0x40, 0x8C, 0x00, 0x01, 0x44, 0xC0, 0x52, 0x02, 0x01,
+    0x44, 0x9C, 0x00, 0x00, 0x60, 0xC0, 0x61, 0x00, 0x00, 0x60, 0x89, 0x00,
+    0x00, 0x40, 0x8A, 0x00, 0x01, 0x44, 0xC0, 0x56, 0x02, 0x01, 0x44, 0x9A,
+    0x00, 0x00, 0x60, 0xC0, 0x61, 0x00, 0x00, 0x60, 0x89, 0x00, 0x00, 0x40,
+    0x8A, 0x00, 0x00, 0x40, 0xC0, 0x58, 0x02, 0x00, 0x40, 0x9A, 0x00, 0x00,
+    0x60, 0xC0, 0x61, 0x00, 0x00, 0x60, 0x89, 0x00, 0x00, 0x40, 0x89, 0x00,
+    0x00, 0x40, 0xC0, 0x5A, 0x02, 0x00, 0x40, 0x99, 0x00, 0x00, 0x60, 0xC0,
+    0x61, 0x00, 0x00, 0x60, 0x89, 0x00, 0x00, 0x40, 0x89, 0x00, 0x00, 0x40,
+    0xC0, 0x5A, 0x02, 0x00, 0x40, 0x99, 0x00, 0x00, 0x60, 0xC0, 0x61, 0x00,
+    0x00, 0x60, 0x89, 0x00, 0x00, 0x40, 0x88, 0x00, 0x00, 0x40, 0xC0, 0x5C,
+    0x02, 0x00, 0x40, 0x98, 0x00, 0x00, 0x60, 0xC0, 0x61, 0x00, 0x00, 0x60,
+    0x89, 0x00, 0x00, 0x40, 0x88, 0x00, 0x00, 0x40, 0xC0, 0x5C, 0x02, 0x00,
+    0x40, 0x98, 0x00, 0x00, 0x60, 0xC0, 0x61, 0x00, 0x00, 0x60, 0x89, 0x00,
+    0x00, 0x40, 0x88, 0x00, 0x00, 0x40, 0xC0, 0x5C, 0x02, 0x00, 0x40, 0x98,
+    0x00, 0x00, 0x60, 0xC0, 0x61, 0x00, 0x00, 0x60, 0x89, 0x00, 0x00, 0x40,
+    0x88, 0x00, 0x00, 0x40, 0xC0, 0x5C, 0x02, 0x00, 0x40, 0x98, 0x00, 0x00,
+    0x60, 0xC0, 0x61, 0x00, 0x00, 0x60, 0x89, 0x00, 0x00, 0x40, 0x88, 0x00,
+    0x00, 0x40, 0xC0, 0x5C, 0x02, 0x00, 0x40, 0x98, 0x00, 0x00, 0x60, 0xC0,
+    0x61, 0x00, 0x00, 0x60, 0x89, 0x00, 0x00, 0x40, 0x88, 0x00, 0x00, 0x40,
+    0xC0, 0x5C, 0x02, 0x00, 0x40, 0x98, 0x00, 0x00, 0x60, 0xC0, 0x61, 0x00,
+    0x00, 0x60, 0x89, 0x00, 0x00, 0x40, 0x88, 0x00, 0x00, 0x40, 0xC0, 0x5C,
+    0x02, 0x00, 0x40, 0x98, 0x00, 0x00, 0x60, 0xC0, 0x61, 0x00, 0x00, 0x60,
+    0x89, 0x00, 0x00, 0x40, 0x88, 0x00, 0x00, 0x40, 0xC0, 0x5C, 0x02, 0x00,
+    0x40, 0x98, 0x00, 0xC0, 0x63, 0x06, 0x89, 0x00, 0x00, 0x40, 0x88, 0x00,
+    0x00, 0x40, 0xC0, 0x5C, 0x02, 0x00, 0x40, 0xC0, 0x90, 0x00, 0x00, 0x40,
+    0xC0, 0x5C, 0x02, 0x00, 0x40, 0xC0, 0x90, 0x00, 0x00, 0x40, 0xC0, 0x5C,
+    0x02, 0x00, 0x40, 0xC0, 0x90, 0x00, 0x00, 0x40, 0xC0, 0x5C, 0x02, 0x00,
+    0x40, 0xC0, 0x90, 0x00, 0x00, 0x40, 0xC0, 0x5C, 0x02, 0x00, 0x40, 0xC0,
+    0x90, 0x00, 0x00, 0x40, 0xC0, 0x5C, 0x02, 0x00, 0x40, 0xC0, 0x90, 0x00,
+    0x00, 0x40, 0xC0, 0x5C, 0x02, 0x00, 0x40, 0xC0, 0x90, 0x00, 0x00, 0x40,
+    0xC0, 0x5C, 0x02, 0x00, 0x40, 0xC0, 0x90, 0x00, 0x00, 0x40, 0xC0, 0x5C,
+    0x02, 0x00, 0x40, 0xC0, 0x90, 0x00, 0x00, 0x40, 0xC0, 0x5C, 0x02, 0x00,
+    0x40, 0xC0, 0x90, 0x00, 0x00, 0x40, 0xC0, 0x5C, 0x02, 0x00, 0x40, 0x84,
+    0x00, 0xC0, 0x8C, 0x04, 0xC0, 0x5C, 0x02, 0x85, 0x04, 0xC0, 0x8B, 0x00,
+    0x00, 0x40, 0xC0, 0x5C, 0x02, 0x00, 0x40, 0xC0, 0x90, 0x00, 0x00, 0x40,
+    0xC0, 0x5C, 0x02, 0x00, 0x40, 0xC0, 0x90, 0x00, 0x00, 0x40, 0xC0, 0x5C,
+    0x02, 0x00, 0x40, 0xC0, 0x90, 0x00, 0x00, 0x40, 0xC0, 0x5C, 0x02, 0x00,
+    0x40, 0xC0, 0x90, 0x00, 0x00, 0x40, 0xC0, 0x5C, 0x02, 0x00, 0x40, 0xC0,
+    0x90, 0x00, 0x00, 0x40, 0xC0, 0x5C, 0x02, 0x00, 0x40, 0xC0, 0x90, 0x00,
+    0x00, 0x40, 0xC0, 0x5C, 0x02, 0x00, 0x40, 0xC0, 0x90, 0x00, 0x00, 0x40,
+    0xC0, 0x5C, 0x02, 0x00, 0x40, 0xC0, 0x91, 0x00, 0x00, 0x40, 0xC0, 0x5A,
+    0x02, 0x00, 0x40, 0x85, 0x00, 0x02, 0x88, 0x80, 0xC0, 0x89, 0x00, 0x00,
+    0x40, 0xC0, 0x5A, 0x02, 0x00, 0x40, 0x88, 0x00, 0x84, 0x08, 0xC0, 0x85,
+    0x00, 0x00, 0x40, 0xC0, 0x58, 0x02, 0x00, 0x40, 0x8E, 0x00, 0x03, 0x88,
+    0x88, 0xC0, 0x81, 0x00, 0x01, 0x44, 0xC0, 0x56, 0x02, 0x01, 0x44, 0x92,
+    0x00, 0x84, 0x08, 0xC0, 0x7E, 0x00, 0x01, 0x44, 0xC0, 0x52, 0x02, 0x01,
+    0x44, 0x99, 0x00, 0x84, 0x08, 0xC0, 0x7B, 0x00, 0xC0, 0x52, 0x04, 0xA0,
+    0x00, 0x84, 0x08, 0xC0, 0xAD, 0x00, 0x00, 0x80, 0xC0, 0x40, 0x00, 0x84,
+    0x08, 0xC0, 0xA8, 0x00, 0x00, 0x80, 0xC0, 0x45, 0x00, 0x03, 0x88, 0x88,
+    0xC0, 0xA4, 0x00, 0x00, 0x80, 0xC0, 0x49, 0x00, 0x84, 0x08, 0xC0, 0xA0,
+    0x00, 0x00, 0x80, 0xC0, 0x4D, 0x00, 0x84, 0x08, 0xC0, 0x9B, 0x00, 0x00,
+    0x80, 0xC0, 0x52, 0x00, 0x84, 0x08, 0xC0, 0x5D, 0x00, 0x00, 0x40, 0xB7,
+    0x00, 0x00, 0x80, 0xC0, 0x57, 0x00, 0x03, 0x88, 0x88, 0xC0, 0x59, 0x00,
+    0x00, 0x40, 0xB7, 0x00, 0x00, 0x80, 0xC0, 0x5B, 0x00, 0x84, 0x08, 0xC0,
+    0x54, 0x00, 0x01, 0x44, 0xB6, 0x00, 0x00, 0x80, 0xC0, 0x60, 0x00, 0x84,
+    0x08, 0xC0, 0x4F, 0x00, 0x01, 0x44, 0xB7, 0x00, 0x00, 0x80, 0xC0, 0x64,
+    0x00, 0x84, 0x08, 0xC0, 0x4A, 0x00, 0x01, 0x44, 0xB7, 0x00, 0x00, 0x80,
+    0xC0, 0x69, 0x00, 0x84, 0x08, 0xC0, 0x44, 0x00, 0x02, 0x46, 0x40, 0xA5,
+    0x00, 0x00, 0x40, 0x90, 0x00, 0x00, 0x80, 0xC0, 0x6E, 0x00, 0x03, 0x88,
+    0x88, 0xC0, 0x40, 0x00, 0x03, 0x46, 0x64, 0xA4, 0x00, 0x00, 0x40, 0x90,
+    0x00, 0x00, 0x80, 0xC0, 0x72, 0x00, 0x84, 0x08, 0xBB, 0x00, 0x03, 0x46,
+    0x64, 0xA3, 0x00, 0x02, 0x47, 0x40, 0x8F, 0x00, 0x00, 0x80, 0xC0, 0x77,
+    0x00, 0x84, 0x08, 0xB6, 0x00, 0x03, 0x46, 0x64, 0xA3, 0x00, 0x02, 0x47,
+    0x40, 0x90, 0x00, 0x00, 0x80, 0xC0, 0x7B, 0x00, 0x84, 0x08, 0xB1, 0x00,
+    0x03, 0x46, 0x64, 0xA3, 0x00, 0x02, 0x47, 0x40, 0x90, 0x00, 0x00, 0x80,
+    0xC0, 0x80, 0x00, 0x03, 0x88, 0x88, 0xAD, 0x00, 0x04, 0x46, 0x66, 0x40,
+    0xA1, 0x00, 0x04, 0x47, 0x77, 0x40, 0x8F, 0x00, 0x00, 0x80, 0xC0, 0x84,
+    0x00, 0x84, 0x08, 0xA8, 0x00, 0x04, 0x46, 0x66, 0x40, 0xA1, 0x00, 0x04,
+    0x47, 0x77, 0x40, 0x8F, 0x00, 0x00, 0x80, 0xC0, 0x89, 0x00, 0x84, 0x08,
+    0xA3, 0x00, 0x04, 0x46, 0x66, 0x40, 0xA1, 0x00, 0x04, 0x47, 0x77, 0x40,
+    0x8F, 0x00, 0x00, 0x80, 0xC0, 0x8E, 0x00, 0x84, 0x08, 0x9D, 0x00, 0x00,
+    0x40, 0x84, 0x06, 0x00, 0x40, 0x9F, 0x00, 0x00, 0x40, 0x84, 0x07, 0x00,
+    0x40, 0x8F, 0x00, 0x00, 0x80, 0xC0, 0x92, 0x00, 0x84, 0x08, 0x98, 0x00,
+    0x00, 0x40, 0x84, 0x06, 0x00, 0x40, 0x9F, 0x00, 0x00, 0x40, 0x84, 0x07,
+    0x00, 0x40, 0x8F, 0x00, 0x00, 0x80, 0xC0, 0x97, 0x00, 0x03, 0x88, 0x88,
+    0x94, 0x00, 0x00, 0x40, 0x84, 0x06, 0x00, 0x40, 0x9F, 0x00, 0x00, 0x40,
+    0x84, 0x07, 0x00, 0x40, 0x8F, 0x00, 0x00, 0x80, 0xC0, 0x9B, 0x00, 0x84,
+    0x08, 0x8F, 0x00, 0x00, 0x40, 0x84, 0x06, 0x00, 0x40, 0x9F, 0x00, 0x00,
+    0x40, 0x84, 0x07, 0x00, 0x40, 0x8F, 0x00, 0x00, 0x80, 0xC0, 0xA0, 0x00,
+    0x84, 0x08, 0x8A, 0x00, 0x00, 0x40, 0x85, 0x06, 0x00, 0x40, 0x9D, 0x00,
+    0x00, 0x40, 0x86, 0x07, 0x00, 0x40, 0x8E, 0x00, 0x00, 0x80, 0xC0, 0xA5,
+    0x00, 0x84, 0x08, 0x85, 0x00, 0x00, 0x40, 0x85, 0x06, 0x00, 0x40, 0x9D,
+    0x00, 0x00, 0x40, 0x86, 0x07, 0x00, 0x40, 0x8F, 0x00, 0x00, 0x80, 0xC0,
+    0xA9, 0x00, 0x84, 0x08, 0x01, 0x04, 0x85, 0x06, 0x00, 0x40, 0x9D, 0x00,
+    0x00, 0x40, 0x86, 0x07, 0x00, 0x40, 0x8F, 0x00, 0x00, 0x80, 0xC0, 0xAE,
+    0x00, 0x01, 0x84, 0x85, 0x06, 0x00, 0x40, 0x9C, 0x00, 0x00, 0x40, 0x88,
+    0x07, 0x00, 0x40, 0x8E, 0x00, 0x00, 0x80, 0xC0, 0xAE, 0x00, 0x00, 0x40,
+    0x87, 0x06, 0x00, 0x40, 0x9B, 0x00, 0x00, 0x40, 0x88, 0x07, 0x00, 0x40,
+    0x8E, 0x00, 0x00, 0x80, 0xC0, 0xAE, 0x00, 0x00, 0x40, 0x87, 0x06, 0x04,
+    0x48, 0x88, 0x80, 0x97, 0x00, 0x00, 0x40, 0x88, 0x07, 0x00, 0x40, 0x8E,
+    0x00, 0x00, 0x80, 0xC0, 0xAE, 0x00, 0x00, 0x40, 0x87, 0x06, 0x04, 0x40,
+    0x00, 0x00, 0x84, 0x08, 0x91, 0x00, 0x00, 0x40, 0x8A, 0x07, 0x00, 0x40,
+    0x8E, 0x00, 0x00, 0x80, 0xC0, 0xAD, 0x00, 0x00, 0x40, 0x88, 0x06, 0x00,
+    0x40, 0x86, 0x00, 0x93, 0x04, 0x8A, 0x07, 0x93, 0x04, 0xC0, 0xAA, 0x00,
+    0x00, 0x40, 0x88, 0x06, 0x00, 0x40, 0x87, 0x00, 0x01, 0x44, 0xAC, 0x07,
+    0x01, 0x44, 0xC0, 0xAB, 0x00, 0x00, 0x40, 0x88, 0x06, 0x00, 0x40, 0x89,
+    0x00, 0x00, 0x40, 0xAA, 0x07, 0x00, 0x40, 0xC0, 0xAD, 0x00, 0x00, 0x40,
+    0x88, 0x06, 0x00, 0x40, 0x8A, 0x00, 0x00, 0x40, 0xA8, 0x07, 0x01, 0x48,
+    0xC0, 0xAD, 0x00, 0x00, 0x40, 0x89, 0x06, 0x00, 0x40, 0x8A, 0x00, 0x01,
+    0x44, 0xA4, 0x07, 0x04, 0x44, 0x00, 0x80, 0xC0, 0xAB, 0x00, 0x00, 0x40,
+    0x8A, 0x06, 0x00, 0x40, 0x8C, 0x00, 0x00, 0x40, 0xA2, 0x07, 0x05, 0x40,
+    0x00, 0x08, 0xC0, 0xAB, 0x00, 0x00, 0x40, 0x8A, 0x06, 0x00, 0x40, 0x8D,
+    0x00, 0x00, 0x40, 0xA0, 0x07, 0x00, 0x40, 0x84, 0x00, 0x00, 0x80, 0xC0,
+    0xAB, 0x00, 0x00, 0x40, 0x8A, 0x06, 0x00, 0x40, 0x8E, 0x00, 0x01, 0x44,
+    0x9C, 0x07, 0x01, 0x44, 0x85, 0x00, 0x00, 0x80, 0xC0, 0xAB, 0x00, 0x00,
+    0x40, 0x8B, 0x06, 0x00, 0x40, 0x8F, 0x00, 0x00, 0x40, 0x9A, 0x07, 0x09,
+    0x48, 0x88, 0x80, 0x00, 0x08, 0xC0, 0xAB, 0x00, 0x00, 0x40, 0x8B, 0x06,
+    0x00, 0x40, 0x90, 0x00, 0x00, 0x40, 0x98, 0x07, 0x00, 0x40, 0x84, 0x00,
+    0x05, 0x88, 0x88, 0x08, 0xC0, 0xAA, 0x00, 0x00, 0x40, 0x8B, 0x06, 0x00,
+    0x40, 0x91, 0x00, 0x01, 0x44, 0x94, 0x07, 0x01, 0x44, 0x89, 0x00, 0x84,
+    0x08, 0xC0, 0xA7, 0x00, 0x00, 0x40, 0x8C, 0x06, 0x00, 0x40, 0x92, 0x00,
+    0x00, 0x40, 0x92, 0x07, 0x00, 0x40, 0x8C, 0x00, 0x03, 0x80, 0x00, 0x84,
+    0x08, 0xC0, 0xA2, 0x00, 0x00, 0x40, 0x8C, 0x06, 0x00, 0x40, 0x92, 0x00,
+    0x00, 0x40, 0x92, 0x07, 0x00, 0x40, 0x8C, 0x00, 0x00, 0x80, 0x87, 0x00,
+    0x84, 0x08, 0xC0, 0x9C, 0x00, 0x00, 0x40, 0x8D, 0x06, 0x00, 0x40, 0x91,
+    0x00, 0x00, 0x40, 0x94, 0x07, 0x00, 0x40, 0x8B, 0x00, 0x00, 0x80, 0x8C,
+    0x00, 0x84, 0x08, 0xC0, 0x97, 0x00, 0x00, 0x40, 0x8D, 0x06, 0x00, 0x40,
+    0x91, 0x00, 0x00, 0x40, 0x94, 0x07, 0x00, 0x40, 0x8C, 0x00, 0x00, 0x80,
+    0x90, 0x00, 0x03, 0x88, 0x88, 0xC0, 0x93, 0x00, 0x00, 0x40, 0x8E, 0x06,
+    0x00, 0x40, 0x90, 0x00, 0x00, 0x40, 0x94, 0x07, 0x00, 0x40, 0x8C, 0x00,
+    0x00, 0x80, 0x94, 0x00, 0x84, 0x08, 0xC0, 0x8E, 0x00, 0x00, 0x40, 0x8E,
+    0x06, 0x00, 0x40, 0x8F, 0x00, 0x00, 0x40, 0x96, 0x07, 0x00, 0x40, 0x8B,
+    0x00, 0x00, 0x80, 0x99, 0x00, 0x02, 0x88, 0x80, 0xC0, 0x8C, 0x00, 0x01,
+    0x44, 0x8C, 0x06, 0x00, 0x40, 0x8F, 0x00, 0x00, 0x40, 0x96, 0x07, 0x00,
+    0x40, 0x8B, 0x00, 0x00, 0x80, 0xC0, 0xAA, 0x00, 0x01, 0x64, 0x8B, 0x06,
+    0x00, 0x40, 0x8F, 0x00, 0x00, 0x40, 0x96, 0x07, 0x00, 0x40, 0x8B, 0x00,
+    0x00, 0x80, 0xC0, 0xAC, 0x00, 0x00, 0x40, 0x8B, 0x06, 0x00, 0x40, 0x8D,
+    0x00, 0x00, 0x40, 0x8B, 0x07, 0x00, 0x40, 0x8B, 0x07, 0x00, 0x40, 0x8B,
+    0x00, 0x00, 0x80, 0xC0, 0xAC, 0x00, 0x01, 0x44, 0x89, 0x06, 0x00, 0x40,
+    0x8D, 0x00, 0x00, 0x40, 0x89, 0x07, 0x04, 0x44, 0x04, 0x40, 0x89, 0x07,
+    0x00, 0x40, 0x8B, 0x00, 0x00, 0x80, 0xC0, 0xAD, 0x00, 0x01, 0x64, 0x88,
+    0x06, 0x00, 0x40, 0x8D, 0x00, 0x00, 0x40, 0x88, 0x07, 0x00, 0x40, 0x84,
+    0x00, 0x00, 0x40, 0x88, 0x07, 0x00, 0x40, 0x8B, 0x00, 0x00, 0x80, 0xC0,
+    0xAF, 0x00, 0x00, 0x40, 0x88, 0x06, 0x00, 0x40, 0x8C, 0x00, 0x00, 0x40,
+    0x86, 0x07, 0x01, 0x44, 0x86, 0x00, 0x01, 0x44, 0x86, 0x07, 0x00, 0x40,
+    0x8B, 0x00, 0x00, 0x80, 0xC0, 0xB0, 0x00, 0x01, 0x44, 0x86, 0x06, 0x00,
+    0x40, 0x8B, 0x00, 0x00, 0x40, 0x86, 0x07, 0x00, 0x40, 0x8A, 0x00, 0x00,
+    0x40, 0x86, 0x07, 0x00, 0x40, 0x8A, 0x00, 0x00, 0x80, 0xC0, 0xB1, 0x00,
+    0x01, 0x64, 0x85, 0x06, 0x00, 0x40, 0x8B, 0x00, 0x00, 0x40, 0x85, 0x07,
+    0x00, 0x40, 0x8C, 0x00, 0x01, 0x44, 0x84, 0x07, 0x00, 0x40, 0x8B, 0x00,
+    0x00, 0x80, 0xC0, 0xB2, 0x00, 0x00, 0x40, 0x84, 0x06, 0x00, 0x40, 0x8B,
+    0x00, 0x06, 0x47, 0x77, 0x74, 0x40, 0x8F, 0x00, 0x05, 0x47, 0x77, 0x74,
+    0x8B, 0x00, 0x00, 0x80, 0xC0, 0xB3, 0x00, 0x06, 0x44, 0x66, 0x66, 0x40,
+    0x89, 0x00, 0x05, 0x47, 0x77, 0x74, 0x92, 0x00, 0x05, 0x47, 0x77, 0x74,
+    0x8A, 0x00, 0x00, 0x80, 0xC0, 0xB4, 0x00, 0x05, 0x64, 0x66, 0x64, 0x89,
+    0x00, 0x04, 0x47, 0x74, 0x40, 0x94, 0x00, 0x04, 0x44, 0x77, 0x40, 0x8A,
+    0x00, 0x00, 0x80, 0xC0, 0xB6, 0x00, 0x03, 0x46, 0x64, 0x89, 0x00, 0x02,
+    0x47, 0x40, 0x98, 0x00, 0x02, 0x47, 0x40, 0x8A, 0x00, 0x00, 0x80, 0xC0,
+    0xB7, 0x00, 0x02, 0x44, 0x40, 0x88, 0x00, 0x02, 0x44, 0x40, 0x9A, 0x00,
+    0x02, 0x44, 0x40, 0x8A, 0x00, 0x00, 0x80, 0xC0, 0xB7, 0x00, 0x02, 0x64,
+    0x40, 0x87, 0x00, 0x00, 0x40, 0x9E, 0x00, 0x00, 0x40, 0x8A, 0x00, 0x00,
+    0x80, 0xC0, 0xB9, 0x00, 0x00, 0x40, 0xB3, 0x00, 0x00, 0x80, 0xC0, 0xEE,
+    0x00, 0x00, 0x80, 0xC0, 0xEE, 0x00, 0x00, 0x80, 0xC0, 0xEF, 0x00, 0x00,
+    0x80, 0xC0, 0xEE, 0x00, 0x00, 0x80, 0xC0, 0xEE, 0x00, 0x00, 0x80, 0xC0,
+    0xEE, 0x00, 0x00, 0x80, 0xC0, 0xEE, 0x00, 0x00, 0x80, 0xC0, 0xEF, 0x00,
+    0x00, 0x80, 0xC0, 0xEE, 0x00, 0x00, 0x80, 0xC0, 0xEE, 0x00, 0x00, 0x80,
+    0xB7, 0x00, 0x03, 0x44, 0x44, 0x89, 0x00, 0x03, 0x44, 0x44, 0xC0, 0x5D,
+    0x00, 0x03, 0x44, 0x44, 0x8F, 0x00, 0x01, 0x44, 0x88, 0x00, 0x00, 0x40,
+    0xA6, 0x00, 0x00, 0x80, 0x99, 0x00, 0x09, 0x44, 0x40, 0x00, 0x04, 0x44,
+    0x96, 0x00, 0x00, 0x40, 0x8C, 0x00, 0x00, 0x40, 0xAF, 0x00, 0x84, 0x04,
+    0x03, 0x00, 0x00, 0x84, 0x04, 0xA2, 0x00, 0x00, 0x40, 0x90, 0x00, 0x00,
+    0x40, 0x88, 0x00, 0x00, 0x40, 0xA6, 0x00, 0x00, 0x80, 0x9A, 0x00, 0x00,
+    0x40, 0x85, 0x00, 0x00, 0x40, 0x97, 0x00, 0x00, 0x40, 0x8C, 0x00, 0x00,
+    0x40, 0xB1, 0x00, 0x00, 0x40, 0x88, 0x00, 0x00, 0x40, 0xA3, 0x00, 0x00,
+    0x40, 0x90, 0x00, 0x00, 0x40, 0x88, 0x00, 0x00, 0x40, 0xA7, 0x00, 0x00,
+    0x80, 0x99, 0x00, 0x00, 0x40, 0x85, 0x00, 0x00, 0x40, 0x97, 0x00, 0x00,
+    0x40, 0x8C, 0x00, 0x00, 0x40, 0xB1, 0x00, 0x00, 0x40, 0x88, 0x00, 0x00,
+    0x40, 0xA3, 0x00, 0x00, 0x40, 0x90, 0x00, 0x00, 0x40, 0x88, 0x00, 0x00,
+    0x40, 0xA7, 0x00, 0x00, 0x80, 0x99, 0x00, 0x00, 0x40, 0x85, 0x00, 0x00,
+    0x40, 0x97, 0x00, 0x00, 0x40, 0x8C, 0x00, 0x00, 0x40, 0xB1, 0x00, 0x0A,
+    0x40, 0x00, 0x44, 0x00, 0x00, 0x40, 0xA3, 0x00, 0x00, 0x40, 0x90, 0x00,
+    0x00, 0x40, 0x88, 0x00, 0x00, 0x40, 0xA7, 0x00, 0x00, 0x80, 0x99, 0x00,
+    0x00, 0x40, 0x85, 0x00, 0x00, 0x40, 0x86, 0x00, 0x85, 0x04, 0x8A, 0x00,
+    0x00, 0x40, 0x8C, 0x00, 0x00, 0x40, 0x8A, 0x00, 0x84, 0x04, 0xA1, 0x00,
+    0x09, 0x40, 0x00, 0x44, 0x00, 0x04, 0x86, 0x00, 0x84, 0x04, 0x86, 0x00,
+    0x08, 0x44, 0x40, 0x00, 0x44, 0x40, 0x88, 0x00, 0x00, 0x40, 0x8A, 0x00,
+    0x06, 0x44, 0x44, 0x00, 0x40, 0x88, 0x00, 0x00, 0x40, 0xA7, 0x00, 0x00,
+    0x80, 0x99, 0x00, 0x00, 0x40, 0x85, 0x00, 0x00, 0x40, 0x85, 0x00, 0x07,
+    0x44, 0x00, 0x00, 0x44, 0x89, 0x00, 0x00, 0x40, 0x8C, 0x00, 0x00, 0x40,
+    0x89, 0x00, 0x00, 0x40, 0x84, 0x00, 0x00, 0x40, 0xA0, 0x00, 0x09, 0x40,
+    0x00, 0x44, 0x40, 0x04, 0x85, 0x00, 0x00, 0x40, 0x84, 0x00, 0x00, 0x40,
+    0x87, 0x00, 0x07, 0x40, 0x44, 0x00, 0x04, 0x87, 0x00, 0x00, 0x40, 0x88,
+    0x00, 0x08, 0x44, 0x00, 0x00, 0x40, 0x40, 0x88, 0x00, 0x00, 0x40, 0xA7,
+    0x00, 0x00, 0x80, 0x99, 0x00, 0x87, 0x04, 0x84, 0x00, 0x00, 0x40, 0x87,
+    0x00, 0x00, 0x40, 0x88, 0x00, 0x00, 0x40, 0x8C, 0x00, 0x00, 0x40, 0x88,
+    0x00, 0x00, 0x40, 0x86, 0x00, 0x00, 0x40, 0x9F, 0x00, 0x09, 0x40, 0x00,
+    0x40, 0x40, 0x04, 0x84, 0x00, 0x00, 0x40, 0x86, 0x00, 0x00, 0x40, 0x86,
+    0x00, 0x02, 0x44, 0x40, 0x8C, 0x00, 0x00, 0x40, 0x88, 0x00, 0x00, 0x40,
+    0x85, 0x00, 0x01, 0x44, 0x88, 0x00, 0x00, 0x40, 0xA8, 0x00, 0x00, 0x80,
+    0x98, 0x00, 0x00, 0x40, 0x85, 0x00, 0x00, 0x40, 0x84, 0x00, 0x00, 0x40,
+    0x87, 0x00, 0x00, 0x40, 0x88, 0x00, 0x00, 0x40, 0x8C, 0x00, 0x00, 0x40,
+    0x87, 0x00, 0x00, 0x40, 0x88, 0x00, 0x00, 0x40, 0x9E, 0x00, 0x0E, 0x40,
+    0x04, 0x00, 0x40, 0x04, 0x00, 0x00, 0x40, 0x88, 0x00, 0x00, 0x40, 0x85,
+    0x00, 0x00, 0x40, 0x8E, 0x00, 0x00, 0x40, 0x87, 0x00, 0x00, 0x40, 0x87,
+    0x00, 0x00, 0x40, 0x88, 0x00, 0x00, 0x40, 0xA8, 0x00, 0x00, 0x80, 0x98,
+    0x00, 0x00, 0x40, 0x85, 0x00, 0x00, 0x40, 0x84, 0x00, 0x89, 0x04, 0x88,
+    0x00, 0x00, 0x40, 0x8C, 0x00, 0x00, 0x40, 0x87, 0x00, 0x00, 0x40, 0x88,
+    0x00, 0x00, 0x40, 0x9E, 0x00, 0x0E, 0x40, 0x04, 0x00, 0x40, 0x04, 0x00,
+    0x00, 0x40, 0x88, 0x00, 0x00, 0x40, 0x85, 0x00, 0x00, 0x40, 0x8E, 0x00,
+    0x00, 0x40, 0x87, 0x00, 0x00, 0x40, 0x87, 0x00, 0x00, 0x40, 0x88, 0x00,
+    0x00, 0x40, 0xA8, 0x00, 0x00, 0x80, 0x98, 0x00, 0x00, 0x40, 0x85, 0x00,
+    0x00, 0x40, 0x84, 0x00, 0x00, 0x40, 0x91, 0x00, 0x00, 0x40, 0x8C, 0x00,
+    0x00, 0x40, 0x87, 0x00, 0x00, 0x40, 0x88, 0x00, 0x00, 0x40, 0x9E, 0x00,
+    0x0E, 0x40, 0x04, 0x00, 0x04, 0x04, 0x00, 0x00, 0x40, 0x88, 0x00, 0x00,
+    0x40, 0x85, 0x00, 0x00, 0x40, 0x8E, 0x00, 0x00, 0x40, 0x87, 0x00, 0x00,
+    0x40, 0x87, 0x00, 0x00, 0x40, 0xB2, 0x00, 0x00, 0x80, 0x98, 0x00, 0x00,
+    0x40, 0x85, 0x00, 0x00, 0x40, 0x84, 0x00, 0x00, 0x40, 0x91, 0x00, 0x00,
+    0x40, 0x8C, 0x00, 0x00, 0x40, 0x87, 0x00, 0x00, 0x40, 0x88, 0x00, 0x00,
+    0x40, 0x85, 0x00, 0x02, 0x44, 0x40, 0x96, 0x00, 0x0D, 0x44, 0x00, 0x00,
+    0x40, 0x40, 0x00, 0x04, 0x88, 0x00, 0x00, 0x40, 0x85, 0x00, 0x00, 0x40,
+    0x8E, 0x00, 0x00, 0x40, 0x87, 0x00, 0x00, 0x40, 0x87, 0x00, 0x00, 0x40,
+    0xB2, 0x00, 0x00, 0x80, 0x98, 0x00, 0x00, 0x40, 0x85, 0x00, 0x00, 0x40,
+    0x84, 0x00, 0x01, 0x44, 0x90, 0x00, 0x00, 0x40, 0x8C, 0x00, 0x00, 0x40,
+    0x88, 0x00, 0x00, 0x40, 0x86, 0x00, 0x00, 0x40, 0x85, 0x00, 0x02, 0x44,
+    0x40, 0x97, 0x00, 0x08, 0x44, 0x00, 0x00, 0x40, 0x40, 0x84, 0x00, 0x00,
+    0x40, 0x86, 0x00, 0x00, 0x40, 0x86, 0x00, 0x00, 0x40, 0x8E, 0x00, 0x00,
+    0x40, 0x88, 0x00, 0x00, 0x40, 0x85, 0x00, 0x01, 0x44, 0xB3, 0x00, 0x00,
+    0x80, 0x97, 0x00, 0x00, 0x40, 0x85, 0x00, 0x00, 0x40, 0x85, 0x00, 0x01,
+    0x44, 0x84, 0x00, 0x01, 0x44, 0x88, 0x00, 0x00, 0x40, 0x8C, 0x00, 0x00,
+    0x40, 0x89, 0x00, 0x00, 0x40, 0x84, 0x00, 0x00, 0x40, 0x86, 0x00, 0x02,
+    0x44, 0x40, 0x97, 0x00, 0x08, 0x44, 0x00, 0x00, 0x44, 0x40, 0x85, 0x00,
+    0x00, 0x40, 0x84, 0x00, 0x00, 0x40, 0x87, 0x00, 0x00, 0x40, 0x8E, 0x00,
+    0x00, 0x40, 0x88, 0x00, 0x08, 0x44, 0x00, 0x00, 0x40, 0x40, 0x87, 0x00,
+    0x02, 0x44, 0x40, 0xA8, 0x00, 0x00, 0x80, 0x96, 0x00, 0x09, 0x44, 0x40,
+    0x00, 0x04, 0x44, 0x86, 0x00, 0x84, 0x04, 0x86, 0x00, 0x88, 0x04, 0x84,
+    0x00, 0x88, 0x04, 0x86, 0x00, 0x84, 0x04, 0x87, 0x00, 0x01, 0x44, 0x98,
+    0x00, 0x01, 0x44, 0x84, 0x00, 0x00, 0x40, 0x87, 0x00, 0x84, 0x04, 0x86,
+    0x00, 0x86, 0x04, 0x86, 0x00, 0x88, 0x04, 0x86, 0x00, 0x07, 0x44, 0x44,
+    0x00, 0x44, 0x86, 0x00, 0x02, 0x44, 0x40, 0xA8, 0x00, 0x00, 0x80, 0xC0,
+    0x5D, 0x00, 0x02, 0x44, 0x40, 0xC0, 0x8D, 0x00, 0x00, 0x80, 0xC0, 0x5D,
+    0x00, 0x01, 0x44, 0xC0, 0x8E, 0x00, 0x00, 0x80, 0xC0, 0x5D, 0x00, 0x00,
+    0x40, 0xC0, 0x90, 0x00, 0x00, 0x80, 0xC0, 0xEE, 0x00, 0x00, 0x80, 0xC0,
+    0xEE, 0x00, 0x00, 0x80, 0xC0, 0xEE, 0x00, 0x00, 0x80, 0xC0, 0xEE, 0x00,
+    0x00, 0x80, 0xC0, 0xEF, 0x00, 0x00, 0x80, 0xC0, 0xEE, 0x00, 0x00, 0x80,
+    0xC0, 0xEE, 0x00, 0x00, 0x80, 0xC0, 0xEE, 0x00, 0x00, 0x80, 0xC0, 0xEE,
+    0x00, 0x00, 0x80, 0xC0, 0xEF, 0x00, 0x00, 0x80, 0xC0, 0xEE, 0x00, 0x00,
+    0x80, 0xC0, 0xEE, 0x00, 0x00, 0x80, 0xC0, 0xEE, 0x00, 0x00, 0x80, 0xC0,
+    0xEE, 0x00, 0x00, 0x80, 0xC0, 0xEF, 0x00, 0x00, 0x80, 0xC0, 0xEE, 0x00,
+    0x00, 0x80, 0xC0, 0xEE, 0x00, 0x00, 0x80, 0xC0, 0xEE, 0x00, 0x00, 0x80,
+    0xC0, 0xEE, 0x00, 0x00, 0x80, 0xC0, 0xEF, 0x00, 0x00, 0x80, 0xC0, 0xEE,
+    0x00, 0x00, 0x80, 0xC0, 0xEE, 0x00, 0x00, 0x80, 0xA2, 0x00, 0x03, 0x44,
+    0x44, 0x88, 0x00, 0x84, 0x04, 0x9A, 0x00, 0x01, 0x44, 0x87, 0x00, 0x86,
+    0x04, 0x89, 0x00, 0x84, 0x04, 0xC0, 0x7E, 0x00, 0x00, 0x80, 0x95, 0x00,
+    0x01, 0x44, 0x89, 0x00, 0x05, 0x40, 0x00, 0x04, 0x86, 0x00, 0x00, 0x40,
+    0x84, 0x00, 0x00, 0x40, 0x98, 0x00, 0x02, 0x40, 0x40, 0x87, 0x00, 0x00,
+    0x40, 0x8E, 0x00, 0x01, 0x44, 0xC0, 0x82, 0x00, 0x00, 0x80, 0x94, 0x00,
+    0x02, 0x44, 0x40, 0x88, 0x00, 0x00, 0x40, 0x84, 0x00, 0x01, 0x44, 0x8C,
+    0x00, 0x00, 0x40, 0x97, 0x00, 0x02, 0x40, 0x40, 0x87, 0x00, 0x00, 0x40,
+    0x8D, 0x00, 0x00, 0x40, 0xC0, 0x85, 0x00, 0x00, 0x80, 0x93, 0x00, 0x02,
+    0x40, 0x40, 0x88, 0x00, 0x00, 0x40, 0x85, 0x00, 0x00, 0x40, 0x8C, 0x00,
+    0x00, 0x40, 0x96, 0x00, 0x03, 0x40, 0x04, 0x87, 0x00, 0x00, 0x40, 0x8C,
+    0x00, 0x00, 0x40, 0xC0, 0x86, 0x00, 0x00, 0x80, 0x92, 0x00, 0x03, 0x40,
+    0x04, 0x8F, 0x00, 0x00, 0x40, 0x8C, 0x00, 0x00, 0x40, 0x95, 0x00, 0x04,
+    0x40, 0x00, 0x40, 0x87, 0x00, 0x00, 0x40, 0x8C, 0x00, 0x00, 0x40, 0xC0,
+    0x86, 0x00, 0x00, 0x80, 0x95, 0x00, 0x00, 0x40, 0x8E, 0x00, 0x01, 0x44,
+    0x8B, 0x00, 0x00, 0x40, 0x96, 0x00, 0x04, 0x40, 0x00, 0x40, 0x87, 0x00,
+    0x05, 0x40, 0x44, 0x44, 0x86, 0x00, 0x00, 0x40, 0xC0, 0x87, 0x00, 0x00,
+    0x80, 0x95, 0x00, 0x00, 0x40, 0x8E, 0x00, 0x00, 0x40, 0x89, 0x00, 0x02,
+    0x44, 0x40, 0x96, 0x00, 0x05, 0x40, 0x00, 0x04, 0x87, 0x00, 0x06, 0x44,
+    0x00, 0x04, 0x40, 0x85, 0x00, 0x06, 0x40, 0x04, 0x44, 0x40, 0xC0, 0x81,
+    0x00, 0x00, 0x80, 0x95, 0x00, 0x00, 0x40, 0x8D, 0x00, 0x00, 0x40, 0x8D,
+    0x00, 0x00, 0x40, 0x95, 0x00, 0x05, 0x40, 0x00, 0x04, 0x8D, 0x00, 0x01,
+    0x44, 0x84, 0x00, 0x07, 0x40, 0x40, 0x00, 0x44, 0xC0, 0x81, 0x00, 0x00,
+    0x80, 0x94, 0x00, 0x00, 0x40, 0x8C, 0x00, 0x00, 0x40, 0x8F, 0x00, 0x00,
+    0x40, 0x93, 0x00, 0x00, 0x40, 0x84, 0x00, 0x00, 0x40, 0x8E, 0x00, 0x00,
+    0x40, 0x84, 0x00, 0x01, 0x44, 0x84, 0x00, 0x01, 0x44, 0xC0, 0x80, 0x00,
+    0x00, 0x80, 0x94, 0x00, 0x00, 0x40, 0x8B, 0x00, 0x01, 0x44, 0x90, 0x00,
+    0x00, 0x40, 0x92, 0x00, 0x00, 0x40, 0x84, 0x00, 0x00, 0x40, 0x8E, 0x00,
+    0x00, 0x40, 0x84, 0x00, 0x01, 0x44, 0x85, 0x00, 0x00, 0x40, 0xC0, 0x80,
+    0x00, 0x00, 0x80, 0x94, 0x00, 0x00, 0x40, 0x8A, 0x00, 0x01, 0x44, 0x91,
+    0x00, 0x00, 0x40, 0x92, 0x00, 0x87, 0x04, 0x8D, 0x00, 0x00, 0x40, 0x84,
+    0x00, 0x00, 0x40, 0x86, 0x00, 0x00, 0x40, 0xC0, 0x80, 0x00, 0x00, 0x80,
+    0x94, 0x00, 0x00, 0x40, 0x89, 0x00, 0x01, 0x44, 0x92, 0x00, 0x00, 0x40,
+    0x86, 0x00, 0x02, 0x44, 0x40, 0x8E, 0x00, 0x00, 0x40, 0x8E, 0x00, 0x00,
+    0x40, 0x85, 0x00, 0x00, 0x40, 0x85, 0x00, 0x00, 0x40, 0xC0, 0x80, 0x00,
+    0x00, 0x80, 0x94, 0x00, 0x00, 0x40, 0x88, 0x00, 0x01, 0x44, 0x84, 0x00,
+    0x00, 0x40, 0x8C, 0x00, 0x01, 0x44, 0x85, 0x00, 0x02, 0x44, 0x40, 0x8F,
+    0x00, 0x00, 0x40, 0x86, 0x00, 0x00, 0x40, 0x85, 0x00, 0x00, 0x40, 0x86,
+    0x00, 0x00, 0x40, 0x84, 0x00, 0x01, 0x44, 0xC0, 0x81, 0x00, 0x00, 0x80,
+    0x93, 0x00, 0x00, 0x40, 0x87, 0x00, 0x01, 0x44, 0x85, 0x00, 0x00, 0x40,
+    0x85, 0x00, 0x07, 0x44, 0x00, 0x00, 0x44, 0x86, 0x00, 0x02, 0x44, 0x40,
+    0x8F, 0x00, 0x00, 0x40, 0x86, 0x00, 0x07, 0x44, 0x00, 0x00, 0x44, 0x87,
+    0x00, 0x05, 0x40, 0x00, 0x04, 0xC0, 0x82, 0x00, 0x00, 0x80, 0x90, 0x00,
+    0x86, 0x04, 0x84, 0x00, 0x88, 0x04, 0x86, 0x00, 0x84, 0x04, 0x88, 0x00,
+    0x01, 0x44, 0x8E, 0x00, 0x03, 0x44, 0x44, 0x87, 0x00, 0x03, 0x44, 0x44,
+    0x8A, 0x00, 0x03, 0x44, 0x44, 0xC0, 0x83, 0x00, 0x00, 0x80, 0xB9, 0x00,
+    0x02, 0x44, 0x40, 0xC0, 0xB1, 0x00, 0x00, 0x80, 0xB9, 0x00, 0x01, 0x44,
+    0xC0, 0xB2, 0x00, 0x00, 0x80, 0xB9, 0x00, 0x00, 0x40, 0xC0, 0xB4, 0x00,
+    0x00, 0x80, 0xC0, 0xEE, 0x00, 0x00, 0x80, 0xC0, 0xEE, 0x00, 0x00, 0x80,
+    0xC0, 0xEE, 0x00, 0x00, 0x80, 0xC0, 0xEE, 0x00, 0x00, 0x80, 0xC0, 0xEF,
+    0x00, 0x00, 0x80, 0xC0, 0xEE, 0x00, 0x00, 0x80, 0xC0, 0xA0, 0x00, 0x3E,
+    0x53, 0x65, 0x36, 0x50, 0x03, 0x40, 0x74, 0x74, 0x74, 0x56, 0x56, 0x56,
+    0x56, 0x03, 0x06, 0x53, 0x30, 0x55, 0x33, 0x34, 0x43, 0x30, 0x55, 0x36,
+    0x14, 0x73, 0x60, 0x50, 0x36, 0x05, 0x03, 0x60, 0x8E, 0x00, 0x00, 0x80,
+    0xC0, 0xA0, 0x00, 0x3F, 0x50, 0x05, 0x04, 0x66, 0x33, 0x06, 0x50, 0x30,
+    0x01, 0x00, 0x15, 0x00, 0x00, 0x30, 0x07, 0x03, 0x70, 0x64, 0x50, 0x50,
+    0x30, 0x05, 0x00, 0x15, 0x33, 0x05, 0x63, 0x00, 0x77, 0x04, 0x00, 0x05,
+    0x8D, 0x00, 0x00, 0x80, 0xC0, 0xA0, 0x00, 0x3E, 0x35, 0x40, 0x03, 0x70,
+    0x55, 0x63, 0x00, 0x51, 0x10, 0x40, 0x17, 0x10, 0x30, 0x00, 0x06, 0x01,
+    0x01, 0x54, 0x35, 0x06, 0x51, 0x33, 0x04, 0x70, 0x48, 0x65, 0x30, 0x08,
+    0x68, 0x65, 0x36, 0x50, 0x8E, 0x00, 0x00, 0x80, 0xC0, 0xA0, 0x00, 0x25,
+    0x36, 0x65, 0x33, 0x65, 0x03, 0x65, 0x36, 0x36, 0x30, 0x00, 0x05, 0x06,
+    0x33, 0x04, 0x40, 0x50, 0x80, 0x50, 0x56, 0x84, 0x00, 0x14, 0x50, 0x60,
+    0x30, 0x00, 0x44, 0x56, 0x03, 0x00, 0x00, 0x50, 0x60, 0x8E, 0x00, 0x00,
+    0x80, 0xC0, 0xA1, 0x00, 0x0F, 0x11, 0x35, 0x57, 0x76, 0x00, 0x44, 0x70,
+    0x44, 0x85, 0x00, 0x0A, 0x50, 0x50, 0x60, 0x60, 0x30, 0x30, 0x85, 0x00,
+    0x0A, 0x50, 0x50, 0x60, 0x60, 0x30, 0x30, 0x85, 0x00, 0x05, 0x50, 0x00,
+    0x35, 0x8E, 0x00, 0x00, 0x80, 0xC0, 0x9F, 0x00, 0x3E, 0x13, 0x30, 0x80,
+    0x10, 0x05, 0x07, 0x01, 0x03, 0x00, 0x50, 0x70, 0x10, 0x15, 0x31, 0x30,
+    0x40, 0x10, 0x73, 0x55, 0x03, 0x06, 0x05, 0x00, 0x30, 0x60, 0x50, 0x03,
+    0x34, 0x50, 0x37, 0x30, 0x30, 0x8F, 0x00, 0x00, 0x80, 0xC0, 0x9F, 0x00,
+    0x3F, 0x70, 0x30, 0x00, 0x05, 0x05, 0x05, 0x05, 0x07, 0x07, 0x07, 0x07,
+    0x07, 0x04, 0x47, 0x17, 0x30, 0x50, 0x00, 0x06, 0x00, 0x00, 0x50, 0x70,
+    0x05, 0x00, 0x00, 0x30, 0x05, 0x03, 0x00, 0x80, 0x71, 0x8E, 0x00, 0x00,
+    0x80, 0xC0, 0x9F, 0x00, 0x08, 0x70, 0x07, 0x06, 0x06, 0x30, 0x84, 0x06,
+    0x30, 0x56, 0x56, 0x06, 0x06, 0x44, 0x06, 0x06, 0x06, 0x04, 0x44, 0x60,
+    0x30, 0x00, 0x05, 0x06, 0x43, 0x05, 0x01, 0x00, 0x00, 0x50, 0x60, 0x30,
+    0x37, 0x30, 0x8F, 0x00, 0x00, 0x80, 0xC0, 0x9F, 0x00, 0x05, 0x40, 0x04,
+    0x05, 0x84, 0x00, 0x2E, 0x50, 0x50, 0x64, 0x35, 0x75, 0x37, 0x07, 0x06,
+    0x03, 0x53, 0x30, 0x04, 0x04, 0x40, 0x30, 0x30, 0x60, 0x60, 0x60, 0x60,
+    0x50, 0x50, 0x50, 0x50, 0x95, 0x00, 0x00, 0x80, 0xC0, 0xA0, 0x00, 0x3C,
+    0x17, 0x13, 0x10, 0x40, 0x30, 0x05, 0x08, 0x05, 0x10, 0x71, 0x50, 0x70,
+    0x10, 0x30, 0x31, 0x30, 0x40, 0x15, 0x13, 0x10, 0x80, 0x60, 0x05, 0x04,
+    0x07, 0x08, 0x15, 0x00, 0x50, 0x50, 0x60, 0x90, 0x00, 0x00, 0x80, 0xC0,
+    0x9E, 0x00, 0x11, 0x60, 0x71, 0x70, 0x44, 0x00, 0x04, 0x45, 0x13, 0x57,
+    0x84, 0x00, 0x26, 0x71, 0x13, 0x05, 0x50, 0x00, 0x05, 0x07, 0x03, 0x00,
+    0x50, 0x70, 0x30, 0x00, 0x50, 0x07, 0x00, 0x10, 0x01, 0x00, 0x30, 0x91,
+    0x00, 0x00, 0x80, 0xC0, 0x9E, 0x00, 0x02, 0x44, 0x40, 0x85, 0x00, 0x2B,
+    0x44, 0x45, 0x00, 0x70, 0x01, 0x00, 0x30, 0x03, 0x00, 0x30, 0x05, 0x01,
+    0x03, 0x00, 0x50, 0x60, 0x00, 0x01, 0x77, 0x06, 0x06, 0x03, 0x84, 0x00,
+    0x02, 0x30, 0x30, 0xC0, 0xB9, 0x00, 0x38, 0x35, 0x07, 0x03, 0x51, 0x33,
+    0x08, 0x06, 0x03, 0x51, 0x66, 0x86, 0x63, 0x35, 0x56, 0x14, 0x00, 0x00,
+    0x60, 0x30, 0x04, 0x51, 0x40, 0x00, 0x50, 0x05, 0x00, 0x36, 0x00, 0x50,
+    0xC0, 0xAF, 0x00, 0x3D, 0x50, 0x63, 0x00, 0x05, 0x05, 0x00, 0x34, 0x70,
+    0x50, 0x06, 0x03, 0x00, 0x05, 0x60, 0x31, 0x73, 0x40, 0x44, 0x00, 0x33,
+    0x03, 0x60, 0x65, 0x05, 0x03, 0x34, 0x56, 0x07, 0x50, 0x70, 0x08, 0xC0,
+    0xB1, 0x00, 0x3F, 0x60, 0x35, 0x08, 0x44, 0x00, 0x37, 0x50, 0x45, 0x08,
+    0x03, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0x60, 0x05, 0x03, 0x03, 0x10,
+    0x04, 0x50, 0x47, 0x30, 0x55, 0x03, 0x06, 0x50, 0x80, 0x35, 0x08, 0xC0,
+    0xB0, 0x00, 0x3E, 0x35, 0x08, 0x03, 0x50, 0x80, 0x65, 0x31, 0x40, 0x04,
+    0x45, 0x00, 0x30, 0x36, 0x00, 0x50, 0x00, 0x03, 0x40, 0x66, 0x05, 0x00,
+    0x00, 0x30, 0x06, 0x03, 0x50, 0x14, 0x45, 0x04, 0x47, 0x00, 0x80, 0xC0,
+    0xB1, 0x00, 0x3D, 0x60, 0x05, 0x00, 0x00, 0x34, 0x06, 0x60, 0x50, 0x00,
+    0x03, 0x00, 0x60, 0x05, 0x03, 0x40, 0x00, 0x34, 0x57, 0x33, 0x03, 0x70,
+    0x60, 0x03, 0x00, 0x60, 0x05, 0x00, 0x01, 0x40, 0x01, 0x03, 0xC0, 0xAF,
+    0x00, 0x3E, 0x60, 0x61, 0x05, 0x17, 0x00, 0x73, 0x80, 0x65, 0x03, 0x06,
+    0x50, 0x30, 0x64, 0x43, 0x06, 0x50, 0x30, 0x65, 0x03, 0x06, 0x50, 0x10,
+    0x40, 0x47, 0x60, 0x50, 0x03, 0x06, 0x05, 0x00, 0x30, 0x60, 0xC0, 0xB0,
+    0x00, 0x3F, 0x50, 0x03, 0x34, 0x50, 0x04, 0x70, 0x30, 0x06, 0x00, 0x50,
+    0x00, 0x03, 0x00, 0x60, 0x05, 0x00, 0x30, 0x36, 0x06, 0x50, 0x57, 0x10,
+    0x45, 0x00, 0x43, 0x75, 0x05, 0x53, 0x05, 0x60, 0x55, 0x05, 0xC0, 0xB1,
+    0x00, 0x3D, 0x85, 0x07, 0x70, 0x51, 0x05, 0x30, 0x50, 0x05, 0x00, 0x50,
+    0x54, 0x04, 0x40, 0x05, 0x00, 0x00, 0x30, 0x06, 0x00, 0x50, 0x00, 0x03,
+    0x00, 0x60, 0x05, 0x05, 0x00, 0x30, 0x36, 0x01, 0x44, 0xC0, 0xAF, 0x00,
+    0x3F, 0x50, 0x70, 0x11, 0x03, 0x35, 0x35, 0x60, 0x65, 0x03, 0x65, 0x53,
+    0x35, 0x50, 0x66, 0x58, 0x36, 0x30, 0x30, 0x05, 0x00, 0x65, 0x03, 0x40,
+    0x15, 0x70, 0x47, 0x06, 0x80, 0x68, 0x06, 0x50, 0x65, 0xC0, 0xAF, 0x00,
+    0x3E, 0x56, 0x55, 0x65, 0x66, 0x51, 0x65, 0x36, 0x50, 0x65, 0x06, 0x50,
+    0x74, 0x07, 0x04, 0x01, 0x05, 0x70, 0x75, 0x06, 0x00, 0x30, 0x03, 0x00,
+    0x30, 0x03, 0x00, 0x30, 0x03, 0x50, 0x67, 0x07, 0x10, 0xC0, 0xB0, 0x00,
+    0x3F, 0x50, 0x40, 0x44, 0x30, 0x75, 0x08, 0x03, 0x50, 0x80, 0x15, 0x33,
+    0x45, 0x50, 0x30, 0x05, 0x03, 0x00, 0x50, 0x17, 0x00, 0x04, 0x01, 0x05,
+    0x70, 0x75, 0x06, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0xC0, 0xB1, 0x00,
+    0x3D, 0x30, 0x03, 0x50, 0x67, 0x07, 0x10, 0x53, 0x40, 0x05, 0x03, 0x43,
+    0x10, 0x70, 0x44, 0x05, 0x30, 0x50, 0x55, 0x05, 0x50, 0x55, 0x05, 0x53,
+    0x04, 0x70, 0x51, 0x05, 0x30, 0x50, 0x05, 0x05, 0xC5, 0xB9, 0x00 };
+
+const LCD_Image DemoImage = { DemoImagePalette, DemoImageData, 240, 320, 4 };
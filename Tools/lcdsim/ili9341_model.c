@@ -0,0 +1,350 @@
+/**
+ * @file    ili9341_model.c
+ * @brief   Host side model of the ILI9341 command decoder. Decodes the SPI
+ *          byte stream into a 240x320 RGB565 panel memory and counts traffic.
+ */
+
+/**
+ ******************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2021 John Vedder
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************
+ */
+
+#include "ili9341_model.h"
+#include <stdio.h>
+#include <string.h>
+
+/* Values for MADCTL, same as lcd.c */
+#define MADCTL_MY   0x80
+#define MADCTL_MX   0x40
+#define MADCTL_MV   0x20
+
+#define CMD_CASET   0x2A
+#define CMD_PASET   0x2B
+#define CMD_RAMWR   0x2C
+#define CMD_RAMWRC  0x3C    // Write Memory Continue
+#define CMD_VSCRDEF 0x33
+#define CMD_MADCTL  0x36
+#define CMD_VSCRSADD 0x37
+
+ILI_Stats ILI_stats;
+
+/*
+ * Private Variables
+ */
+static uint16_t ILI_mem[ILI_ROWS][ILI_COLS];  // Panel memory
+static uint8_t ILI_cs;          // non-zero while CS is active
+static uint8_t ILI_dc;          // non-zero for data bytes
+static uint8_t ILI_cmd;         // Command being decoded
+static uint8_t ILI_param[16];   // Parameters received for ILI_cmd
+static uint8_t ILI_nparam;      // Number of parameters received
+static uint8_t ILI_writing;     // non-zero after RAMWR
+static uint8_t ILI_hiByte;      // First byte of a pixel
+static uint8_t ILI_haveHi;      // non-zero when ILI_hiByte is valid
+static uint8_t ILI_madctl;
+static uint16_t ILI_xs, ILI_xe, ILI_ys, ILI_ye;  // Address window
+static uint16_t ILI_x, ILI_y;                    // Write pointer
+static uint16_t ILI_tfa, ILI_vsa, ILI_bfa, ILI_vsp;
+
+/*
+ * Private Function Prototypes
+ */
+static void ILI_Map( uint16_t x, uint16_t y, uint8_t madctl, uint16_t *col,
+        uint16_t *row );
+static uint16_t ILI_ScrolledRow( uint16_t row );
+static void ILI_Parameter( uint8_t b );
+static void ILI_WritePixel( uint16_t color );
+
+/**
+ * Power on reset of the model. Panel memory is cleared to black.
+ */
+void ILI_Reset( void )
+{
+    memset( ILI_mem, 0, sizeof( ILI_mem ) );
+    ILI_cs = 0;
+    ILI_dc = 1;
+    ILI_writing = 0;
+    ILI_haveHi = 0;
+    ILI_madctl = 0;
+    ILI_xs = 0;
+    ILI_xe = ILI_COLS - 1;
+    ILI_ys = 0;
+    ILI_ye = ILI_ROWS - 1;
+    ILI_tfa = 0;
+    ILI_vsa = ILI_ROWS;
+    ILI_bfa = 0;
+    ILI_vsp = 0;
+    ILI_ResetStats( );
+}
+
+/**
+ * Clears the traffic counters.
+ */
+void ILI_ResetStats( void )
+{
+    memset( &ILI_stats, 0, sizeof( ILI_stats ) );
+}
+
+/**
+ * Chip select line. A new transaction ends any memory write in progress.
+ */
+void ILI_SetCS( uint8_t active )
+{
+    active = active ? 1 : 0;
+    if ( active != ILI_cs )
+    {
+        ILI_stats.csToggles++;
+        if ( active )
+        {
+            ILI_stats.transactions++;
+            ILI_writing = 0;
+        }
+        ILI_haveHi = 0;
+    }
+    ILI_cs = active;
+}
+
+/**
+ * Data/Command line.
+ */
+void ILI_SetDC( uint8_t data )
+{
+    data = data ? 1 : 0;
+    if ( data != ILI_dc ) ILI_stats.dcToggles++;
+    ILI_dc = data;
+}
+
+/**
+ * One byte clocked in on MOSI.
+ */
+void ILI_WriteByte( uint8_t b )
+{
+    if ( !ILI_cs ) return;
+
+    ILI_stats.bytes++;
+    if ( !ILI_dc )
+    {
+        ILI_stats.cmdBytes++;
+        ILI_stats.cmdCount[b]++;
+        ILI_cmd = b;
+        ILI_nparam = 0;
+        ILI_haveHi = 0;
+        ILI_writing = 0;
+        if ( b == CMD_RAMWR )
+        {
+            ILI_x = ILI_xs;
+            ILI_y = ILI_ys;
+            ILI_writing = 1;
+        }
+        else if ( b == CMD_RAMWRC )
+        {
+            ILI_writing = 1;
+        }
+        return;
+    }
+
+    ILI_stats.dataBytes++;
+    if ( ILI_writing )
+    {
+        if ( ILI_haveHi )
+        {
+            ILI_WritePixel( ( ILI_hiByte << 8 ) | b );
+            ILI_haveHi = 0;
+        }
+        else
+        {
+            ILI_hiByte = b;
+            ILI_haveHi = 1;
+        }
+    }
+    else
+    {
+        ILI_Parameter( b );
+    }
+}
+
+/**
+ * Returns the pixel shown on the glass at (x,y) in the coordinate system of
+ * the given rotation (see LCD_SetRotation()), after vertical scrolling.
+ */
+uint16_t ILI_GetPixel( uint16_t x, uint16_t y, uint8_t rotation )
+{
+    static const uint8_t madctl[4] =
+    { MADCTL_MX, MADCTL_MV, MADCTL_MY, MADCTL_MX | MADCTL_MY | MADCTL_MV };
+    uint16_t col;
+    uint16_t row;
+
+    ILI_Map( x, y, madctl[rotation & 3], &col, &row );
+    if ( col >= ILI_COLS || row >= ILI_ROWS ) return 0;
+    return ILI_mem[ILI_ScrolledRow( row )][col];
+}
+
+/**
+ * Writes what is shown on the glass to a binary PPM file.
+ *
+ * @returns 0 on success
+ */
+int ILI_DumpPPM( const char *path, uint8_t rotation )
+{
+    uint16_t w = ( rotation & 1 ) ? ILI_ROWS : ILI_COLS;
+    uint16_t h = ( rotation & 1 ) ? ILI_COLS : ILI_ROWS;
+    FILE *f = fopen( path, "wb" );
+    uint16_t x;
+    uint16_t y;
+
+    if ( f == NULL ) return 1;
+    fprintf( f, "P6\n%u %u\n255\n", w, h );
+    for ( y = 0; y < h; y++ )
+    {
+        for ( x = 0; x < w; x++ )
+        {
+            uint16_t c = ILI_GetPixel( x, y, rotation );
+            uint8_t rgb[3];
+            rgb[0] = ( ( c >> 11 ) & 0x1F ) * 255 / 31;
+            rgb[1] = ( ( c >> 5 ) & 0x3F ) * 255 / 63;
+            rgb[2] = ( c & 0x1F ) * 255 / 31;
+            fwrite( rgb, 1, 3, f );
+        }
+    }
+    fclose( f );
+    return 0;
+}
+
+/**
+ * Prints the traffic counters and simulated time on one line.
+ */
+void ILI_PrintStats( const char *name )
+{
+    printf( "%-28s %9u bytes %7u cmd %9u px %7u xact %8u HAL %9.3f ms\n",
+            name, ILI_stats.bytes, ILI_stats.cmdBytes, ILI_stats.pixels,
+            ILI_stats.transactions, ILI_stats.halCalls, ILI_timeNs / 1e6 );
+}
+
+/**
+ * -------------------
+ *  Private Functions
+ * -------------------
+ */
+
+/**
+ * Maps a CASET/PASET address to panel memory. The memory is stored as the
+ * viewer sees it in portrait, which is what MADCTL_MX alone produces.
+ */
+static void ILI_Map( uint16_t x, uint16_t y, uint8_t madctl, uint16_t *col,
+        uint16_t *row )
+{
+    uint16_t u = x;
+    uint16_t v = y;
+
+    if ( madctl & MADCTL_MV )
+    {
+        u = y;
+        v = x;
+    }
+    if ( madctl & MADCTL_MX ) u = ( ILI_COLS - 1 ) - u;
+    if ( madctl & MADCTL_MY ) v = ( ILI_ROWS - 1 ) - v;
+
+    *col = ( ILI_COLS - 1 ) - u;
+    *row = v;
+}
+
+/**
+ * Returns the memory row shown on glass row 'row' per VSCRDEF/VSCRSADD.
+ */
+static uint16_t ILI_ScrolledRow( uint16_t row )
+{
+    if ( row < ILI_tfa || row >= ILI_tfa + ILI_vsa || ILI_vsa == 0 )
+    {
+        return row;
+    }
+    if ( ILI_vsp < ILI_tfa || ILI_vsp >= ILI_tfa + ILI_vsa )
+    {
+        return row;
+    }
+    return ILI_tfa + ( row - ILI_tfa + ILI_vsp - ILI_tfa ) % ILI_vsa;
+}
+
+static void ILI_Parameter( uint8_t b )
+{
+    if ( ILI_nparam < sizeof( ILI_param ) )
+    {
+        ILI_param[ILI_nparam] = b;
+    }
+    ILI_nparam++;
+
+    switch ( ILI_cmd )
+    {
+        case CMD_CASET:
+            if ( ILI_nparam == 2 ) ILI_xs = ( ILI_param[0] << 8 ) | ILI_param[1];
+            if ( ILI_nparam == 4 ) ILI_xe = ( ILI_param[2] << 8 ) | ILI_param[3];
+            break;
+        case CMD_PASET:
+            if ( ILI_nparam == 2 ) ILI_ys = ( ILI_param[0] << 8 ) | ILI_param[1];
+            if ( ILI_nparam == 4 ) ILI_ye = ( ILI_param[2] << 8 ) | ILI_param[3];
+            break;
+        case CMD_MADCTL:
+            if ( ILI_nparam == 1 ) ILI_madctl = b;
+            break;
+        case CMD_VSCRDEF:
+            if ( ILI_nparam == 6 )
+            {
+                ILI_tfa = ( ILI_param[0] << 8 ) | ILI_param[1];
+                ILI_vsa = ( ILI_param[2] << 8 ) | ILI_param[3];
+                ILI_bfa = ( ILI_param[4] << 8 ) | ILI_param[5];
+                if ( ILI_tfa + ILI_vsa + ILI_bfa != ILI_ROWS )
+                {
+                    printf( "ILI9341: VSCRDEF %u+%u+%u != %u\n", ILI_tfa,
+                            ILI_vsa, ILI_bfa, ILI_ROWS );
+                }
+            }
+            break;
+        case CMD_VSCRSADD:
+            if ( ILI_nparam == 2 ) ILI_vsp = ( ILI_param[0] << 8 ) | ILI_param[1];
+            break;
+        default:
+            break;
+    }
+}
+
+static void ILI_WritePixel( uint16_t color )
+{
+    uint16_t col;
+    uint16_t row;
+
+    ILI_Map( ILI_x, ILI_y, ILI_madctl, &col, &row );
+    if ( col < ILI_COLS && row < ILI_ROWS )
+    {
+        ILI_mem[row][col] = color;
+    }
+    ILI_stats.pixels++;
+
+    // Advance the write pointer, wrapping within the address window
+    if ( ++ILI_x > ILI_xe )
+    {
+        ILI_x = ILI_xs;
+        if ( ++ILI_y > ILI_ye )
+        {
+            ILI_y = ILI_ys;
+        }
+    }
+}
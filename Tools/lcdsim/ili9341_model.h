@@ -0,0 +1,68 @@
+/**
+ * @file    ili9341_model.h
+ * @brief   Header file for the host side model of the ILI9341 command decoder
+ */
+
+/**
+ ******************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2021 John Vedder
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************
+ */
+
+#ifndef _ILI9341_MODEL_H
+#define _ILI9341_MODEL_H
+
+#include <stdint.h>
+
+#define ILI_COLS        240     // Panel memory columns
+#define ILI_ROWS        320     // Panel memory rows (pages)
+
+/**
+ * SPI traffic counters. Reset with ILI_ResetStats().
+ */
+typedef struct
+{
+    uint32_t bytes;         // All bytes clocked while CS was active
+    uint32_t cmdBytes;      // Bytes sent with D/C low
+    uint32_t dataBytes;     // Bytes sent with D/C high
+    uint32_t pixels;        // Pixels written to panel memory
+    uint32_t transactions;  // CS active (falling) edges
+    uint32_t csToggles;     // CS edges in either direction
+    uint32_t dcToggles;     // D/C edges in either direction
+    uint32_t halCalls;      // HAL SPI transmit calls (blocking or DMA)
+    uint32_t cmdCount[256]; // Number of times each command was received
+} ILI_Stats;
+
+extern ILI_Stats ILI_stats;
+extern uint64_t ILI_timeNs;   // Simulated elapsed time, see sim_hal.c
+
+void ILI_Reset( void );
+void ILI_ResetStats( void );
+void ILI_SetCS( uint8_t active );
+void ILI_SetDC( uint8_t data );
+void ILI_WriteByte( uint8_t b );
+uint16_t ILI_GetPixel( uint16_t x, uint16_t y, uint8_t rotation );
+int ILI_DumpPPM( const char *path, uint8_t rotation );
+void ILI_PrintStats( const char *name );
+
+#endif // _ILI9341_MODEL_H
@@ -0,0 +1,395 @@
+/**
+ * @file    lcdsim.c
+ * @brief   Host (Linux) harness that runs the LCD driver against the ILI9341
+ *          model, reports the SPI traffic of each LCD_* primitive and dumps
+ *          the panel to a PPM image.
+ */
+
+/**
+ ******************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2021 John Vedder
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************
+ */
+
+#include "main.h"
+#include "lcd.h"
+#include "bench.h"
+#include "dlist.h"
+#include "lcd_shapes.h"
+#include "lcd_bitmap.h"
+#include "lcd_text.h"
+#include "sprite.h"
+#include "console.h"
+#include "ili9341_model.h"
+#include "sim_hal.h"
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+// The demo screen of SIM_Primitives(), converted by Tools/imgconv
+#include "demo_image.h"
+
+#define SIM_DECODES     50      // Decodes timed for the host throughput
+#define SIM_MOVES       20      // Steps of the sprite measurement
+#define SIM_LINES       40      // Lines written to the console
+
+/*
+ * Private Function Prototypes
+ */
+static void SIM_Begin( void );
+static void SIM_End( const char *name );
+static void SIM_Primitives( void );
+static void SIM_Shapes( void );
+static void SIM_Sprites( void );
+static void SIM_Console( void );
+static void SIM_Image( void );
+
+/**
+ * Usage: lcdsim [-b] [image.ppm]
+ *   -b  also run the target benchmarks (bench.c) against the model
+ */
+int main( int argc, char **argv )
+{
+    const char *image = NULL;
+    int bench = 0;
+    int i;
+
+    for ( i = 1; i < argc; i++ )
+    {
+        if ( strcmp( argv[i], "-b" ) == 0 )
+        {
+            bench = 1;
+        }
+        else
+        {
+            image = argv[i];
+        }
+    }
+
+    SIM_Init( );
+    SIM_Begin( );
+    LCD_Init( );
+    SIM_End( "LCD_Init" );
+    LCD_SetRotation( 0 );
+
+    if ( bench )
+    {
+        BENCH_Run( );
+    }
+
+    SIM_Primitives( );
+    SIM_Sprites( );
+    SIM_Console( );
+    SIM_Image( );
+
+    if ( image != NULL && ILI_DumpPPM( image, LCD_rotation ) != 0 )
+    {
+        printf( "lcdsim: cannot write %s\n", image );
+        return 1;
+    }
+    return 0;
+}
+
+/**
+ * -------------------
+ *  Private Functions
+ * -------------------
+ */
+
+static void SIM_Begin( void )
+{
+    ILI_ResetStats( );
+    ILI_timeNs = 0;
+}
+
+static void SIM_End( const char *name )
+{
+    ILI_PrintStats( name );
+}
+
+/**
+ * SPI traffic of each of the drawing primitives. The last ones leave the
+ * demo screen of main.c on the panel.
+ */
+static void SIM_Primitives( void )
+{
+    int16_t i;
+
+    SIM_Begin( );
+    LCD_FillScreen( LCD_WHITE );
+    SIM_End( "LCD_FillScreen" );
+
+    SIM_Begin( );
+    for ( i = 0; i < 100; i++ )
+    {
+        LCD_DrawPixel( 10 + i, 10, LCD_RED );
+    }
+    SIM_End( "LCD_DrawPixel x100" );
+
+    SIM_Begin( );
+    LCD_DrawFillRect( 20, 20, 100, 50, LCD_BLUE );
+    SIM_End( "LCD_DrawFillRect 100x50" );
+
+    SIM_Begin( );
+    LCD_DrawRect( 20, 80, 100, 50, LCD_GREEN );
+    SIM_End( "LCD_DrawRect 100x50" );
+
+    SIM_Begin( );
+    LCD_DrawHLine( 0, 140, 240, LCD_BLACK );
+    SIM_End( "LCD_DrawHLine 240" );
+
+    SIM_Begin( );
+    LCD_DrawVLine( 130, 20, 110, LCD_BLACK );
+    SIM_End( "LCD_DrawVLine 110" );
+
+    SIM_Begin( );
+    LCD_DrawLine( 0, 150, 239, 200, LCD_MAGENTA );
+    SIM_End( "LCD_DrawLine shallow" );
+
+    SIM_Begin( );
+    LCD_DrawLine( 200, 150, 230, 300, LCD_MAGENTA );
+    SIM_End( "LCD_DrawLine steep" );
+
+    SIM_Shapes( );
+
+    // Any flash will do for the indexes, the palette is the primary colors
+    static const uint16_t palette[16] = { LCD_WHITE, LCD_RED, LCD_GREEN,
+            LCD_BLUE, LCD_CYAN, LCD_MAGENTA, LCD_YELLOW, LCD_BLACK, LCD_WHITE,
+            LCD_RED, LCD_GREEN, LCD_BLUE, LCD_CYAN, LCD_MAGENTA, LCD_YELLOW,
+            LCD_BLACK };
+    SIM_Begin( );
+    LCD_DrawIndexedBitmap( 150, 290, FreeMono12pt7b.bitmap, 64, 24, 4, palette );
+    SIM_End( "LCD_DrawIndexedBitmap 4bpp" );
+
+    LCD_font = &FreeMono12pt7b;
+    LCD_SetTextColors( LCD_BLACK, LCD_WHITE );
+    LCD_cursor_x = 0;
+    LCD_cursor_y = 240;
+    SIM_Begin( );
+    LCD_DrawText( (const uint8_t*) "Hello, World!" );
+    SIM_End( "LCD_DrawText 13 chars" );
+
+    LCD_cursor_x = 0;
+    LCD_cursor_y = 280;
+    SIM_Begin( );
+    LCD_DrawText( (const uint8_t*) "123,456" );
+    SIM_End( "LCD_DrawText touch readout" );
+
+    // "Olé, 23°C, 12€" in a font with Latin-1 and a few sparse characters
+    LCD_font = &LatoLatin12pt;
+    LCD_cursor_x = 0;
+    LCD_cursor_y = 240;
+    SIM_Begin( );
+    LCD_DrawTextUTF8( (const uint8_t*) "Ol\xC3\xA9, 23\xC2\xB0" "C, 12\xE2\x82\xAC" );
+    SIM_End( "LCD_DrawTextUTF8 14 chars" );
+    LCD_font = &FreeMono12pt7b;
+
+    // The same readout composited by the display list, as in main.c
+    static const uint8_t readout[] = "123,456";
+    LCD_Rect bounds;
+
+    DLIST_Clear( );
+    DLIST_SetBackground( LCD_WHITE );
+    DLIST_AddText( 0, 280, readout, LCD_BLACK );
+    LCD_GetTextBounds( 0, 280, readout, &bounds );
+    SIM_Begin( );
+    DLIST_Invalidate( bounds.x, bounds.y, bounds.w, bounds.h );
+    DLIST_Render( );
+    SIM_End( "DLIST_Render touch readout" );
+
+    // As a text field, where a new sample repaints the digits that changed
+    LCD_TextField field;
+
+    LCD_InitTextField( &field, 0, 280, LCD_BLACK, LCD_WHITE );
+    LCD_SetTextField( &field, readout );
+    SIM_Begin( );
+    LCD_SetTextField( &field, (const uint8_t*) "123,457" );
+    SIM_End( "LCD_SetTextField 1 digit" );
+    SIM_Begin( );
+    LCD_SetTextField( &field, (const uint8_t*) "124,467" );
+    SIM_End( "LCD_SetTextField 2 digits" );
+    LCD_SetTextField( &field, readout );
+}
+
+/**
+ * SPI traffic of the shapes of lcd_shapes.h, drawn in the empty area right
+ * of the rectangles.
+ */
+static void SIM_Shapes( void )
+{
+    static const LCD_Point star[] = { { 185, 165 }, { 191, 184 }, { 210, 184 },
+            { 195, 195 }, { 201, 214 }, { 185, 203 }, { 169, 214 }, { 175, 195 },
+            { 160, 184 }, { 179, 184 } };
+
+    SIM_Begin( );
+    LCD_DrawCircle( 160, 45, 25, LCD_RED );
+    SIM_End( "LCD_DrawCircle r25" );
+
+    SIM_Begin( );
+    LCD_FillCircle( 215, 45, 20, LCD_RED );
+    SIM_End( "LCD_FillCircle r20" );
+
+    SIM_Begin( );
+    LCD_DrawEllipse( 185, 95, 45, 15, LCD_BLUE );
+    SIM_End( "LCD_DrawEllipse 45x15" );
+
+    SIM_Begin( );
+    LCD_FillEllipse( 185, 95, 30, 8, LCD_CYAN );
+    SIM_End( "LCD_FillEllipse 30x8" );
+
+    SIM_Begin( );
+    LCD_FillRoundRect( 140, 115, 95, 40, 8, LCD_ORANGE );
+    SIM_End( "LCD_FillRoundRect 95x40" );
+
+    SIM_Begin( );
+    LCD_DrawRoundRect( 140, 115, 95, 40, 8, LCD_BLACK );
+    SIM_End( "LCD_DrawRoundRect 95x40" );
+
+    SIM_Begin( );
+    LCD_FillTriangle( 145, 160, 160, 215, 140, 200, LCD_GREEN );
+    SIM_End( "LCD_FillTriangle" );
+
+    SIM_Begin( );
+    LCD_DrawTriangle( 145, 160, 160, 215, 140, 200, LCD_BLACK );
+    SIM_End( "LCD_DrawTriangle" );
+
+    SIM_Begin( );
+    LCD_FillPolygon( star, sizeof( star ) / sizeof( star[0] ), LCD_YELLOW );
+    SIM_End( "LCD_FillPolygon star" );
+
+    SIM_Begin( );
+    LCD_DrawPolygon( star, sizeof( star ) / sizeof( star[0] ), LCD_BLACK );
+    SIM_End( "LCD_DrawPolygon star" );
+}
+
+/**
+ * SPI traffic of a 9x9 crosshair cursor moved 3 pixels at a time over a
+ * checkered tile background, against erasing it with a fill and drawing it
+ * again (which could not restore the tiles). SIM_Image() then restores the
+ * demo screen.
+ */
+static void SIM_Sprites( void )
+{
+    static const uint16_t tiles[2 * 8 * 8] = { [0 ... 63] = LCD_LIGHTGREY,
+            [64 ... 127] = LCD_DARKGREY };
+    static const uint8_t map[] = { 0, 1, 1, 0 };
+    static const SPRITE_TileMap tileMap = { tiles, map, 8, 8, 2, 2 };
+    static uint16_t cursor[9 * 9];
+    uint8_t sprite;
+    int16_t i;
+
+    for ( i = 0; i < 9 * 9; i++ )
+    {
+        cursor[i] = ( i / 9 == 4 || i % 9 == 4 ) ? LCD_RED : LCD_MAGENTA;
+    }
+
+    SPRITE_SetBackgroundTiles( &tileMap );
+    SIM_Begin( );
+    SPRITE_Repaint( 0, 0, LCD_width, LCD_height );
+    SIM_End( "SPRITE_Repaint tiled screen" );
+
+    sprite = SPRITE_Add( cursor, 9, 9, LCD_MAGENTA );
+    SPRITE_MoveTo( sprite, 20, 20 );
+    SPRITE_Show( sprite, 1 );
+    SPRITE_Update( );
+
+    SIM_Begin( );
+    for ( i = 1; i <= SIM_MOVES; i++ )
+    {
+        SPRITE_MoveTo( sprite, 20 + 3 * i, 20 + 2 * i );
+        SPRITE_Update( );
+    }
+    SIM_End( "SPRITE_Update cursor x20" );
+
+    SIM_Begin( );
+    for ( i = 1; i <= SIM_MOVES; i++ )
+    {
+        LCD_DrawFillRect( 17 + 3 * i, 18 + 2 * i, 9, 9, LCD_LIGHTGREY );
+        LCD_DrawHLine( 20 + 3 * i, 24 + 2 * i, 9, LCD_RED );
+        LCD_DrawVLine( 24 + 3 * i, 20 + 2 * i, 9, LCD_RED );
+    }
+    SIM_End( "Fill and redraw cursor x20" );
+
+    SPRITE_Remove( sprite );
+    SPRITE_Update( );
+}
+
+/**
+ * SPI traffic of a console below a 24 pixel header as it scrolls, against
+ * repainting its area for each line.
+ */
+static void SIM_Console( void )
+{
+    char line[32];
+    uint32_t area;
+    int i;
+
+    LCD_font = &FreeMono12pt7b;
+    CON_Open( 24, 0, LCD_GREEN, LCD_BLACK );
+    for ( i = 0; i < 20; i++ )
+    {
+        snprintf( line, sizeof( line ), "boot %d\n", i );
+        CON_Write( (const uint8_t*) line );
+    }
+
+    SIM_Begin( );
+    for ( i = 0; i < SIM_LINES; i++ )
+    {
+        snprintf( line, sizeof( line ), "%3d,%3d\n", i * 7, i * 5 );
+        CON_Write( (const uint8_t*) line );
+    }
+    SIM_End( "CON_Write 40 lines" );
+
+    area = (uint32_t) LCD_WIDTH * ( LCD_HEIGHT - 24 );
+    printf( "Console repaint of each line would send %lu bytes\n",
+            (unsigned long) ( SIM_LINES * ( 11 + 2 * area ) ) );
+    CON_Close( );
+}
+
+/**
+ * SPI traffic and host decode throughput of a compressed full screen image.
+ * The image is the screen SIM_Primitives() leaves, so drawing it leaves
+ * the panel unchanged if it decodes right.
+ */
+static void SIM_Image( void )
+{
+    clock_t start;
+    double seconds;
+    int i;
+
+    SIM_Begin( );
+    LCD_DrawImage( 0, 0, &DemoImage );
+    SIM_End( "LCD_DrawImage 240x320" );
+
+    start = clock( );
+    for ( i = 0; i < SIM_DECODES; i++ )
+    {
+        LCD_DrawImage( -40, 30, &DemoImage );
+    }
+    seconds = (double) ( clock( ) - start ) / CLOCKS_PER_SEC;
+    printf( "LCD_DrawImage clipped: %.1f Mpixels/s decoded on the host\n",
+            SIM_DECODES * ( DemoImage.width - 40.0 ) * DemoImage.height
+                    / seconds / 1e6 );
+
+    LCD_DrawImage( 0, 0, &DemoImage );
+}
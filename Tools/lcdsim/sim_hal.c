@@ -0,0 +1,202 @@
+/**
+ * @file    sim_hal.c
+ * @brief   Host stand-ins for the STM32 HAL functions used by the LCD driver
+ */
+
+/**
+ ******************************************************************************
+ * MIT License
+ *
+ * Copyright (c) 2021 John Vedder
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************
+ */
+
+#include "main.h"
+#include "spi.h"
+#include "ili9341_model.h"
+#include "sim_hal.h"
+#include <stdio.h>
+
+/*
+ * Timing model, in nanoseconds. The wire time follows from the 12 MBit/s SPI
+ * clock, the CPU costs are estimates for the HAL at 48 MHz and only matter
+ * when comparing paths with different numbers of HAL calls.
+ */
+#define SIM_NS_PER_BYTE     667     // 8 bits at 12 MBit/s
+#define SIM_NS_HAL_CALL     4000    // HAL_SPI_Transmit() entry, checks and end of transfer wait
+#define SIM_NS_DMA_SETUP    6000    // HAL_SPI_Transmit_DMA() plus the completion interrupt
+#define SIM_NS_GPIO         400     // HAL_GPIO_WritePin()
+
+SPI_HandleTypeDef hspi1;
+DMA_HandleTypeDef hdma_spi1_tx;
+
+uint64_t ILI_timeNs;
+uint32_t SystemCoreClock = 48000000;
+
+/*
+ * Private Variables
+ */
+static SPI_TypeDef SIM_spi1;                // Stands in for the SPI1 registers
+static DMA_Channel_TypeDef SIM_dmaChannel;  // Stands in for DMA1 Channel 3
+
+/**
+ * Sets up hspi1 and its DMA handle as MX_SPI1_Init() does on the target,
+ * and resets the panel model.
+ */
+void SIM_Init( void )
+{
+    hspi1.Instance = &SIM_spi1;
+    hspi1.Init.Mode = SPI_MODE_MASTER;
+    hspi1.Init.Direction = SPI_DIRECTION_2LINES;
+    hspi1.Init.DataSize = SPI_DATASIZE_8BIT;
+    hspi1.State = HAL_SPI_STATE_READY;
+    SIM_spi1.CR2 = SPI_DATASIZE_8BIT;
+
+    hdma_spi1_tx.Instance = &SIM_dmaChannel;
+    hdma_spi1_tx.Init.MemDataAlignment = DMA_MDATAALIGN_HALFWORD;
+    hdma_spi1_tx.Init.PeriphDataAlignment = DMA_PDATAALIGN_HALFWORD;
+    hdma_spi1_tx.Init.MemInc = DMA_MINC_ENABLE;
+    SIM_dmaChannel.CCR = DMA_MINC_ENABLE | DMA_MDATAALIGN_HALFWORD
+            | DMA_PDATAALIGN_HALFWORD;
+    hspi1.hdmatx = &hdma_spi1_tx;
+
+    ILI_Reset( );
+    ILI_timeNs = 0;
+}
+
+/**
+ * Blocking transmit. In 16-bit frame mode each frame is a native uint16_t
+ * sent high byte first.
+ */
+HAL_StatusTypeDef HAL_SPI_Transmit( SPI_HandleTypeDef *hspi, uint8_t *pData,
+        uint16_t Size, uint32_t Timeout )
+{
+    uint16_t i;
+
+    (void) Timeout;
+    ILI_stats.halCalls++;
+    ILI_timeNs += SIM_NS_HAL_CALL;
+    for ( i = 0; i < Size; i++ )
+    {
+        if ( hspi->Init.DataSize > SPI_DATASIZE_8BIT )
+        {
+            uint16_t frame = ( (uint16_t*) pData )[i];
+            ILI_WriteByte( frame >> 8 );
+            ILI_WriteByte( frame );
+            ILI_timeNs += 2 * SIM_NS_PER_BYTE;
+        }
+        else
+        {
+            ILI_WriteByte( pData[i] );
+            ILI_timeNs += SIM_NS_PER_BYTE;
+        }
+    }
+    return HAL_OK;
+}
+
+/**
+ * DMA transmit. The transfer completes immediately and
+ * HAL_SPI_TxCpltCallback() is called before returning. The DMA memory
+ * increment bit is taken from the channel CCR, as the hardware does.
+ */
+HAL_StatusTypeDef HAL_SPI_Transmit_DMA( SPI_HandleTypeDef *hspi,
+        uint8_t *pData, uint16_t Size )
+{
+    uint8_t increment = ( hspi->hdmatx->Instance->CCR & DMA_CCR_MINC ) ? 1 : 0;
+    const uint16_t *src = (const uint16_t*) pData;
+    uint16_t frames = Size;
+    uint16_t i;
+
+    ILI_stats.halCalls++;
+    ILI_timeNs += SIM_NS_DMA_SETUP;
+
+    // 8-bit frames from a half-word DMA are packed two per transfer, low byte first
+    if ( hspi->Init.DataSize <= SPI_DATASIZE_8BIT )
+    {
+        frames = Size / 2;
+    }
+    for ( i = 0; i < frames; i++ )
+    {
+        uint16_t h = *src;
+        if ( hspi->Init.DataSize <= SPI_DATASIZE_8BIT )
+        {
+            ILI_WriteByte( h );
+            ILI_WriteByte( h >> 8 );
+        }
+        else
+        {
+            ILI_WriteByte( h >> 8 );
+            ILI_WriteByte( h );
+        }
+        ILI_timeNs += 2 * SIM_NS_PER_BYTE;
+        if ( increment ) src++;
+    }
+
+    HAL_SPI_TxCpltCallback( hspi );
+    return HAL_OK;
+}
+
+void HAL_GPIO_WritePin( GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin,
+        GPIO_PinState PinState )
+{
+    ILI_timeNs += SIM_NS_GPIO;
+    if ( GPIOx == LCD_CS_GPIO_Port && GPIO_Pin == LCD_CS_Pin )
+    {
+        ILI_SetCS( PinState == GPIO_PIN_RESET );
+    }
+    else if ( GPIOx == DATA_CMD_GPIO_Port && GPIO_Pin == DATA_CMD_Pin )
+    {
+        ILI_SetDC( PinState == GPIO_PIN_SET );
+    }
+}
+
+GPIO_PinState HAL_GPIO_ReadPin( GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin )
+{
+    (void) GPIOx;
+    (void) GPIO_Pin;
+    return GPIO_PIN_SET;
+}
+
+void HAL_Delay( uint32_t Delay )
+{
+    ILI_timeNs += (uint64_t) Delay * 1000000;
+}
+
+uint32_t HAL_GetTick( void )
+{
+    return (uint32_t) ( ILI_timeNs / 1000000 );
+}
+
+/**
+ * The linker script's stack symbols. The host stack is not the reserved
+ * area they describe, so they are made equal, which puts its bottom at
+ * address 0 and leaves BENCH_StackUse() unlimited.
+ */
+uint8_t _estack;
+extern uint32_t _Min_Stack_Size __attribute__(( alias( "_estack" ) ));
+
+/**
+ * The UART of printf() and FMT_Printf() is the host's standard output.
+ */
+int __io_putchar( int ch )
+{
+    return putchar( ch );
+}